@@ -0,0 +1,286 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "av1_depacketizer.h"
+#include "av1_obu.h"
+
+static AV1Result_t CompleteObu( AV1Frame_t * pFrame,
+                                size_t obuStartIndex,
+                                size_t * pFrameDataIndex );
+
+/*-----------------------------------------------------------*/
+
+/* Converts the OBU element written at obuStartIndex into an OBU with size
+ * field. Temporal delimiters are removed as one is already written at the
+ * start of the frame. */
+static AV1Result_t CompleteObu( AV1Frame_t * pFrame,
+                                size_t obuStartIndex,
+                                size_t * pFrameDataIndex )
+{
+    AV1Result_t result = AV1_RESULT_OK;
+    uint8_t * pObuData = &( pFrame->pFrameData[ obuStartIndex ] );
+    size_t obuElementLength = *pFrameDataIndex - obuStartIndex;
+    size_t headerLength = AV1_OBU_HEADER_SIZE, payloadLength, leb128Size;
+    uint8_t obuType;
+
+    if( ( pObuData[ 0 ] & AV1_OBU_HEADER_X_BITMASK ) != 0 )
+    {
+        headerLength += AV1_OBU_EXTENSION_HEADER_SIZE;
+    }
+
+    if( obuElementLength < headerLength )
+    {
+        result = AV1_RESULT_MALFORMED_PACKET;
+    }
+
+    if( result == AV1_RESULT_OK )
+    {
+        obuType = ( pObuData[ 0 ] & AV1_OBU_HEADER_TYPE_BITMASK ) >> AV1_OBU_HEADER_TYPE_LOCATION;
+
+        if( obuType == AV1_OBU_TYPE_TEMPORAL_DELIMITER )
+        {
+            *pFrameDataIndex = obuStartIndex;
+        }
+        else if( ( pObuData[ 0 ] & AV1_OBU_HEADER_S_BITMASK ) == 0 )
+        {
+            payloadLength = obuElementLength - headerLength;
+            leb128Size = AV1Obu_GetLeb128Size( payloadLength );
+
+            if( ( pFrame->frameDataLength - *pFrameDataIndex ) >= leb128Size )
+            {
+                memmove( ( void * ) &( pObuData[ headerLength + leb128Size ] ),
+                         ( const void * ) &( pObuData[ headerLength ] ),
+                         payloadLength );
+                ( void ) AV1Obu_WriteLeb128( payloadLength,
+                                             &( pObuData[ headerLength ] ) );
+                pObuData[ 0 ] |= AV1_OBU_HEADER_S_BITMASK;
+
+                *pFrameDataIndex += leb128Size;
+            }
+            else
+            {
+                result = AV1_RESULT_OUT_OF_MEMORY;
+            }
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+AV1Result_t AV1Depacketizer_Init( AV1DepacketizerContext_t * pCtx,
+                                  AV1Packet_t * pPacketsArray,
+                                  size_t packetsArrayLength )
+{
+    AV1Result_t result = AV1_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pPacketsArray == NULL ) ||
+        ( packetsArrayLength == 0 ) )
+    {
+        result = AV1_RESULT_BAD_PARAM;
+    }
+
+    if( result == AV1_RESULT_OK )
+    {
+        pCtx->pPacketsArray = pPacketsArray;
+        pCtx->packetsArrayLength = packetsArrayLength;
+        pCtx->packetCount = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+AV1Result_t AV1Depacketizer_AddPacket( AV1DepacketizerContext_t * pCtx,
+                                       const AV1Packet_t * pPacket )
+{
+    AV1Result_t result = AV1_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pPacket == NULL ) ||
+        ( pPacket->pPacketData == NULL ) ||
+        ( pPacket->packetDataLength == 0 ) )
+    {
+        result = AV1_RESULT_BAD_PARAM;
+    }
+
+    if( result == AV1_RESULT_OK )
+    {
+        if( pCtx->packetCount >= pCtx->packetsArrayLength )
+        {
+            result = AV1_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == AV1_RESULT_OK )
+    {
+        pCtx->pPacketsArray[ pCtx->packetCount ].pPacketData = pPacket->pPacketData;
+        pCtx->pPacketsArray[ pCtx->packetCount ].packetDataLength = pPacket->packetDataLength;
+        pCtx->packetCount += 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+AV1Result_t AV1Depacketizer_GetFrame( AV1DepacketizerContext_t * pCtx,
+                                      AV1Frame_t * pFrame )
+{
+    AV1Result_t result = AV1_RESULT_OK;
+    const AV1Packet_t * pPacket;
+    size_t i, packetIndex, elementCount, elementLength, leb128Size;
+    size_t curFrameDataIndex = 0, obuStartIndex = 0;
+    uint8_t aggregationHeader, w, isObuPending = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pFrame->pFrameData == NULL ) ||
+        ( pFrame->frameDataLength < ( AV1_OBU_HEADER_SIZE + 1 ) ) )
+    {
+        result = AV1_RESULT_BAD_PARAM;
+    }
+
+    if( result == AV1_RESULT_OK )
+    {
+        /* Every temporal unit starts with a temporal delimiter. */
+        pFrame->pFrameData[ 0 ] = ( AV1_OBU_TYPE_TEMPORAL_DELIMITER << AV1_OBU_HEADER_TYPE_LOCATION ) |
+                                  AV1_OBU_HEADER_S_BITMASK;
+        pFrame->pFrameData[ 1 ] = 0;
+        curFrameDataIndex = AV1_OBU_HEADER_SIZE + 1;
+    }
+
+    for( i = 0; ( result == AV1_RESULT_OK ) && ( i < pCtx->packetCount ); i++ )
+    {
+        pPacket = &( pCtx->pPacketsArray[ i ] );
+        aggregationHeader = pPacket->pPacketData[ AV1_AGGREGATION_HEADER_OFFSET ];
+        w = ( aggregationHeader & AV1_AGGREGATION_HEADER_W_BITMASK ) >> AV1_AGGREGATION_HEADER_W_LOCATION;
+
+        /* A continuation must follow a fragment and a fragment must be
+         * continued. */
+        if( ( ( aggregationHeader & AV1_AGGREGATION_HEADER_Z_BITMASK ) != 0 ) != ( isObuPending != 0 ) )
+        {
+            result = AV1_RESULT_MALFORMED_PACKET;
+        }
+
+        packetIndex = AV1_AGGREGATION_HEADER_SIZE;
+        elementCount = 0;
+
+        while( ( result == AV1_RESULT_OK ) &&
+               ( packetIndex < pPacket->packetDataLength ) )
+        {
+            elementCount += 1;
+
+            if( elementCount == w )
+            {
+                /* The last element has no length field. */
+                elementLength = pPacket->packetDataLength - packetIndex;
+            }
+            else
+            {
+                leb128Size = AV1Obu_ReadLeb128( &( pPacket->pPacketData[ packetIndex ] ),
+                                                pPacket->packetDataLength - packetIndex,
+                                                &( elementLength ) );
+                packetIndex += leb128Size;
+
+                if( ( leb128Size == 0 ) ||
+                    ( elementLength > ( pPacket->packetDataLength - packetIndex ) ) )
+                {
+                    result = AV1_RESULT_MALFORMED_PACKET;
+                    break;
+                }
+            }
+
+            if( elementLength == 0 )
+            {
+                result = AV1_RESULT_MALFORMED_PACKET;
+            }
+            else if( ( pFrame->frameDataLength - curFrameDataIndex ) < elementLength )
+            {
+                result = AV1_RESULT_OUT_OF_MEMORY;
+            }
+            else
+            {
+                if( isObuPending == 0 )
+                {
+                    obuStartIndex = curFrameDataIndex;
+                }
+
+                memcpy( ( void * ) &( pFrame->pFrameData[ curFrameDataIndex ] ),
+                        ( const void * ) &( pPacket->pPacketData[ packetIndex ] ),
+                        elementLength );
+                curFrameDataIndex += elementLength;
+                packetIndex += elementLength;
+
+                if( ( packetIndex == pPacket->packetDataLength ) &&
+                    ( ( aggregationHeader & AV1_AGGREGATION_HEADER_Y_BITMASK ) != 0 ) )
+                {
+                    /* The OBU continues in the next packet. */
+                    isObuPending = 1;
+                }
+                else
+                {
+                    isObuPending = 0;
+                    result = CompleteObu( pFrame,
+                                          obuStartIndex,
+                                          &( curFrameDataIndex ) );
+                }
+            }
+        }
+    }
+
+    if( ( result == AV1_RESULT_OK ) &&
+        ( isObuPending != 0 ) )
+    {
+        result = AV1_RESULT_MALFORMED_PACKET;
+    }
+
+    if( result == AV1_RESULT_OK )
+    {
+        pFrame->frameDataLength = curFrameDataIndex;
+
+        /* Release the packets so that the next frame can be added. */
+        pCtx->packetCount = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+AV1Result_t AV1Depacketizer_GetPacketProperties( const uint8_t * pPacketData,
+                                                 const size_t packetDataLength,
+                                                 uint32_t * pProperties )
+{
+    AV1Result_t result = AV1_RESULT_OK;
+
+    if( ( pPacketData == NULL ) ||
+        ( packetDataLength < AV1_AGGREGATION_HEADER_SIZE ) ||
+        ( pProperties == NULL ) )
+    {
+        result = AV1_RESULT_BAD_PARAM;
+    }
+
+    if( result == AV1_RESULT_OK )
+    {
+        *pProperties = 0;
+
+        if( ( pPacketData[ AV1_AGGREGATION_HEADER_OFFSET ] & AV1_AGGREGATION_HEADER_Z_BITMASK ) == 0 )
+        {
+            *pProperties |= AV1_PACKET_PROP_OBU_START;
+        }
+
+        if( ( pPacketData[ AV1_AGGREGATION_HEADER_OFFSET ] & AV1_AGGREGATION_HEADER_N_BITMASK ) != 0 )
+        {
+            *pProperties |= AV1_PACKET_PROP_NEW_SEQUENCE;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
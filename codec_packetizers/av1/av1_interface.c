@@ -0,0 +1,70 @@
+/* API includes. */
+#include "av1_interface.h"
+#include "codec_interface_adapter.h"
+
+/*-----------------------------------------------------------*/
+
+/* In the order of AV1Result_t. */
+static const CodecResult_t resultMap[] =
+{
+    CODEC_RESULT_OK,
+    CODEC_RESULT_BAD_PARAM,
+    CODEC_RESULT_OUT_OF_MEMORY,
+    CODEC_RESULT_NO_MORE_PACKETS,
+    CODEC_RESULT_MALFORMED_PACKET
+};
+
+/*-----------------------------------------------------------*/
+
+CODEC_INTERFACE_DEFINE_ADD_FRAME( AddFrame,
+                                  AV1PacketizerContext_t,
+                                  AV1Frame_t,
+                                  AV1Packetizer_Init,
+                                  resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_PACKET( GetPacket,
+                                   AV1PacketizerContext_t,
+                                   AV1Packet_t,
+                                   AV1Packetizer_GetPacket,
+                                   resultMap )
+
+CODEC_INTERFACE_DEFINE_ADD_PACKET( AddPacket,
+                                   AV1DepacketizerContext_t,
+                                   AV1Packet_t,
+                                   AV1Depacketizer_AddPacket,
+                                   resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_FRAME( GetFrame,
+                                  AV1DepacketizerContext_t,
+                                  AV1Frame_t,
+                                  AV1Depacketizer_GetFrame,
+                                  resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_PACKET_PROPERTIES( GetPacketProperties,
+                                              AV1Depacketizer_GetPacketProperties,
+                                              resultMap )
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t AV1Interface_InitPacketizer( CodecPacketizer_t * pPacketizer,
+                                           AV1PacketizerContext_t * pCtx )
+{
+    return CodecInterface_BindPacketizer( pPacketizer,
+                                          ( void * ) pCtx,
+                                          AddFrame,
+                                          GetPacket );
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t AV1Interface_InitDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                             AV1DepacketizerContext_t * pCtx )
+{
+    return CodecInterface_BindDepacketizer( pDepacketizer,
+                                            ( void * ) pCtx,
+                                            AddPacket,
+                                            GetFrame,
+                                            GetPacketProperties );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,136 @@
+/* API includes. */
+#include "av1_obu.h"
+
+/* Each leb128 byte carries 7 bits of the value. */
+#define LEB128_VALUE_BITMASK    0x7F
+#define LEB128_MORE_BITMASK     0x80
+#define LEB128_BITS_PER_BYTE    7
+
+/*-----------------------------------------------------------*/
+
+size_t AV1Obu_ReadLeb128( const uint8_t * pBuffer,
+                          size_t bufferLength,
+                          size_t * pValue )
+{
+    size_t i, bytesRead = 0;
+    size_t maxBytes = AV1_MIN( bufferLength, AV1_LEB128_MAX_SIZE );
+    uint64_t value = 0;
+
+    /* AV1_LEB128_MAX_SIZE bytes carry at most 56 bits, so the value is
+     * accumulated in 64 bits and then checked to fit in size_t. */
+    for( i = 0; i < maxBytes; i++ )
+    {
+        value |= ( ( uint64_t ) ( pBuffer[ i ] & LEB128_VALUE_BITMASK ) ) << ( LEB128_BITS_PER_BYTE * i );
+
+        if( ( pBuffer[ i ] & LEB128_MORE_BITMASK ) == 0 )
+        {
+            if( value <= ( uint64_t ) SIZE_MAX )
+            {
+                bytesRead = i + 1;
+                *pValue = ( size_t ) value;
+            }
+
+            break;
+        }
+    }
+
+    return bytesRead;
+}
+
+/*-----------------------------------------------------------*/
+
+size_t AV1Obu_GetLeb128Size( size_t value )
+{
+    size_t size = 1;
+
+    while( value > LEB128_VALUE_BITMASK )
+    {
+        value >>= LEB128_BITS_PER_BYTE;
+        size += 1;
+    }
+
+    return size;
+}
+
+/*-----------------------------------------------------------*/
+
+size_t AV1Obu_WriteLeb128( size_t value,
+                           uint8_t * pBuffer )
+{
+    size_t i = 0;
+
+    while( value > LEB128_VALUE_BITMASK )
+    {
+        pBuffer[ i ] = ( uint8_t ) ( ( value & LEB128_VALUE_BITMASK ) | LEB128_MORE_BITMASK );
+        value >>= LEB128_BITS_PER_BYTE;
+        i += 1;
+    }
+
+    pBuffer[ i ] = ( uint8_t ) value;
+
+    return i + 1;
+}
+
+/*-----------------------------------------------------------*/
+
+AV1Result_t AV1Obu_Parse( const uint8_t * pBuffer,
+                          size_t bufferLength,
+                          AV1Obu_t * pObu )
+{
+    AV1Result_t result = AV1_RESULT_OK;
+    size_t sizeFieldLength = 0, payloadLength = 0;
+
+    if( ( pBuffer == NULL ) ||
+        ( bufferLength < AV1_OBU_HEADER_SIZE ) ||
+        ( pObu == NULL ) )
+    {
+        result = AV1_RESULT_BAD_PARAM;
+    }
+
+    if( result == AV1_RESULT_OK )
+    {
+        pObu->obuType = ( pBuffer[ 0 ] & AV1_OBU_HEADER_TYPE_BITMASK ) >> AV1_OBU_HEADER_TYPE_LOCATION;
+        pObu->headerLength = AV1_OBU_HEADER_SIZE;
+
+        if( ( pBuffer[ 0 ] & AV1_OBU_HEADER_X_BITMASK ) != 0 )
+        {
+            pObu->headerLength += AV1_OBU_EXTENSION_HEADER_SIZE;
+        }
+
+        if( pObu->headerLength > bufferLength )
+        {
+            result = AV1_RESULT_MALFORMED_PACKET;
+        }
+    }
+
+    if( result == AV1_RESULT_OK )
+    {
+        if( ( pBuffer[ 0 ] & AV1_OBU_HEADER_S_BITMASK ) != 0 )
+        {
+            sizeFieldLength = AV1Obu_ReadLeb128( &( pBuffer[ pObu->headerLength ] ),
+                                                 bufferLength - pObu->headerLength,
+                                                 &( payloadLength ) );
+
+            if( ( sizeFieldLength == 0 ) ||
+                ( payloadLength > ( bufferLength - pObu->headerLength - sizeFieldLength ) ) )
+            {
+                result = AV1_RESULT_MALFORMED_PACKET;
+            }
+        }
+        else
+        {
+            payloadLength = bufferLength - pObu->headerLength;
+        }
+    }
+
+    if( result == AV1_RESULT_OK )
+    {
+        pObu->payloadOffset = pObu->headerLength + sizeFieldLength;
+        pObu->payloadLength = payloadLength;
+        pObu->obuLength = pObu->payloadOffset + payloadLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
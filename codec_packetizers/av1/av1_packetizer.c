@@ -0,0 +1,235 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "av1_packetizer.h"
+#include "av1_obu.h"
+
+static void MoveToNextObu( AV1PacketizerContext_t * pCtx,
+                           size_t obuIndex );
+
+static void WriteObuElement( const AV1PacketizerContext_t * pCtx,
+                             uint8_t * pBuffer,
+                             size_t length );
+
+/*-----------------------------------------------------------*/
+
+/* Move to the first OBU at or after obuIndex which needs to be sent. */
+static void MoveToNextObu( AV1PacketizerContext_t * pCtx,
+                           size_t obuIndex )
+{
+    AV1Result_t result = AV1_RESULT_OK;
+
+    while( obuIndex < pCtx->frameDataLength )
+    {
+        /* OBUs are validated in AV1Packetizer_Init. */
+        result = AV1Obu_Parse( &( pCtx->pFrameData[ obuIndex ] ),
+                               pCtx->frameDataLength - obuIndex,
+                               &( pCtx->curObu ) );
+
+        if( ( result == AV1_RESULT_OK ) &&
+            ( pCtx->curObu.obuType != AV1_OBU_TYPE_TEMPORAL_DELIMITER ) &&
+            ( pCtx->curObu.obuType != AV1_OBU_TYPE_TILE_LIST ) )
+        {
+            break;
+        }
+
+        obuIndex += pCtx->curObu.obuLength;
+    }
+
+    pCtx->curObuIndex = obuIndex;
+    pCtx->curObuElementIndex = 0;
+}
+
+/*-----------------------------------------------------------*/
+
+/* An OBU element is the OBU without the size field. Write the next length
+ * bytes of the current OBU element. */
+static void WriteObuElement( const AV1PacketizerContext_t * pCtx,
+                             uint8_t * pBuffer,
+                             size_t length )
+{
+    const uint8_t * pObuData = &( pCtx->pFrameData[ pCtx->curObuIndex ] );
+    size_t headerLengthToSend = 0, bufferIndex = 0;
+
+    if( pCtx->curObuElementIndex < pCtx->curObu.headerLength )
+    {
+        headerLengthToSend = AV1_MIN( length,
+                                      pCtx->curObu.headerLength - pCtx->curObuElementIndex );
+
+        memcpy( ( void * ) &( pBuffer[ 0 ] ),
+                ( const void * ) &( pObuData[ pCtx->curObuElementIndex ] ),
+                headerLengthToSend );
+
+        if( pCtx->curObuElementIndex == 0 )
+        {
+            pBuffer[ 0 ] &= ( uint8_t ) ~AV1_OBU_HEADER_S_BITMASK;
+        }
+
+        bufferIndex = headerLengthToSend;
+    }
+
+    if( length > bufferIndex )
+    {
+        memcpy( ( void * ) &( pBuffer[ bufferIndex ] ),
+                ( const void * ) &( pObuData[ pCtx->curObu.payloadOffset +
+                                              pCtx->curObuElementIndex +
+                                              bufferIndex -
+                                              pCtx->curObu.headerLength ] ),
+                length - bufferIndex );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+AV1Result_t AV1Packetizer_Init( AV1PacketizerContext_t * pCtx,
+                                AV1Frame_t * pFrame )
+{
+    AV1Result_t result = AV1_RESULT_OK;
+    AV1Obu_t obu;
+    size_t obuIndex = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pFrame->pFrameData == NULL ) ||
+        ( pFrame->frameDataLength == 0 ) )
+    {
+        result = AV1_RESULT_BAD_PARAM;
+    }
+
+    if( result == AV1_RESULT_OK )
+    {
+        pCtx->isNewSequence = 0;
+
+        /* Validate all the OBUs in the frame. */
+        while( ( result == AV1_RESULT_OK ) &&
+               ( obuIndex < pFrame->frameDataLength ) )
+        {
+            result = AV1Obu_Parse( &( pFrame->pFrameData[ obuIndex ] ),
+                                   pFrame->frameDataLength - obuIndex,
+                                   &( obu ) );
+
+            if( result == AV1_RESULT_OK )
+            {
+                if( obu.obuType == AV1_OBU_TYPE_SEQUENCE_HEADER )
+                {
+                    pCtx->isNewSequence = 1;
+                }
+
+                obuIndex += obu.obuLength;
+            }
+        }
+    }
+
+    if( result == AV1_RESULT_OK )
+    {
+        pCtx->pFrameData = pFrame->pFrameData;
+        pCtx->frameDataLength = pFrame->frameDataLength;
+        pCtx->isFirstPacket = 1;
+
+        MoveToNextObu( pCtx,
+                       0 );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+AV1Result_t AV1Packetizer_GetPacket( AV1PacketizerContext_t * pCtx,
+                                     AV1Packet_t * pPacket )
+{
+    AV1Result_t result = AV1_RESULT_OK;
+    uint8_t aggregationHeader = 0;
+    size_t packetIndex = AV1_AGGREGATION_HEADER_SIZE;
+    size_t obuElementLength, remainingObuElementLength, remainingPacketLength, lengthToSend;
+
+    if( ( pCtx == NULL ) ||
+        ( pPacket == NULL ) ||
+        ( pPacket->pPacketData == NULL ) )
+    {
+        result = AV1_RESULT_BAD_PARAM;
+    }
+
+    if( result == AV1_RESULT_OK )
+    {
+        if( pCtx->curObuIndex >= pCtx->frameDataLength )
+        {
+            result = AV1_RESULT_NO_MORE_PACKETS;
+        }
+    }
+
+    if( result == AV1_RESULT_OK )
+    {
+        if( pCtx->curObuElementIndex > 0 )
+        {
+            aggregationHeader |= AV1_AGGREGATION_HEADER_Z_BITMASK;
+        }
+
+        if( ( pCtx->isFirstPacket != 0 ) &&
+            ( pCtx->isNewSequence != 0 ) )
+        {
+            aggregationHeader |= AV1_AGGREGATION_HEADER_N_BITMASK;
+        }
+
+        /* W is 0 - each OBU element is preceded by its length. */
+        while( ( pCtx->curObuIndex < pCtx->frameDataLength ) &&
+               ( packetIndex < pPacket->packetDataLength ) )
+        {
+            obuElementLength = pCtx->curObu.headerLength + pCtx->curObu.payloadLength;
+            remainingObuElementLength = obuElementLength - pCtx->curObuElementIndex;
+            remainingPacketLength = pPacket->packetDataLength - packetIndex;
+
+            if( ( AV1Obu_GetLeb128Size( remainingObuElementLength ) + remainingObuElementLength ) <= remainingPacketLength )
+            {
+                lengthToSend = remainingObuElementLength;
+            }
+            else
+            {
+                /* Fragment the OBU element to fill the packet. */
+                lengthToSend = remainingPacketLength - AV1Obu_GetLeb128Size( remainingPacketLength );
+
+                if( lengthToSend == 0 )
+                {
+                    break;
+                }
+            }
+
+            packetIndex += AV1Obu_WriteLeb128( lengthToSend,
+                                               &( pPacket->pPacketData[ packetIndex ] ) );
+            WriteObuElement( pCtx,
+                             &( pPacket->pPacketData[ packetIndex ] ),
+                             lengthToSend );
+            packetIndex += lengthToSend;
+            pCtx->curObuElementIndex += lengthToSend;
+
+            if( pCtx->curObuElementIndex == obuElementLength )
+            {
+                MoveToNextObu( pCtx,
+                               pCtx->curObuIndex + pCtx->curObu.obuLength );
+            }
+            else
+            {
+                /* The OBU element continues in the next packet. */
+                aggregationHeader |= AV1_AGGREGATION_HEADER_Y_BITMASK;
+                break;
+            }
+        }
+
+        if( packetIndex == AV1_AGGREGATION_HEADER_SIZE )
+        {
+            result = AV1_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == AV1_RESULT_OK )
+    {
+        pPacket->pPacketData[ AV1_AGGREGATION_HEADER_OFFSET ] = aggregationHeader;
+        pPacket->packetDataLength = packetIndex;
+        pCtx->isFirstPacket = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,128 @@
+#ifndef AV1_DATA_TYPES_H
+#define AV1_DATA_TYPES_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * AV1 Aggregation Header:
+ *
+ *  0 1 2 3 4 5 6 7
+ * +-+-+-+-+-+-+-+-+
+ * |Z|Y| W |N|-|-|-|
+ * +-+-+-+-+-+-+-+-+
+ *
+ * Z: First OBU element is the continuation of an OBU from the previous packet.
+ * Y: Last OBU element continues in the next packet.
+ * W: Number of OBU elements in the packet. 0 means that each OBU element is
+ *    preceded by its length, otherwise the last one is not.
+ * N: First packet of a coded video sequence.
+ */
+#define AV1_AGGREGATION_HEADER_SIZE         1
+#define AV1_AGGREGATION_HEADER_OFFSET       0
+
+#define AV1_AGGREGATION_HEADER_Z_BITMASK    0x80
+#define AV1_AGGREGATION_HEADER_Z_LOCATION   7
+
+#define AV1_AGGREGATION_HEADER_Y_BITMASK    0x40
+#define AV1_AGGREGATION_HEADER_Y_LOCATION   6
+
+#define AV1_AGGREGATION_HEADER_W_BITMASK    0x30
+#define AV1_AGGREGATION_HEADER_W_LOCATION   4
+
+#define AV1_AGGREGATION_HEADER_N_BITMASK    0x08
+#define AV1_AGGREGATION_HEADER_N_LOCATION   3
+
+/*-----------------------------------------------------------*/
+
+/*
+ * OBU Header:
+ *
+ *  0 1 2 3 4 5 6 7
+ * +-+-+-+-+-+-+-+-+
+ * |F| Type  |X|S|R|
+ * +-+-+-+-+-+-+-+-+
+ *
+ * Optional OBU Extension Header, if X is set:
+ *
+ *  0 1 2 3 4 5 6 7
+ * +-+-+-+-+-+-+-+-+
+ * | TID |SID|  R  |
+ * +-+-+-+-+-+-+-+-+
+ *
+ * S: obu_has_size_field - OBU header is followed by the OBU size (leb128).
+ */
+#define AV1_OBU_HEADER_SIZE                 1
+#define AV1_OBU_EXTENSION_HEADER_SIZE       1
+
+#define AV1_OBU_HEADER_TYPE_BITMASK         0x78
+#define AV1_OBU_HEADER_TYPE_LOCATION        3
+
+#define AV1_OBU_HEADER_X_BITMASK            0x04
+#define AV1_OBU_HEADER_X_LOCATION           2
+
+#define AV1_OBU_HEADER_S_BITMASK            0x02
+#define AV1_OBU_HEADER_S_LOCATION           1
+
+/* OBU types. */
+#define AV1_OBU_TYPE_SEQUENCE_HEADER        1
+#define AV1_OBU_TYPE_TEMPORAL_DELIMITER     2
+#define AV1_OBU_TYPE_TILE_LIST              8
+
+/* Maximum length of a leb128 encoded value. */
+#define AV1_LEB128_MAX_SIZE                 8
+
+/* Packet properties, used in AV1Depacketizer_GetPacketProperties. */
+/* Z bit in aggregation header is clear i.e. the packet starts with a new OBU.
+ * The first packet of a temporal unit has it set, but so do other packets of
+ * the temporal unit. The start of a temporal unit is the first packet after a
+ * packet with the RTP marker bit, or with a different RTP timestamp. */
+#define AV1_PACKET_PROP_OBU_START           ( 1 << 0 )
+#define AV1_PACKET_PROP_NEW_SEQUENCE        ( 1 << 1 ) /* N bit in aggregation header is set. */
+
+/*-----------------------------------------------------------*/
+
+#define AV1_MIN( a, b ) ( ( a ) < ( b ) ? ( a ) : ( b ) )
+#define AV1_MAX( a, b ) ( ( a ) > ( b ) ? ( a ) : ( b ) )
+
+/*-----------------------------------------------------------*/
+
+typedef enum AV1Result
+{
+    AV1_RESULT_OK,
+    AV1_RESULT_BAD_PARAM,
+    AV1_RESULT_OUT_OF_MEMORY,
+    AV1_RESULT_NO_MORE_PACKETS,
+    AV1_RESULT_MALFORMED_PACKET
+} AV1Result_t;
+
+/*-----------------------------------------------------------*/
+
+typedef struct AV1Packet
+{
+    uint8_t * pPacketData;
+    size_t packetDataLength;
+} AV1Packet_t;
+
+/* A temporal unit in low overhead bitstream format i.e. a sequence of OBUs,
+ * each with obu_has_size_field set except possibly the last one. */
+typedef struct AV1Frame
+{
+    uint8_t * pFrameData;
+    size_t frameDataLength;
+} AV1Frame_t;
+
+/* An OBU in a frame. */
+typedef struct AV1Obu
+{
+    uint8_t obuType;
+    size_t headerLength;    /* OBU header including the extension header. */
+    size_t payloadOffset;   /* Offset of the payload from the OBU start. */
+    size_t payloadLength;
+    size_t obuLength;       /* Header, size field and payload. */
+} AV1Obu_t;
+
+/*-----------------------------------------------------------*/
+
+#endif /* AV1_DATA_TYPES_H */
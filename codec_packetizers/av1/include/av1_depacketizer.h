@@ -0,0 +1,32 @@
+#ifndef AV1_DEPACKETIZER_H
+#define AV1_DEPACKETIZER_H
+
+/* Data types includes. */
+#include "av1_data_types.h"
+
+typedef struct AV1DePacketizerContext
+{
+    AV1Packet_t * pPacketsArray;
+    size_t packetsArrayLength;
+    size_t packetCount;
+} AV1DepacketizerContext_t;
+
+AV1Result_t AV1Depacketizer_Init( AV1DepacketizerContext_t * pCtx,
+                                  AV1Packet_t * pPacketsArray,
+                                  size_t packetsArrayLength );
+
+AV1Result_t AV1Depacketizer_AddPacket( AV1DepacketizerContext_t * pCtx,
+                                       const AV1Packet_t * pPacket );
+
+/* Returns the temporal unit in low overhead bitstream format, starting with a
+ * temporal delimiter OBU and with the size field set in all OBUs. The packets
+ * are released once the temporal unit is returned, so that the packets of the
+ * next one can be added. */
+AV1Result_t AV1Depacketizer_GetFrame( AV1DepacketizerContext_t * pCtx,
+                                      AV1Frame_t * pFrame );
+
+AV1Result_t AV1Depacketizer_GetPacketProperties( const uint8_t * pPacketData,
+                                                 const size_t packetDataLength,
+                                                 uint32_t * pProperties );
+
+#endif /* AV1_DEPACKETIZER_H */
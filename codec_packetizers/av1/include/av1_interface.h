@@ -0,0 +1,20 @@
+#ifndef AV1_INTERFACE_H
+#define AV1_INTERFACE_H
+
+/* API includes. */
+#include "codec_interface.h"
+#include "av1_packetizer.h"
+#include "av1_depacketizer.h"
+
+/* Binds a AV1 packetizer context to the common packetizer interface.
+ * Each temporal unit is added with AV1Packetizer_Init. */
+CodecResult_t AV1Interface_InitPacketizer( CodecPacketizer_t * pPacketizer,
+                                           AV1PacketizerContext_t * pCtx );
+
+/* Binds a AV1 depacketizer context to the common depacketizer interface.
+ * pCtx must be initialized with AV1Depacketizer_Init. The packets are
+ * dropped from pCtx once CodecDepacketizer_GetFrame returns the frame. */
+CodecResult_t AV1Interface_InitDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                             AV1DepacketizerContext_t * pCtx );
+
+#endif /* AV1_INTERFACE_H */
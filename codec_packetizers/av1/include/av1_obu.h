@@ -0,0 +1,27 @@
+#ifndef AV1_OBU_H
+#define AV1_OBU_H
+
+/* Data types includes. */
+#include "av1_data_types.h"
+
+/* Reads a leb128 encoded value. Returns the number of bytes read or 0 if the
+ * value is not valid. */
+size_t AV1Obu_ReadLeb128( const uint8_t * pBuffer,
+                          size_t bufferLength,
+                          size_t * pValue );
+
+/* Number of bytes needed to leb128 encode the value. */
+size_t AV1Obu_GetLeb128Size( size_t value );
+
+/* Writes the leb128 encoded value. pBuffer must have AV1Obu_GetLeb128Size( value )
+ * bytes. Returns the number of bytes written. */
+size_t AV1Obu_WriteLeb128( size_t value,
+                           uint8_t * pBuffer );
+
+/* Parses the OBU at the start of pBuffer. An OBU without size field extends
+ * till the end of the buffer. */
+AV1Result_t AV1Obu_Parse( const uint8_t * pBuffer,
+                          size_t bufferLength,
+                          AV1Obu_t * pObu );
+
+#endif /* AV1_OBU_H */
@@ -0,0 +1,27 @@
+#ifndef AV1_PACKETIZER_H
+#define AV1_PACKETIZER_H
+
+/* Data types includes. */
+#include "av1_data_types.h"
+
+typedef struct AV1PacketizerContext
+{
+    uint8_t * pFrameData;
+    size_t frameDataLength;
+    size_t curObuIndex;         /* Start of the OBU being packetized in the frame. */
+    AV1Obu_t curObu;
+    size_t curObuElementIndex;  /* Bytes of the current OBU element already sent. */
+    uint8_t isNewSequence;
+    uint8_t isFirstPacket;
+} AV1PacketizerContext_t;
+
+/* Temporal delimiter and tile list OBUs are not sent and the OBU size fields
+ * are removed. The N bit is set in the first packet if the frame contains a
+ * sequence header. */
+AV1Result_t AV1Packetizer_Init( AV1PacketizerContext_t * pCtx,
+                                AV1Frame_t * pFrame );
+
+AV1Result_t AV1Packetizer_GetPacket( AV1PacketizerContext_t * pCtx,
+                                     AV1Packet_t * pPacket );
+
+#endif /* AV1_PACKETIZER_H */
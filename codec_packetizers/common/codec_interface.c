@@ -0,0 +1,238 @@
+/* API includes. */
+#include "codec_interface.h"
+#include "codec_interface_adapter.h"
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t CodecPacketizer_AddFrame( CodecPacketizer_t * pPacketizer,
+                                        CodecFrame_t * pFrame )
+{
+    CodecResult_t result = CODEC_RESULT_OK;
+
+    if( ( pPacketizer == NULL ) ||
+        ( pPacketizer->pCodecCtx == NULL ) ||
+        ( pPacketizer->codecInterface.addFrameFn == NULL ) )
+    {
+        result = CODEC_RESULT_BAD_PARAM;
+    }
+
+    if( result == CODEC_RESULT_OK )
+    {
+        result = pPacketizer->codecInterface.addFrameFn( pPacketizer->pCodecCtx,
+                                                         pFrame );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t CodecPacketizer_GetPacket( CodecPacketizer_t * pPacketizer,
+                                         CodecPacket_t * pPacket )
+{
+    CodecResult_t result = CODEC_RESULT_OK;
+
+    if( ( pPacketizer == NULL ) ||
+        ( pPacketizer->pCodecCtx == NULL ) ||
+        ( pPacketizer->codecInterface.getPacketFn == NULL ) )
+    {
+        result = CODEC_RESULT_BAD_PARAM;
+    }
+
+    if( result == CODEC_RESULT_OK )
+    {
+        result = pPacketizer->codecInterface.getPacketFn( pPacketizer->pCodecCtx,
+                                                          pPacket );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t CodecPacketizer_GetPackets( CodecPacketizer_t * pPacketizer,
+                                          CodecPacket_t * pPacketsArray,
+                                          size_t packetsArrayLength,
+                                          size_t * pPacketCount )
+{
+    CodecResult_t result = CODEC_RESULT_OK;
+    size_t packetCount = 0;
+
+    if( ( pPacketizer == NULL ) ||
+        ( pPacketizer->pCodecCtx == NULL ) ||
+        ( pPacketizer->codecInterface.getPacketFn == NULL ) ||
+        ( pPacketsArray == NULL ) ||
+        ( packetsArrayLength == 0 ) ||
+        ( pPacketCount == NULL ) )
+    {
+        result = CODEC_RESULT_BAD_PARAM;
+    }
+
+    while( ( result == CODEC_RESULT_OK ) && ( packetCount < packetsArrayLength ) )
+    {
+        result = pPacketizer->codecInterface.getPacketFn( pPacketizer->pCodecCtx,
+                                                          &( pPacketsArray[ packetCount ] ) );
+
+        if( result == CODEC_RESULT_OK )
+        {
+            packetCount += 1;
+        }
+    }
+
+    if( result == CODEC_RESULT_NO_MORE_PACKETS )
+    {
+        result = CODEC_RESULT_OK;
+    }
+    else if( ( result == CODEC_RESULT_OK ) && ( packetCount == packetsArrayLength ) )
+    {
+        result = CODEC_RESULT_OUT_OF_MEMORY;
+    }
+
+    if( pPacketCount != NULL )
+    {
+        *pPacketCount = packetCount;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t CodecDepacketizer_AddPacket( CodecDepacketizer_t * pDepacketizer,
+                                           const CodecPacket_t * pPacket )
+{
+    CodecResult_t result = CODEC_RESULT_OK;
+
+    if( ( pDepacketizer == NULL ) ||
+        ( pDepacketizer->pCodecCtx == NULL ) ||
+        ( pDepacketizer->codecInterface.addPacketFn == NULL ) )
+    {
+        result = CODEC_RESULT_BAD_PARAM;
+    }
+
+    if( result == CODEC_RESULT_OK )
+    {
+        result = pDepacketizer->codecInterface.addPacketFn( pDepacketizer->pCodecCtx,
+                                                            pPacket );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t CodecDepacketizer_GetFrame( CodecDepacketizer_t * pDepacketizer,
+                                          CodecFrame_t * pFrame )
+{
+    CodecResult_t result = CODEC_RESULT_OK;
+
+    if( ( pDepacketizer == NULL ) ||
+        ( pDepacketizer->pCodecCtx == NULL ) ||
+        ( pDepacketizer->codecInterface.getFrameFn == NULL ) )
+    {
+        result = CODEC_RESULT_BAD_PARAM;
+    }
+
+    if( result == CODEC_RESULT_OK )
+    {
+        result = pDepacketizer->codecInterface.getFrameFn( pDepacketizer->pCodecCtx,
+                                                           pFrame );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t CodecDepacketizer_GetPacketProperties( CodecDepacketizer_t * pDepacketizer,
+                                                     const uint8_t * pPacketData,
+                                                     const size_t packetDataLength,
+                                                     uint32_t * pProperties )
+{
+    CodecResult_t result = CODEC_RESULT_OK;
+
+    if( ( pDepacketizer == NULL ) ||
+        ( pDepacketizer->codecInterface.getPacketPropertiesFn == NULL ) )
+    {
+        result = CODEC_RESULT_BAD_PARAM;
+    }
+
+    if( result == CODEC_RESULT_OK )
+    {
+        result = pDepacketizer->codecInterface.getPacketPropertiesFn( pPacketData,
+                                                                      packetDataLength,
+                                                                      pProperties );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t CodecInterface_MapResult( uint32_t codecResult,
+                                        const CodecResult_t * pResultMap,
+                                        size_t resultMapLength )
+{
+    CodecResult_t result = CODEC_RESULT_MALFORMED_PACKET;
+
+    if( codecResult < resultMapLength )
+    {
+        result = pResultMap[ codecResult ];
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t CodecInterface_BindPacketizer( CodecPacketizer_t * pPacketizer,
+                                             void * pCodecCtx,
+                                             CodecAddFrame_t addFrameFn,
+                                             CodecGetPacket_t getPacketFn )
+{
+    CodecResult_t result = CODEC_RESULT_OK;
+
+    if( ( pPacketizer == NULL ) ||
+        ( pCodecCtx == NULL ) )
+    {
+        result = CODEC_RESULT_BAD_PARAM;
+    }
+
+    if( result == CODEC_RESULT_OK )
+    {
+        pPacketizer->codecInterface.addFrameFn = addFrameFn;
+        pPacketizer->codecInterface.getPacketFn = getPacketFn;
+        pPacketizer->pCodecCtx = pCodecCtx;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t CodecInterface_BindDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                               void * pCodecCtx,
+                                               CodecAddPacket_t addPacketFn,
+                                               CodecGetFrame_t getFrameFn,
+                                               CodecGetPacketProperties_t getPacketPropertiesFn )
+{
+    CodecResult_t result = CODEC_RESULT_OK;
+
+    if( ( pDepacketizer == NULL ) ||
+        ( pCodecCtx == NULL ) )
+    {
+        result = CODEC_RESULT_BAD_PARAM;
+    }
+
+    if( result == CODEC_RESULT_OK )
+    {
+        pDepacketizer->codecInterface.addPacketFn = addPacketFn;
+        pDepacketizer->codecInterface.getFrameFn = getFrameFn;
+        pDepacketizer->codecInterface.getPacketPropertiesFn = getPacketPropertiesFn;
+        pDepacketizer->pCodecCtx = pCodecCtx;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
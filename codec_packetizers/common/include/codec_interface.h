@@ -0,0 +1,115 @@
+#ifndef CODEC_INTERFACE_H
+#define CODEC_INTERFACE_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/* Packet properties common to all codecs, used in
+ * CodecDepacketizer_GetPacketProperties. Other bits are codec specific.
+ * START_PACKET marks a packet that can begin a frame, e.g. every NAL unit
+ * start for H.264 and H.265 and every layer start for VP9. FRAME_START marks
+ * a packet known to begin a frame - every G.711 and Opus packet, the first
+ * packet of a VP8 frame and the start of the base spatial layer for VP9. */
+#define CODEC_PACKET_PROPERTY_START_PACKET  ( 1 << 0 )
+#define CODEC_PACKET_PROPERTY_FRAME_START   ( 1U << 31 )
+
+/*-----------------------------------------------------------*/
+
+typedef enum CodecResult
+{
+    CODEC_RESULT_OK,
+    CODEC_RESULT_BAD_PARAM,
+    CODEC_RESULT_OUT_OF_MEMORY,
+    CODEC_RESULT_NO_MORE_PACKETS,
+    CODEC_RESULT_NO_MORE_FRAMES,
+    CODEC_RESULT_MALFORMED_PACKET,
+    CODEC_RESULT_UNSUPPORTED_PACKET,
+    CODEC_RESULT_INCOMPLETE_FRAME
+} CodecResult_t;
+
+/*-----------------------------------------------------------*/
+
+typedef struct CodecPacket
+{
+    uint8_t * pPacketData;
+    size_t packetDataLength;
+} CodecPacket_t;
+
+typedef struct CodecFrame
+{
+    uint8_t * pFrameData;
+    size_t frameDataLength;
+} CodecFrame_t;
+
+/*-----------------------------------------------------------*/
+
+/* Codec interface function types. pCodecCtx is the codec specific context. */
+typedef CodecResult_t ( * CodecAddFrame_t ) ( void * pCodecCtx,
+                                              CodecFrame_t * pFrame );
+typedef CodecResult_t ( * CodecGetPacket_t ) ( void * pCodecCtx,
+                                               CodecPacket_t * pPacket );
+typedef CodecResult_t ( * CodecAddPacket_t ) ( void * pCodecCtx,
+                                               const CodecPacket_t * pPacket );
+typedef CodecResult_t ( * CodecGetFrame_t ) ( void * pCodecCtx,
+                                              CodecFrame_t * pFrame );
+typedef CodecResult_t ( * CodecGetPacketProperties_t ) ( const uint8_t * pPacketData,
+                                                         const size_t packetDataLength,
+                                                         uint32_t * pProperties );
+
+typedef struct CodecPacketizerInterface
+{
+    CodecAddFrame_t addFrameFn;
+    CodecGetPacket_t getPacketFn;
+} CodecPacketizerInterface_t;
+
+typedef struct CodecDepacketizerInterface
+{
+    CodecAddPacket_t addPacketFn;
+    CodecGetFrame_t getFrameFn;
+    CodecGetPacketProperties_t getPacketPropertiesFn;
+} CodecDepacketizerInterface_t;
+
+/* Set up by the codec specific <Codec>Interface_InitPacketizer and
+ * <Codec>Interface_InitDepacketizer. */
+typedef struct CodecPacketizer
+{
+    CodecPacketizerInterface_t codecInterface;
+    void * pCodecCtx;
+} CodecPacketizer_t;
+
+typedef struct CodecDepacketizer
+{
+    CodecDepacketizerInterface_t codecInterface;
+    void * pCodecCtx;
+} CodecDepacketizer_t;
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t CodecPacketizer_AddFrame( CodecPacketizer_t * pPacketizer,
+                                        CodecFrame_t * pFrame );
+
+CodecResult_t CodecPacketizer_GetPacket( CodecPacketizer_t * pPacketizer,
+                                         CodecPacket_t * pPacket );
+
+/* Gets the packets of the frame in one call. Each packet in pPacketsArray must
+ * point to a buffer and its length. pPacketCount is set to the number of
+ * packets filled. Returns CODEC_RESULT_OUT_OF_MEMORY if the frame needs more
+ * packets - call again to get the rest. */
+CodecResult_t CodecPacketizer_GetPackets( CodecPacketizer_t * pPacketizer,
+                                          CodecPacket_t * pPacketsArray,
+                                          size_t packetsArrayLength,
+                                          size_t * pPacketCount );
+
+CodecResult_t CodecDepacketizer_AddPacket( CodecDepacketizer_t * pDepacketizer,
+                                           const CodecPacket_t * pPacket );
+
+CodecResult_t CodecDepacketizer_GetFrame( CodecDepacketizer_t * pDepacketizer,
+                                          CodecFrame_t * pFrame );
+
+CodecResult_t CodecDepacketizer_GetPacketProperties( CodecDepacketizer_t * pDepacketizer,
+                                                     const uint8_t * pPacketData,
+                                                     const size_t packetDataLength,
+                                                     uint32_t * pProperties );
+
+#endif /* CODEC_INTERFACE_H */
@@ -0,0 +1,198 @@
+#ifndef CODEC_INTERFACE_ADAPTER_H
+#define CODEC_INTERFACE_ADAPTER_H
+
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "codec_interface.h"
+
+/* Used by the <codec>_interface.c files to bind the codec specific packetizers
+ * and depacketizers to the common interface. Not needed by applications. */
+
+/*-----------------------------------------------------------*/
+
+/* pResultMap holds the CodecResult_t for each value of the codec result enum,
+ * in order. Results past the end of the map are mapped to
+ * CODEC_RESULT_MALFORMED_PACKET. */
+CodecResult_t CodecInterface_MapResult( uint32_t codecResult,
+                                        const CodecResult_t * pResultMap,
+                                        size_t resultMapLength );
+
+CodecResult_t CodecInterface_BindPacketizer( CodecPacketizer_t * pPacketizer,
+                                             void * pCodecCtx,
+                                             CodecAddFrame_t addFrameFn,
+                                             CodecGetPacket_t getPacketFn );
+
+CodecResult_t CodecInterface_BindDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                               void * pCodecCtx,
+                                               CodecAddPacket_t addPacketFn,
+                                               CodecGetFrame_t getFrameFn,
+                                               CodecGetPacketProperties_t getPacketPropertiesFn );
+
+/*-----------------------------------------------------------*/
+
+#define CODEC_INTERFACE_MAP_RESULT( codecResult, resultMap )                      \
+    CodecInterface_MapResult( ( uint32_t ) ( codecResult ),                       \
+                              &( ( resultMap )[ 0 ] ),                            \
+                              sizeof( resultMap ) / sizeof( ( resultMap )[ 0 ] ) )
+
+/* The macros below define the static adapter functions of a codec. codecFn is
+ * the codec function, taking the codec context and the codec packet or frame
+ * type, which must have the same data and length members as CodecPacket_t and
+ * CodecFrame_t. Frames are zeroed before the data and length are set, so
+ * other frame fields are 0. */
+
+#define CODEC_INTERFACE_DEFINE_ADD_FRAME( name, CtxType, FrameType, codecFn, resultMap ) \
+    static CodecResult_t name( void * pCodecCtx,                                         \
+                               CodecFrame_t * pFrame )                                   \
+    {                                                                                    \
+        CodecResult_t result = CODEC_RESULT_OK;                                          \
+        FrameType frame;                                                                 \
+                                                                                         \
+        if( pFrame == NULL )                                                             \
+        {                                                                                \
+            result = CODEC_RESULT_BAD_PARAM;                                             \
+        }                                                                                \
+                                                                                         \
+        if( result == CODEC_RESULT_OK )                                                  \
+        {                                                                                \
+            memset( &( frame ),                                                          \
+                    0,                                                                   \
+                    sizeof( frame ) );                                                   \
+                                                                                         \
+            frame.pFrameData = pFrame->pFrameData;                                       \
+            frame.frameDataLength = pFrame->frameDataLength;                             \
+                                                                                         \
+            result = CODEC_INTERFACE_MAP_RESULT( codecFn( ( CtxType * ) pCodecCtx,       \
+                                                          &( frame ) ),                  \
+                                                 resultMap );                            \
+        }                                                                                \
+                                                                                         \
+        return result;                                                                   \
+    }
+
+#define CODEC_INTERFACE_DEFINE_GET_PACKET( name, CtxType, PacketType, codecFn, resultMap ) \
+    static CodecResult_t name( void * pCodecCtx,                                           \
+                               CodecPacket_t * pPacket )                                   \
+    {                                                                                      \
+        CodecResult_t result = CODEC_RESULT_OK;                                            \
+        PacketType packet;                                                                 \
+                                                                                           \
+        if( pPacket == NULL )                                                              \
+        {                                                                                  \
+            result = CODEC_RESULT_BAD_PARAM;                                               \
+        }                                                                                  \
+                                                                                           \
+        if( result == CODEC_RESULT_OK )                                                    \
+        {                                                                                  \
+            packet.pPacketData = pPacket->pPacketData;                                     \
+            packet.packetDataLength = pPacket->packetDataLength;                           \
+                                                                                           \
+            result = CODEC_INTERFACE_MAP_RESULT( codecFn( ( CtxType * ) pCodecCtx,         \
+                                                          &( packet ) ),                   \
+                                                 resultMap );                              \
+        }                                                                                  \
+                                                                                           \
+        if( result == CODEC_RESULT_OK )                                                    \
+        {                                                                                  \
+            pPacket->packetDataLength = packet.packetDataLength;                           \
+        }                                                                                  \
+                                                                                           \
+        return result;                                                                     \
+    }
+
+#define CODEC_INTERFACE_DEFINE_ADD_PACKET( name, CtxType, PacketType, codecFn, resultMap ) \
+    static CodecResult_t name( void * pCodecCtx,                                           \
+                               const CodecPacket_t * pPacket )                             \
+    {                                                                                      \
+        CodecResult_t result = CODEC_RESULT_OK;                                            \
+        PacketType packet;                                                                 \
+                                                                                           \
+        if( pPacket == NULL )                                                              \
+        {                                                                                  \
+            result = CODEC_RESULT_BAD_PARAM;                                               \
+        }                                                                                  \
+                                                                                           \
+        if( result == CODEC_RESULT_OK )                                                    \
+        {                                                                                  \
+            packet.pPacketData = pPacket->pPacketData;                                     \
+            packet.packetDataLength = pPacket->packetDataLength;                           \
+                                                                                           \
+            result = CODEC_INTERFACE_MAP_RESULT( codecFn( ( CtxType * ) pCodecCtx,         \
+                                                          &( packet ) ),                   \
+                                                 resultMap );                              \
+        }                                                                                  \
+                                                                                           \
+        return result;                                                                     \
+    }
+
+#define CODEC_INTERFACE_DEFINE_GET_FRAME( name, CtxType, FrameType, codecFn, resultMap ) \
+    static CodecResult_t name( void * pCodecCtx,                                         \
+                               CodecFrame_t * pFrame )                                   \
+    {                                                                                    \
+        CodecResult_t result = CODEC_RESULT_OK;                                          \
+        FrameType frame;                                                                 \
+                                                                                         \
+        if( pFrame == NULL )                                                             \
+        {                                                                                \
+            result = CODEC_RESULT_BAD_PARAM;                                             \
+        }                                                                                \
+                                                                                         \
+        if( result == CODEC_RESULT_OK )                                                  \
+        {                                                                                \
+            memset( &( frame ),                                                          \
+                    0,                                                                   \
+                    sizeof( frame ) );                                                   \
+                                                                                         \
+            frame.pFrameData = pFrame->pFrameData;                                       \
+            frame.frameDataLength = pFrame->frameDataLength;                             \
+                                                                                         \
+            result = CODEC_INTERFACE_MAP_RESULT( codecFn( ( CtxType * ) pCodecCtx,       \
+                                                          &( frame ) ),                  \
+                                                 resultMap );                            \
+        }                                                                                \
+                                                                                         \
+        if( result == CODEC_RESULT_OK )                                                  \
+        {                                                                                \
+            pFrame->frameDataLength = frame.frameDataLength;                             \
+        }                                                                                \
+                                                                                         \
+        return result;                                                                   \
+    }
+
+#define CODEC_INTERFACE_DEFINE_GET_PACKET_PROPERTIES( name, codecFn, resultMap ) \
+    static CodecResult_t name( const uint8_t * pPacketData,                      \
+                               const size_t packetDataLength,                    \
+                               uint32_t * pProperties )                          \
+    {                                                                            \
+        return CODEC_INTERFACE_MAP_RESULT( codecFn( pPacketData,                 \
+                                                    packetDataLength,            \
+                                                    pProperties ),               \
+                                           resultMap );                          \
+    }
+
+/* As above, also setting CODEC_PACKET_PROPERTY_FRAME_START when the codec
+ * properties masked with frameStartBitmask equal frameStartProperties. */
+#define CODEC_INTERFACE_DEFINE_GET_PACKET_PROPERTIES_WITH_FRAME_START( name, codecFn, resultMap, frameStartBitmask, frameStartProperties ) \
+    static CodecResult_t name( const uint8_t * pPacketData,                                                                            \
+                               const size_t packetDataLength,                                                                          \
+                               uint32_t * pProperties )                                                                                \
+    {                                                                                                                                  \
+        CodecResult_t result;                                                                                                          \
+                                                                                                                                       \
+        result = CODEC_INTERFACE_MAP_RESULT( codecFn( pPacketData,                                                                     \
+                                                      packetDataLength,                                                                \
+                                                      pProperties ),                                                                   \
+                                             resultMap );                                                                              \
+                                                                                                                                       \
+        if( ( result == CODEC_RESULT_OK ) &&                                                                                           \
+            ( ( *pProperties & ( uint32_t ) ( frameStartBitmask ) ) == ( uint32_t ) ( frameStartProperties ) ) )                       \
+        {                                                                                                                              \
+            *pProperties |= CODEC_PACKET_PROPERTY_FRAME_START;                                                                         \
+        }                                                                                                                              \
+                                                                                                                                       \
+        return result;                                                                                                                 \
+    }
+
+#endif /* CODEC_INTERFACE_ADAPTER_H */
@@ -0,0 +1,49 @@
+#ifndef SIMPLE_PAYLOAD_ASSEMBLER_H
+#define SIMPLE_PAYLOAD_ASSEMBLER_H
+
+/* API includes. */
+#include "codec_interface.h"
+
+/* Assembler for codecs whose RTP payload is the codec data itself, without a
+ * payload header (e.g. G.711, Opus). Packets are referenced, not copied, in a
+ * caller supplied packets array used as a ring, so packets can be added while
+ * earlier ones are read. */
+typedef struct SimplePayloadAssembler
+{
+    CodecPacket_t * pPacketsArray;
+    size_t packetsArrayLength;
+    size_t headIndex;
+    size_t tailIndex;
+    size_t packetCount;
+} SimplePayloadAssembler_t;
+
+CodecResult_t SimplePayloadAssembler_Init( SimplePayloadAssembler_t * pAssembler,
+                                           CodecPacket_t * pPacketsArray,
+                                           size_t packetsArrayLength );
+
+CodecResult_t SimplePayloadAssembler_AddPacket( SimplePayloadAssembler_t * pAssembler,
+                                                const CodecPacket_t * pPacket );
+
+/* Returns the oldest packet without removing it. */
+CodecResult_t SimplePayloadAssembler_PeekPacket( const SimplePayloadAssembler_t * pAssembler,
+                                                 CodecPacket_t * pPacket );
+
+/* Removes the oldest packet and returns it. The returned packet points to the
+ * packet buffer passed to SimplePayloadAssembler_AddPacket. */
+CodecResult_t SimplePayloadAssembler_GetPacket( SimplePayloadAssembler_t * pAssembler,
+                                                CodecPacket_t * pPacket );
+
+/* Copies all the packets one after another in pFrame and removes them. No
+ * packet is removed if pFrame is too small. */
+CodecResult_t SimplePayloadAssembler_GetFrame( SimplePayloadAssembler_t * pAssembler,
+                                               CodecFrame_t * pFrame );
+
+/* Maps a result of the functions above to the result enum of a codec.
+ * pResultMap holds the codec result for each value of CodecResult_t, in
+ * order. Results past the end of the map are mapped to unknownResult. */
+uint32_t SimplePayloadAssembler_MapResult( CodecResult_t result,
+                                           const uint32_t * pResultMap,
+                                           size_t resultMapLength,
+                                           uint32_t unknownResult );
+
+#endif /* SIMPLE_PAYLOAD_ASSEMBLER_H */
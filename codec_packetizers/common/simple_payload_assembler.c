@@ -0,0 +1,192 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "simple_payload_assembler.h"
+
+CodecResult_t SimplePayloadAssembler_Init( SimplePayloadAssembler_t * pAssembler,
+                                           CodecPacket_t * pPacketsArray,
+                                           size_t packetsArrayLength )
+{
+    CodecResult_t result = CODEC_RESULT_OK;
+
+    if( ( pAssembler == NULL ) ||
+        ( pPacketsArray == NULL ) ||
+        ( packetsArrayLength == 0 ) )
+    {
+        result = CODEC_RESULT_BAD_PARAM;
+    }
+
+    if( result == CODEC_RESULT_OK )
+    {
+        pAssembler->pPacketsArray = pPacketsArray;
+        pAssembler->packetsArrayLength = packetsArrayLength;
+        pAssembler->headIndex = 0;
+        pAssembler->tailIndex = 0;
+        pAssembler->packetCount = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t SimplePayloadAssembler_AddPacket( SimplePayloadAssembler_t * pAssembler,
+                                                const CodecPacket_t * pPacket )
+{
+    CodecResult_t result = CODEC_RESULT_OK;
+
+    if( ( pAssembler == NULL ) ||
+        ( pPacket == NULL ) )
+    {
+        result = CODEC_RESULT_BAD_PARAM;
+    }
+
+    if( result == CODEC_RESULT_OK )
+    {
+        if( pAssembler->packetCount >= pAssembler->packetsArrayLength )
+        {
+            result = CODEC_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == CODEC_RESULT_OK )
+    {
+        pAssembler->pPacketsArray[ pAssembler->headIndex ].pPacketData = pPacket->pPacketData;
+        pAssembler->pPacketsArray[ pAssembler->headIndex ].packetDataLength = pPacket->packetDataLength;
+
+        pAssembler->headIndex = ( pAssembler->headIndex + 1 ) % pAssembler->packetsArrayLength;
+        pAssembler->packetCount += 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t SimplePayloadAssembler_PeekPacket( const SimplePayloadAssembler_t * pAssembler,
+                                                 CodecPacket_t * pPacket )
+{
+    CodecResult_t result = CODEC_RESULT_OK;
+
+    if( ( pAssembler == NULL ) ||
+        ( pPacket == NULL ) )
+    {
+        result = CODEC_RESULT_BAD_PARAM;
+    }
+
+    if( result == CODEC_RESULT_OK )
+    {
+        if( pAssembler->packetCount == 0 )
+        {
+            result = CODEC_RESULT_NO_MORE_PACKETS;
+        }
+    }
+
+    if( result == CODEC_RESULT_OK )
+    {
+        pPacket->pPacketData = pAssembler->pPacketsArray[ pAssembler->tailIndex ].pPacketData;
+        pPacket->packetDataLength = pAssembler->pPacketsArray[ pAssembler->tailIndex ].packetDataLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t SimplePayloadAssembler_GetPacket( SimplePayloadAssembler_t * pAssembler,
+                                                CodecPacket_t * pPacket )
+{
+    CodecResult_t result;
+
+    result = SimplePayloadAssembler_PeekPacket( pAssembler,
+                                                pPacket );
+
+    if( result == CODEC_RESULT_OK )
+    {
+        pAssembler->tailIndex = ( pAssembler->tailIndex + 1 ) % pAssembler->packetsArrayLength;
+        pAssembler->packetCount -= 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t SimplePayloadAssembler_GetFrame( SimplePayloadAssembler_t * pAssembler,
+                                               CodecFrame_t * pFrame )
+{
+    CodecResult_t result = CODEC_RESULT_OK;
+    CodecPacket_t * pPacket;
+    size_t i, packetIndex = 0, currentFrameDataIndex = 0;
+
+    if( ( pAssembler == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pFrame->pFrameData == NULL ) ||
+        ( pFrame->frameDataLength == 0 ) )
+    {
+        result = CODEC_RESULT_BAD_PARAM;
+    }
+
+    if( result == CODEC_RESULT_OK )
+    {
+        if( pAssembler->packetCount == 0 )
+        {
+            result = CODEC_RESULT_NO_MORE_PACKETS;
+        }
+        else
+        {
+            packetIndex = pAssembler->tailIndex;
+        }
+    }
+
+    for( i = 0; ( result == CODEC_RESULT_OK ) && ( i < pAssembler->packetCount ); i++ )
+    {
+        pPacket = &( pAssembler->pPacketsArray[ packetIndex ] );
+
+        if( ( pFrame->frameDataLength - currentFrameDataIndex ) >= pPacket->packetDataLength )
+        {
+            memcpy( ( void * ) &( pFrame->pFrameData[ currentFrameDataIndex ] ),
+                    ( const void * ) &( pPacket->pPacketData[ 0 ] ),
+                    pPacket->packetDataLength );
+
+            currentFrameDataIndex += pPacket->packetDataLength;
+        }
+        else
+        {
+            result = CODEC_RESULT_OUT_OF_MEMORY;
+        }
+
+        packetIndex = ( packetIndex + 1 ) % pAssembler->packetsArrayLength;
+    }
+
+    /* Packets are removed only once the complete frame is copied. */
+    if( result == CODEC_RESULT_OK )
+    {
+        pAssembler->tailIndex = pAssembler->headIndex;
+        pAssembler->packetCount = 0;
+
+        pFrame->frameDataLength = currentFrameDataIndex;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+uint32_t SimplePayloadAssembler_MapResult( CodecResult_t result,
+                                           const uint32_t * pResultMap,
+                                           size_t resultMapLength,
+                                           uint32_t unknownResult )
+{
+    uint32_t codecResult = unknownResult;
+
+    if( ( size_t ) result < resultMapLength )
+    {
+        codecResult = pResultMap[ result ];
+    }
+
+    return codecResult;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,304 @@
+/* API includes. */
+#include "g711_codec.h"
+
+static uint8_t MuLawEncodeSample( int16_t pcmSample );
+
+static int16_t MuLawDecodeSample( uint8_t encodedSample );
+
+static uint8_t ALawEncodeSample( int16_t pcmSample );
+
+static int16_t ALawDecodeSample( uint8_t encodedSample );
+
+static uint8_t MuLawToALawSample( uint8_t muLawSample );
+
+static uint8_t ALawToMuLawSample( uint8_t aLawSample );
+
+/*-----------------------------------------------------------*/
+
+/* Mu-law to A-law and A-law to mu-law conversion from ITU-T G.711 Tables 3
+ * and 4. Both are indexed by the magnitude of the code, numbered from 0 for
+ * the lowest level, and give the magnitude of the converted code. Mu-law
+ * magnitude 0 is the zero level, A-law magnitude 0 is the first step. */
+static const uint8_t muLawToALawTable[ 128 ] =
+{
+      0,   0,   1,   1,   2,   2,   3,   3,   4,   4,   5,   5,   6,   6,   7,   7,
+      8,   9,  10,  11,  12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  23,
+     24,  26,  28,  30,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,
+     45,  47,  48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,
+     79,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,
+     96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127
+};
+
+static const uint8_t aLawToMuLawTable[ 128 ] =
+{
+      1,   3,   5,   7,   9,  11,  13,  15,  16,  17,  18,  19,  20,  21,  22,  23,
+     24,  25,  26,  27,  28,  29,  30,  31,  32,  32,  33,  33,  34,  34,  35,  35,
+     36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  48,  48,  49,  49,
+     50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  64,
+     65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  80,
+     80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,
+     96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127
+};
+
+/*-----------------------------------------------------------*/
+
+static uint8_t MuLawEncodeSample( int16_t pcmSample )
+{
+    int32_t value, sign, magnitude, segment;
+    uint8_t mask;
+
+    /* Mu-law works on 14-bit magnitude. */
+    value = ( int32_t ) pcmSample >> 2;
+    sign = value >> 31;
+    magnitude = ( value ^ sign ) - sign;
+    magnitude += ( G711_MULAW_BIAS >> 2 );
+    magnitude = ( magnitude > G711_MULAW_MAX_MAGNITUDE ) ? G711_MULAW_MAX_MAGNITUDE : magnitude;
+    mask = ( sign != 0 ) ? 0x7F : 0xFF;
+
+    /* Segment is the position of the highest set bit, counted from bit 6. */
+    segment = ( magnitude > 0x3F ) + ( magnitude > 0x7F ) + ( magnitude > 0xFF ) +
+              ( magnitude > 0x1FF ) + ( magnitude > 0x3FF ) + ( magnitude > 0x7FF ) +
+              ( magnitude > 0xFFF );
+
+    return ( uint8_t ) ( ( ( segment << G711_SEGMENT_LOCATION ) |
+                           ( ( magnitude >> ( segment + 1 ) ) & G711_QUANT_BITMASK ) ) ^ mask );
+}
+
+/*-----------------------------------------------------------*/
+
+static int16_t MuLawDecodeSample( uint8_t encodedSample )
+{
+    uint32_t value, magnitude;
+
+    /* Unsigned arithmetic keeps the compiler from narrowing the variable
+     * shift to 16 bits, which most SIMD instruction sets lack. */
+    value = ( uint8_t ) ~encodedSample;
+    magnitude = ( ( ( ( value & G711_QUANT_BITMASK ) << 3 ) + G711_MULAW_BIAS ) <<
+                  ( ( value & G711_SEGMENT_BITMASK ) >> G711_SEGMENT_LOCATION ) ) - G711_MULAW_BIAS;
+    magnitude = ( ( value & G711_SIGN_BITMASK ) != 0 ) ? ( 0U - magnitude ) : magnitude;
+
+    return ( int16_t ) magnitude;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint8_t ALawEncodeSample( int16_t pcmSample )
+{
+    int32_t value, sign, magnitude, segment;
+    uint8_t mask;
+
+    /* A-law works on 13-bit magnitude. Negative values are offset by one,
+     * which makes the magnitude the one's complement. */
+    value = ( int32_t ) pcmSample >> 3;
+    sign = value >> 31;
+    magnitude = value ^ sign;
+    mask = ( sign != 0 ) ? G711_ALAW_XOR_MASK : ( G711_SIGN_BITMASK | G711_ALAW_XOR_MASK );
+
+    segment = ( magnitude > 0x1F ) + ( magnitude > 0x3F ) + ( magnitude > 0x7F ) +
+              ( magnitude > 0xFF ) + ( magnitude > 0x1FF ) + ( magnitude > 0x3FF ) +
+              ( magnitude > 0x7FF );
+
+    /* Segment 0 and 1 have the same step size. */
+    return ( uint8_t ) ( ( ( segment << G711_SEGMENT_LOCATION ) |
+                           ( ( magnitude >> ( segment + ( segment == 0 ) ) ) & G711_QUANT_BITMASK ) ) ^ mask );
+}
+
+/*-----------------------------------------------------------*/
+
+static int16_t ALawDecodeSample( uint8_t encodedSample )
+{
+    int32_t value, segment, magnitude;
+
+    value = encodedSample ^ G711_ALAW_XOR_MASK;
+    segment = ( value & G711_SEGMENT_BITMASK ) >> G711_SEGMENT_LOCATION;
+    magnitude = ( ( value & G711_QUANT_BITMASK ) << 4 ) + 8 + ( ( segment != 0 ) ? 0x100 : 0 );
+    magnitude <<= ( segment != 0 ) ? ( segment - 1 ) : 0;
+
+    return ( int16_t ) ( ( ( value & G711_SIGN_BITMASK ) != 0 ) ? magnitude : -magnitude );
+}
+
+/*-----------------------------------------------------------*/
+
+static uint8_t MuLawToALawSample( uint8_t muLawSample )
+{
+    uint8_t magnitude, sign;
+
+    /* Mu-law codes are inverted, so code 0x7F is the lowest negative level. */
+    sign = muLawSample & G711_SIGN_BITMASK;
+    magnitude = ( uint8_t ) ( ( muLawSample ^ 0x7F ) & 0x7F );
+
+    return ( uint8_t ) ( ( muLawToALawTable[ magnitude ] | sign ) ^ G711_ALAW_XOR_MASK );
+}
+
+/*-----------------------------------------------------------*/
+
+static uint8_t ALawToMuLawSample( uint8_t aLawSample )
+{
+    uint8_t magnitude, sign;
+
+    sign = aLawSample & G711_SIGN_BITMASK;
+    magnitude = ( uint8_t ) ( ( aLawSample ^ G711_ALAW_XOR_MASK ) & 0x7F );
+
+    return ( uint8_t ) ( ( aLawToMuLawTable[ magnitude ] ^ 0x7F ) | sign );
+}
+
+/*-----------------------------------------------------------*/
+
+G711Result_t G711Codec_MuLawEncode( const int16_t * pPcmSamples,
+                                    size_t sampleCount,
+                                    uint8_t * pEncodedSamples )
+{
+    G711Result_t result = G711_RESULT_OK;
+    size_t i;
+
+    if( ( pPcmSamples == NULL ) ||
+        ( pEncodedSamples == NULL ) )
+    {
+        result = G711_RESULT_BAD_PARAM;
+    }
+
+    if( result == G711_RESULT_OK )
+    {
+        for( i = 0; i < sampleCount; i++ )
+        {
+            pEncodedSamples[ i ] = MuLawEncodeSample( pPcmSamples[ i ] );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+G711Result_t G711Codec_MuLawDecode( const uint8_t * pEncodedSamples,
+                                    size_t sampleCount,
+                                    int16_t * pPcmSamples )
+{
+    G711Result_t result = G711_RESULT_OK;
+    size_t i;
+
+    if( ( pEncodedSamples == NULL ) ||
+        ( pPcmSamples == NULL ) )
+    {
+        result = G711_RESULT_BAD_PARAM;
+    }
+
+    if( result == G711_RESULT_OK )
+    {
+        for( i = 0; i < sampleCount; i++ )
+        {
+            pPcmSamples[ i ] = MuLawDecodeSample( pEncodedSamples[ i ] );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+G711Result_t G711Codec_ALawEncode( const int16_t * pPcmSamples,
+                                   size_t sampleCount,
+                                   uint8_t * pEncodedSamples )
+{
+    G711Result_t result = G711_RESULT_OK;
+    size_t i;
+
+    if( ( pPcmSamples == NULL ) ||
+        ( pEncodedSamples == NULL ) )
+    {
+        result = G711_RESULT_BAD_PARAM;
+    }
+
+    if( result == G711_RESULT_OK )
+    {
+        for( i = 0; i < sampleCount; i++ )
+        {
+            pEncodedSamples[ i ] = ALawEncodeSample( pPcmSamples[ i ] );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+G711Result_t G711Codec_ALawDecode( const uint8_t * pEncodedSamples,
+                                   size_t sampleCount,
+                                   int16_t * pPcmSamples )
+{
+    G711Result_t result = G711_RESULT_OK;
+    size_t i;
+
+    if( ( pEncodedSamples == NULL ) ||
+        ( pPcmSamples == NULL ) )
+    {
+        result = G711_RESULT_BAD_PARAM;
+    }
+
+    if( result == G711_RESULT_OK )
+    {
+        for( i = 0; i < sampleCount; i++ )
+        {
+            pPcmSamples[ i ] = ALawDecodeSample( pEncodedSamples[ i ] );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+G711Result_t G711Codec_MuLawToALaw( const uint8_t * pMuLawSamples,
+                                    size_t sampleCount,
+                                    uint8_t * pALawSamples )
+{
+    G711Result_t result = G711_RESULT_OK;
+    size_t i;
+
+    if( ( pMuLawSamples == NULL ) ||
+        ( pALawSamples == NULL ) )
+    {
+        result = G711_RESULT_BAD_PARAM;
+    }
+
+    if( result == G711_RESULT_OK )
+    {
+        for( i = 0; i < sampleCount; i++ )
+        {
+            pALawSamples[ i ] = MuLawToALawSample( pMuLawSamples[ i ] );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+G711Result_t G711Codec_ALawToMuLaw( const uint8_t * pALawSamples,
+                                    size_t sampleCount,
+                                    uint8_t * pMuLawSamples )
+{
+    G711Result_t result = G711_RESULT_OK;
+    size_t i;
+
+    if( ( pALawSamples == NULL ) ||
+        ( pMuLawSamples == NULL ) )
+    {
+        result = G711_RESULT_BAD_PARAM;
+    }
+
+    if( result == G711_RESULT_OK )
+    {
+        for( i = 0; i < sampleCount; i++ )
+        {
+            pMuLawSamples[ i ] = ALawToMuLawSample( pALawSamples[ i ] );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -1,27 +1,48 @@
-/* Standard includes. */
-#include <string.h>
-
 /* API includes. */
 #include "g711_depacketizer.h"
 
+static G711Result_t ToG711Result( CodecResult_t result );
+
+/*-----------------------------------------------------------*/
+
+/* In the order of CodecResult_t, for the results returned by the simple
+ * payload assembler. */
+static const uint32_t resultMap[] =
+{
+    G711_RESULT_OK,
+    G711_RESULT_BAD_PARAM,
+    G711_RESULT_OUT_OF_MEMORY,
+    G711_RESULT_NO_MORE_PACKETS
+};
+
+/*-----------------------------------------------------------*/
+
+static G711Result_t ToG711Result( CodecResult_t result )
+{
+    return ( G711Result_t ) SimplePayloadAssembler_MapResult( result,
+                                                              &( resultMap[ 0 ] ),
+                                                              sizeof( resultMap ) / sizeof( resultMap[ 0 ] ),
+                                                              G711_RESULT_BAD_PARAM );
+}
+
+/*-----------------------------------------------------------*/
+
 G711Result_t G711Depacketizer_Init( G711DepacketizerContext_t * pCtx,
                                     G711Packet_t * pPacketsArray,
                                     size_t packetsArrayLength )
 {
     G711Result_t result = G711_RESULT_OK;
 
-    if( ( pCtx == NULL ) ||
-        ( pPacketsArray == NULL ) ||
-        ( packetsArrayLength == 0 ) )
+    if( pCtx == NULL )
     {
         result = G711_RESULT_BAD_PARAM;
     }
 
     if( result == G711_RESULT_OK )
     {
-        pCtx->pPacketsArray = pPacketsArray;
-        pCtx->packetsArrayLength = packetsArrayLength;
-        pCtx->packetCount = 0;
+        result = ToG711Result( SimplePayloadAssembler_Init( &( pCtx->assembler ),
+                                                            pPacketsArray,
+                                                            packetsArrayLength ) );
     }
 
     return result;
@@ -34,25 +55,15 @@ G711Result_t G711Depacketizer_AddPacket( G711DepacketizerContext_t * pCtx,
 {
     G711Result_t result = G711_RESULT_OK;
 
-    if( ( pCtx == NULL ) ||
-        ( pPacket == NULL ) )
+    if( pCtx == NULL )
     {
         result = G711_RESULT_BAD_PARAM;
     }
 
     if( result == G711_RESULT_OK )
     {
-        if( pCtx->packetCount >= pCtx->packetsArrayLength )
-        {
-            result = G711_RESULT_OUT_OF_MEMORY;
-        }
-    }
-
-    if( result == G711_RESULT_OK )
-    {
-        pCtx->pPacketsArray[ pCtx->packetCount ].pPacketData = pPacket->pPacketData;
-        pCtx->pPacketsArray[ pCtx->packetCount ].packetDataLength = pPacket->packetDataLength;
-        pCtx->packetCount += 1;
+        result = ToG711Result( SimplePayloadAssembler_AddPacket( &( pCtx->assembler ),
+                                                                 pPacket ) );
     }
 
     return result;
@@ -64,38 +75,16 @@ G711Result_t G711Depacketizer_GetFrame( G711DepacketizerContext_t * pCtx,
                                         G711Frame_t * pFrame )
 {
     G711Result_t result = G711_RESULT_OK;
-    G711Packet_t * pPacket;
-    size_t i, currentFrameDataIndex = 0;
 
-    if( ( pCtx == NULL ) ||
-        ( pFrame == NULL ) ||
-        ( pFrame->pFrameData == NULL ) ||
-        ( pFrame->frameDataLength == 0 ) )
+    if( pCtx == NULL )
     {
         result = G711_RESULT_BAD_PARAM;
     }
 
-    for( i = 0; ( result == G711_RESULT_OK ) && ( i < pCtx->packetCount ); i++ )
-    {
-        pPacket = &( pCtx->pPacketsArray[ i ] );
-
-        if( ( pFrame->frameDataLength - currentFrameDataIndex ) >= pPacket->packetDataLength )
-        {
-            memcpy( ( void * ) &( pFrame->pFrameData[ currentFrameDataIndex ] ),
-                    ( const void * ) &( pPacket->pPacketData[ 0 ] ),
-                    pPacket->packetDataLength );
-
-            currentFrameDataIndex += pPacket->packetDataLength;
-        }
-        else
-        {
-            result = G711_RESULT_OUT_OF_MEMORY;
-        }
-    }
-
     if( result == G711_RESULT_OK )
     {
-        pFrame->frameDataLength = currentFrameDataIndex;
+        result = ToG711Result( SimplePayloadAssembler_GetFrame( &( pCtx->assembler ),
+                                                                pFrame ) );
     }
 
     return result;
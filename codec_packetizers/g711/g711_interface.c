@@ -0,0 +1,72 @@
+/* API includes. */
+#include "g711_interface.h"
+#include "codec_interface_adapter.h"
+
+/*-----------------------------------------------------------*/
+
+/* In the order of G711Result_t. */
+static const CodecResult_t resultMap[] =
+{
+    CODEC_RESULT_OK,
+    CODEC_RESULT_BAD_PARAM,
+    CODEC_RESULT_OUT_OF_MEMORY,
+    CODEC_RESULT_NO_MORE_PACKETS
+};
+
+/*-----------------------------------------------------------*/
+
+CODEC_INTERFACE_DEFINE_ADD_FRAME( AddFrame,
+                                  G711PacketizerContext_t,
+                                  G711Frame_t,
+                                  G711Packetizer_AddFrame,
+                                  resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_PACKET( GetPacket,
+                                   G711PacketizerContext_t,
+                                   G711Packet_t,
+                                   G711Packetizer_GetPacket,
+                                   resultMap )
+
+CODEC_INTERFACE_DEFINE_ADD_PACKET( AddPacket,
+                                   G711DepacketizerContext_t,
+                                   G711Packet_t,
+                                   G711Depacketizer_AddPacket,
+                                   resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_FRAME( GetFrame,
+                                  G711DepacketizerContext_t,
+                                  G711Frame_t,
+                                  G711Depacketizer_GetFrame,
+                                  resultMap )
+
+/* Every packet begins a frame. */
+CODEC_INTERFACE_DEFINE_GET_PACKET_PROPERTIES_WITH_FRAME_START( GetPacketProperties,
+                                                               G711Depacketizer_GetPacketProperties,
+                                                               resultMap,
+                                                               0,
+                                                               0 )
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t G711Interface_InitPacketizer( CodecPacketizer_t * pPacketizer,
+                                            G711PacketizerContext_t * pCtx )
+{
+    return CodecInterface_BindPacketizer( pPacketizer,
+                                          ( void * ) pCtx,
+                                          AddFrame,
+                                          GetPacket );
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t G711Interface_InitDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                              G711DepacketizerContext_t * pCtx )
+{
+    return CodecInterface_BindDepacketizer( pDepacketizer,
+                                            ( void * ) pCtx,
+                                            AddPacket,
+                                            GetFrame,
+                                            GetPacketProperties );
+}
+
+/*-----------------------------------------------------------*/
@@ -19,6 +19,89 @@ G711Result_t G711Packetizer_Init( G711PacketizerContext_t * pCtx,
         result = G711_RESULT_BAD_PARAM;
     }
 
+    if( result == G711_RESULT_OK )
+    {
+        pCtx->frame.pFrameData = pFrame->pFrameData;
+        pCtx->frame.frameDataLength = pFrame->frameDataLength;
+        pCtx->curFrameDataIndex = 0;
+        pCtx->samplesPerPacket = 0;
+        pCtx->timestamp = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+G711Result_t G711Packetizer_InitWithPacketTime( G711PacketizerContext_t * pCtx,
+                                                uint32_t sampleRate,
+                                                uint32_t packetTimeMs,
+                                                uint32_t firstTimestamp )
+{
+    G711Result_t result = G711_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( sampleRate == 0 ) ||
+        ( packetTimeMs == 0 ) )
+    {
+        result = G711_RESULT_BAD_PARAM;
+    }
+
+    /* Packet time must be a whole number of samples. */
+    if( result == G711_RESULT_OK )
+    {
+        if( ( ( ( uint64_t ) sampleRate * packetTimeMs ) % 1000 ) != 0 )
+        {
+            result = G711_RESULT_BAD_PARAM;
+        }
+    }
+
+    if( result == G711_RESULT_OK )
+    {
+        pCtx->frame.pFrameData = NULL;
+        pCtx->frame.frameDataLength = 0;
+        pCtx->curFrameDataIndex = 0;
+        pCtx->samplesPerPacket = ( size_t ) ( ( ( uint64_t ) sampleRate * packetTimeMs ) / 1000 );
+        pCtx->timestamp = firstTimestamp;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+G711Result_t G711Packetizer_AddFrame( G711PacketizerContext_t * pCtx,
+                                      G711Frame_t * pFrame )
+{
+    G711Result_t result = G711_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pFrame->pFrameData == NULL ) ||
+        ( pFrame->frameDataLength == 0 ) )
+    {
+        result = G711_RESULT_BAD_PARAM;
+    }
+
+    /* Every packet carries exactly the samples of one packet time. */
+    if( result == G711_RESULT_OK )
+    {
+        if( ( pCtx->samplesPerPacket != 0 ) &&
+            ( ( pFrame->frameDataLength % pCtx->samplesPerPacket ) != 0 ) )
+        {
+            result = G711_RESULT_BAD_PARAM;
+        }
+    }
+
+    /* The packets of the current frame must be retrieved first. */
+    if( result == G711_RESULT_OK )
+    {
+        if( pCtx->curFrameDataIndex != pCtx->frame.frameDataLength )
+        {
+            result = G711_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
     if( result == G711_RESULT_OK )
     {
         pCtx->frame.pFrameData = pFrame->pFrameData;
@@ -33,13 +116,27 @@ G711Result_t G711Packetizer_Init( G711PacketizerContext_t * pCtx,
 
 G711Result_t G711Packetizer_GetPacket( G711PacketizerContext_t * pCtx,
                                        G711Packet_t * pPacket )
+{
+    uint32_t timestamp;
+
+    return G711Packetizer_GetPacketWithTimestamp( pCtx,
+                                                  pPacket,
+                                                  &( timestamp ) );
+}
+
+/*-----------------------------------------------------------*/
+
+G711Result_t G711Packetizer_GetPacketWithTimestamp( G711PacketizerContext_t * pCtx,
+                                                    G711Packet_t * pPacket,
+                                                    uint32_t * pTimestamp )
 {
     G711Result_t result = G711_RESULT_OK;
     size_t frameDataLengthToSend;
 
     if( ( pCtx == NULL ) ||
         ( pPacket == NULL ) ||
-        ( pPacket->packetDataLength == 0 ) )
+        ( pPacket->packetDataLength == 0 ) ||
+        ( pTimestamp == NULL ) )
     {
         result = G711_RESULT_BAD_PARAM;
     }
@@ -54,15 +151,35 @@ G711Result_t G711Packetizer_GetPacket( G711PacketizerContext_t * pCtx,
 
     if( result == G711_RESULT_OK )
     {
-        frameDataLengthToSend = G711_MIN( pPacket->packetDataLength,
-                                          pCtx->frame.frameDataLength - pCtx->curFrameDataIndex );
+        /* G.711 carries one byte per sample. */
+        if( pCtx->samplesPerPacket != 0 )
+        {
+            frameDataLengthToSend = G711_MIN( pCtx->samplesPerPacket,
+                                              pCtx->frame.frameDataLength - pCtx->curFrameDataIndex );
 
+            if( pPacket->packetDataLength < frameDataLengthToSend )
+            {
+                result = G711_RESULT_OUT_OF_MEMORY;
+            }
+        }
+        else
+        {
+            frameDataLengthToSend = G711_MIN( pPacket->packetDataLength,
+                                              pCtx->frame.frameDataLength - pCtx->curFrameDataIndex );
+        }
+    }
+
+    if( result == G711_RESULT_OK )
+    {
         memcpy( ( void * ) &( pPacket->pPacketData[ 0 ] ),
                 ( const void * ) &( pCtx->frame.pFrameData[ pCtx->curFrameDataIndex ] ),
                 frameDataLengthToSend );
 
         pPacket->packetDataLength = frameDataLengthToSend;
         pCtx->curFrameDataIndex += frameDataLengthToSend;
+
+        *pTimestamp = pCtx->timestamp;
+        pCtx->timestamp += ( uint32_t ) frameDataLengthToSend;
     }
 
     return result;
@@ -0,0 +1,40 @@
+#ifndef G711_CODEC_H
+#define G711_CODEC_H
+
+/* Data types includes. */
+#include "g711_data_types.h"
+
+/*
+ * Conversion between G.711 (ITU-T G.711 mu-law and A-law) samples and 16-bit
+ * linear PCM samples. The kernels are branch free so that the compiler can
+ * vectorize the loops for the target (SSE/AVX2/NEON). Input and output buffers
+ * must hold sampleCount samples. Mu-law/A-law conversion uses the direct
+ * conversion tables of G.711 rather than going through linear PCM, and its
+ * input and output buffers can be the same.
+ */
+
+G711Result_t G711Codec_MuLawEncode( const int16_t * pPcmSamples,
+                                    size_t sampleCount,
+                                    uint8_t * pEncodedSamples );
+
+G711Result_t G711Codec_MuLawDecode( const uint8_t * pEncodedSamples,
+                                    size_t sampleCount,
+                                    int16_t * pPcmSamples );
+
+G711Result_t G711Codec_ALawEncode( const int16_t * pPcmSamples,
+                                   size_t sampleCount,
+                                   uint8_t * pEncodedSamples );
+
+G711Result_t G711Codec_ALawDecode( const uint8_t * pEncodedSamples,
+                                   size_t sampleCount,
+                                   int16_t * pPcmSamples );
+
+G711Result_t G711Codec_MuLawToALaw( const uint8_t * pMuLawSamples,
+                                    size_t sampleCount,
+                                    uint8_t * pALawSamples );
+
+G711Result_t G711Codec_ALawToMuLaw( const uint8_t * pALawSamples,
+                                    size_t sampleCount,
+                                    uint8_t * pMuLawSamples );
+
+#endif /* G711_CODEC_H */
@@ -5,9 +5,26 @@
 #include <stdint.h>
 #include <stddef.h>
 
+/* API includes. */
+#include "codec_interface.h"
+
 /* Packet properties, used in G711Depacketizer_GetPacketProperties. */
 #define G711_PACKET_PROPERTY_START_PACKET   ( 1 << 0 )
 
+/* G.711 sample layout - sign, segment and quantization bits. */
+#define G711_SIGN_BITMASK                   0x80
+#define G711_SIGN_LOCATION                  7
+
+#define G711_SEGMENT_BITMASK                0x70
+#define G711_SEGMENT_LOCATION               4
+
+#define G711_QUANT_BITMASK                  0x0F
+#define G711_QUANT_LOCATION                 0
+
+#define G711_MULAW_BIAS                     0x84
+#define G711_MULAW_MAX_MAGNITUDE            0x1FFF  /* 14-bit, after bias. */
+#define G711_ALAW_XOR_MASK                  0x55
+
 /*-----------------------------------------------------------*/
 
 #define G711_MIN( a, b ) ( ( a ) < ( b ) ? ( a ) : ( b ) )
@@ -25,17 +42,10 @@ typedef enum G711Result
 
 /*-----------------------------------------------------------*/
 
-typedef struct G711Packet
-{
-    uint8_t * pPacketData;
-    size_t packetDataLength;
-} G711Packet_t;
-
-typedef struct G711Frame
-{
-    uint8_t * pFrameData;
-    size_t frameDataLength;
-} G711Frame_t;
+/* Same as the common codec types so that packets are stored in the simple
+ * payload assembler directly. */
+typedef CodecPacket_t G711Packet_t;
+typedef CodecFrame_t G711Frame_t;
 
 /*-----------------------------------------------------------*/
 
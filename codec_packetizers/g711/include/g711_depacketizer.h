@@ -3,12 +3,11 @@
 
 /* Data types includes. */
 #include "g711_data_types.h"
+#include "simple_payload_assembler.h"
 
 typedef struct G711DePacketizerContext
 {
-    G711Packet_t * pPacketsArray;
-    size_t packetsArrayLength;
-    size_t packetCount;
+    SimplePayloadAssembler_t assembler;
 } G711DepacketizerContext_t;
 
 G711Result_t G711Depacketizer_Init( G711DepacketizerContext_t * pCtx,
@@ -18,6 +17,9 @@ G711Result_t G711Depacketizer_Init( G711DepacketizerContext_t * pCtx,
 G711Result_t G711Depacketizer_AddPacket( G711DepacketizerContext_t * pCtx,
                                          const G711Packet_t * pPacket );
 
+/* Returns all the packets added so far as one frame and removes them, so that
+ * the packets of the next frame can be added without calling
+ * G711Depacketizer_Init again. */
 G711Result_t G711Depacketizer_GetFrame( G711DepacketizerContext_t * pCtx,
                                         G711Frame_t * pFrame );
 
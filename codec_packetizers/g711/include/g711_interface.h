@@ -0,0 +1,20 @@
+#ifndef G711_INTERFACE_H
+#define G711_INTERFACE_H
+
+/* API includes. */
+#include "codec_interface.h"
+#include "g711_packetizer.h"
+#include "g711_depacketizer.h"
+
+/* Binds a G.711 packetizer context to the common packetizer interface.
+ * pCtx must be initialized with G711Packetizer_InitWithPacketTime.
+ * Frames are added with G711Packetizer_AddFrame. */
+CodecResult_t G711Interface_InitPacketizer( CodecPacketizer_t * pPacketizer,
+                                            G711PacketizerContext_t * pCtx );
+
+/* Binds a G.711 depacketizer context to the common depacketizer interface.
+ * pCtx must be initialized with G711Depacketizer_Init. */
+CodecResult_t G711Interface_InitDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                              G711DepacketizerContext_t * pCtx );
+
+#endif /* G711_INTERFACE_H */
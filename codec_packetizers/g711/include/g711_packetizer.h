@@ -8,12 +8,35 @@ typedef struct G711PacketizerContext
 {
     G711Frame_t frame;
     size_t curFrameDataIndex;
+    size_t samplesPerPacket;
+    uint32_t timestamp;
 } G711PacketizerContext_t;
 
 G711Result_t G711Packetizer_Init( G711PacketizerContext_t * pCtx,
                                   G711Frame_t * pFrame );
 
+/* Packetizes by packet time (e.g. 10, 20 or 30 ms) - each packet carries
+ * sampleRate * packetTimeMs / 1000 samples. Call G711Packetizer_AddFrame for
+ * each frame to send. The RTP timestamp starts at firstTimestamp and advances
+ * by the number of samples in each packet, across frames. */
+G711Result_t G711Packetizer_InitWithPacketTime( G711PacketizerContext_t * pCtx,
+                                                uint32_t sampleRate,
+                                                uint32_t packetTimeMs,
+                                                uint32_t firstTimestamp );
+
+/* When packetizing by packet time, the frame length must be a multiple of the
+ * samples per packet. Returns G711_RESULT_OUT_OF_MEMORY if packets of the
+ * previous frame are still to be retrieved. */
+G711Result_t G711Packetizer_AddFrame( G711PacketizerContext_t * pCtx,
+                                      G711Frame_t * pFrame );
+
 G711Result_t G711Packetizer_GetPacket( G711PacketizerContext_t * pCtx,
                                        G711Packet_t * pPacket );
 
+/* Same as G711Packetizer_GetPacket and also returns the RTP timestamp of the
+ * packet. */
+G711Result_t G711Packetizer_GetPacketWithTimestamp( G711PacketizerContext_t * pCtx,
+                                                    G711Packet_t * pPacket,
+                                                    uint32_t * pTimestamp );
+
 #endif /* G711_PACKETIZER_H */
@@ -4,15 +4,73 @@
 /* API includes. */
 #include "h264_depacketizer.h"
 
+/* Length of the start code added before each NALU of an Annex-B frame. */
+#define ANNEX_B_START_CODE_LENGTH    4
+
+/* Frame boundaries, added using H264Depacketizer_EndFrame, are stored in the
+ * packets array as packets with no data. */
+#define IS_FRAME_BOUNDARY( pCtx, index ) \
+    ( ( pCtx )->pPacketsArray[ ( index ) ].pPacketData == NULL )
+
+static void MoveToNextPacket( H264DepacketizerContext_t * pCtx );
+
+static void DiscardFrame( H264DepacketizerContext_t * pCtx );
+
 static void DepacketizeSingleNaluPacket( H264DepacketizerContext_t * pCtx,
                                          Nalu_t * pNalu );
 
 static H264Result_t DepacketizeFragmentationUnitPacket( H264DepacketizerContext_t * pCtx,
                                                         Nalu_t * pNalu );
 
+static H264Result_t ParseAggregationPacket( H264DepacketizerContext_t * pCtx,
+                                            uint8_t ** ppNaluData,
+                                            size_t * pNaluLength );
+
 static H264Result_t DepacketizeAggregationPacket( H264DepacketizerContext_t * pCtx,
                                                   Nalu_t * pNalu );
 
+static H264Result_t AssembleFrame( H264DepacketizerContext_t * pCtx,
+                                   Frame_t * pFrame,
+                                   size_t naluLengthSize );
+
+static H264Result_t ComputeFrameLength( const H264DepacketizerContext_t * pCtx,
+                                        size_t naluLengthSize,
+                                        size_t * pFrameLength,
+                                        size_t * pMaxNaluLength );
+
+static uint32_t GetNaluTypeProperties( uint8_t naluType,
+                                       uint8_t isNaluStart );
+
+/*-----------------------------------------------------------*/
+
+static void MoveToNextPacket( H264DepacketizerContext_t * pCtx )
+{
+    pCtx->tailIndex = ( pCtx->tailIndex + 1 ) % pCtx->packetsArrayLength;
+    pCtx->packetCount -= 1;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Discard the remaining packets of the current frame, including its boundary,
+ * so that the next frame is read in the next call. */
+static void DiscardFrame( H264DepacketizerContext_t * pCtx )
+{
+    uint8_t isDiscarding = 1;
+
+    pCtx->curPacketIndex = 0;
+
+    while( ( isDiscarding == 1 ) &&
+           ( pCtx->packetCount > 0 ) )
+    {
+        if( IS_FRAME_BOUNDARY( pCtx, pCtx->tailIndex ) )
+        {
+            isDiscarding = 0;
+        }
+
+        MoveToNextPacket( pCtx );
+    }
+}
+
 /*-----------------------------------------------------------*/
 
 static void DepacketizeSingleNaluPacket( H264DepacketizerContext_t * pCtx,
@@ -24,8 +82,7 @@ static void DepacketizeSingleNaluPacket( H264DepacketizerContext_t * pCtx,
     pNalu->naluDataLength = pCtx->pPacketsArray[ pCtx->tailIndex ].packetDataLength;
 
     /* Move to the next packet in the next call to H264Depacketizer_GetNalu. */
-    pCtx->tailIndex += 1;
-    pCtx->packetCount -= 1;
+    MoveToNextPacket( pCtx );
 }
 
 /*-----------------------------------------------------------*/
@@ -35,14 +92,22 @@ static H264Result_t DepacketizeFragmentationUnitPacket( H264DepacketizerContext_
 {
     uint8_t * pCurPacketData;
     uint8_t fuHeader = 0, fuIndicator = 0;
+    uint8_t isFirstFragment = 1, isEndFound = 0, isIncomplete = 0;
+    uint16_t seqNum, expectedSeqNum = 0;
     size_t curPacketLength, curNaluDataIndex = 0;
     H264Result_t result = H264_RESULT_OK;
 
     /* While there are more fragments to process and we have not yet processed
      * the last fragment. */
     while( ( pCtx->packetCount > 0 ) &&
-           ( ( fuHeader & FU_A_HEADER_E_BIT_MASK ) == 0 ) )
+           ( isEndFound == 0 ) )
     {
+        /* Break if the frame ends before the last fragment. */
+        if( IS_FRAME_BOUNDARY( pCtx, pCtx->tailIndex ) )
+        {
+            break;
+        }
+
         pCurPacketData = pCtx->pPacketsArray[ pCtx->tailIndex ].pPacketData;
         curPacketLength = pCtx->pPacketsArray[ pCtx->tailIndex ].packetDataLength;
 
@@ -55,6 +120,37 @@ static H264Result_t DepacketizeFragmentationUnitPacket( H264DepacketizerContext_
             break;
         }
 
+        if( pCtx->pSeqNumArray != NULL )
+        {
+            seqNum = pCtx->pSeqNumArray[ pCtx->tailIndex ];
+
+            if( isFirstFragment != 0 )
+            {
+                /* The NALU is incomplete if its first fragment is lost. Still
+                 * consume the remaining fragments of it. */
+                if( ( fuHeader & FU_A_HEADER_S_BIT_MASK ) == 0 )
+                {
+                    isIncomplete = 1;
+                }
+            }
+            else if( ( seqNum != expectedSeqNum ) ||
+                     ( ( fuHeader & FU_A_HEADER_S_BIT_MASK ) != 0 ) )
+            {
+                /* A fragment is lost - leave the next packet for the next call
+                 * to H264Depacketizer_GetNalu. */
+                break;
+            }
+
+            expectedSeqNum = ( uint16_t ) ( seqNum + 1U );
+        }
+
+        isFirstFragment = 0;
+
+        if( ( fuHeader & FU_A_HEADER_E_BIT_MASK ) != 0 )
+        {
+            isEndFound = 1;
+        }
+
         /* Write NALU header for the first fragment only. */
         if( ( fuHeader & FU_A_HEADER_S_BIT_MASK ) != 0 )
         {
@@ -71,7 +167,7 @@ static H264Result_t DepacketizeFragmentationUnitPacket( H264DepacketizerContext_
         }
 
         /* Write NALU payload. */
-        if( ( curNaluDataIndex + curPacketLength ) <= pNalu->naluDataLength )
+        if( ( curNaluDataIndex + curPacketLength - FU_A_HEADER_SIZE ) <= pNalu->naluDataLength )
         {
             memcpy( ( void * ) &( pNalu->pNaluData[ curNaluDataIndex ] ),
                     ( const void * ) &( pCurPacketData[ FU_A_PAYLOAD_OFFSET ] ),
@@ -84,25 +180,36 @@ static H264Result_t DepacketizeFragmentationUnitPacket( H264DepacketizerContext_
         curNaluDataIndex += ( curPacketLength - FU_A_HEADER_SIZE );
 
         /* Move to the next packet. */
-        pCtx->tailIndex += 1;
-        pCtx->packetCount -= 1;
+        MoveToNextPacket( pCtx );
     }
 
     /* Update NALU Length. */
     pNalu->naluDataLength = curNaluDataIndex;
 
+    if( ( pCtx->pSeqNumArray != NULL ) &&
+        ( ( isIncomplete != 0 ) || ( isEndFound == 0 ) ) )
+    {
+        result = H264_RESULT_INCOMPLETE_NALU;
+    }
+
     return result;
 }
 
 /*-----------------------------------------------------------*/
 
-static H264Result_t DepacketizeAggregationPacket( H264DepacketizerContext_t * pCtx,
-                                                  Nalu_t * pNalu )
+/* Find the next NALU in the current STAP-A packet. *ppNaluData is set to NULL
+ * if the packet has no NALU left. */
+static H264Result_t ParseAggregationPacket( H264DepacketizerContext_t * pCtx,
+                                            uint8_t ** ppNaluData,
+                                            size_t * pNaluLength )
 {
     uint8_t * pCurPacketData;
     size_t curPacketLength, naluLength;
     H264Result_t result = H264_RESULT_OK;
 
+    *ppNaluData = NULL;
+    *pNaluLength = 0;
+
     pCurPacketData = pCtx->pPacketsArray[ pCtx->tailIndex ].pPacketData;
     curPacketLength = pCtx->pPacketsArray[ pCtx->tailIndex ].packetDataLength;
 
@@ -125,41 +232,278 @@ static H264Result_t DepacketizeAggregationPacket( H264DepacketizerContext_t * pC
         /* Is there enough data left in the packet to read the next NALU? */
         if( ( pCtx->curPacketIndex + naluLength ) <= curPacketLength )
         {
-            /* Is there enough space in the output buffer? */
-            if( naluLength <= pNalu->naluDataLength)
+            *ppNaluData = &( pCurPacketData[ pCtx->curPacketIndex ] );
+            *pNaluLength = naluLength;
+        }
+        else
+        {
+            result = H264_RESULT_MALFORMED_PACKET;
+        }
+
+        /* Move to next Nalu in the next call. In case of malformed packet,
+         * this ensures that we move to the next packet below. */
+        pCtx->curPacketIndex += naluLength;
+    }
+
+    /* If we do not have enough data left in this packet, move to the next
+     * packet in the next call. */
+    if( ( pCtx->curPacketIndex + STAP_A_NALU_SIZE ) > curPacketLength )
+    {
+        pCtx->curPacketIndex = 0;
+        MoveToNextPacket( pCtx );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static H264Result_t DepacketizeAggregationPacket( H264DepacketizerContext_t * pCtx,
+                                                  Nalu_t * pNalu )
+{
+    uint8_t * pAggregatedNaluData;
+    size_t naluLength;
+    H264Result_t result;
+
+    result = ParseAggregationPacket( pCtx,
+                                     &( pAggregatedNaluData ),
+                                     &( naluLength ) );
+
+    if( ( result == H264_RESULT_OK ) &&
+        ( pAggregatedNaluData != NULL ) )
+    {
+        /* Is there enough space in the output buffer? */
+        if( naluLength <= pNalu->naluDataLength )
+        {
+            memcpy( ( void * ) &( pNalu->pNaluData[ 0 ] ),
+                    ( const void * ) pAggregatedNaluData,
+                    naluLength );
+        }
+        else
+        {
+            result = H264_RESULT_OUT_OF_MEMORY;
+        }
+
+        /* Update NALU length. */
+        pNalu->naluDataLength = naluLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Write all the NALUs in the frame, each preceded by either a 4 byte start code
+ * (naluLengthSize is 0) or its length in naluLengthSize bytes. */
+static H264Result_t AssembleFrame( H264DepacketizerContext_t * pCtx,
+                                   Frame_t * pFrame,
+                                   size_t naluLengthSize )
+{
+    H264Result_t result = H264_RESULT_OK;
+    Nalu_t nalu;
+    size_t i, prefixLength, currentFrameDataIndex = 0, naluDataIndex = 0, prefixIndex = 0;
+    uint8_t startCode[ ANNEX_B_START_CODE_LENGTH ] = { 0x00, 0x00, 0x00, 0x01 };
+
+    prefixLength = ( naluLengthSize == 0 ) ? sizeof( startCode ) : naluLengthSize;
+
+    if( pCtx->packetCount == 0 )
+    {
+        result = H264_RESULT_NO_MORE_FRAMES;
+    }
+
+    while( ( result == H264_RESULT_OK ) &&
+           ( pCtx->packetCount > 0 ) &&
+           ( !IS_FRAME_BOUNDARY( pCtx, pCtx->tailIndex ) ) )
+    {
+        if( ( pFrame->frameDataLength - currentFrameDataIndex ) > prefixLength )
+        {
+            /* NALU data starts after the prefix. */
+            prefixIndex = currentFrameDataIndex;
+            naluDataIndex = currentFrameDataIndex + prefixLength;
+
+            nalu.pNaluData = &( pFrame->pFrameData[ naluDataIndex ] );
+            nalu.naluDataLength = pFrame->frameDataLength - naluDataIndex;
+
+            result = H264Depacketizer_GetNalu( pCtx,
+                                               &( nalu ) );
+
+            if( result == H264_RESULT_OK )
             {
-                memcpy( ( void * ) &( pNalu->pNaluData[ 0 ] ),
-                        ( const void * ) &( pCurPacketData[ pCtx->curPacketIndex ] ),
-                        naluLength );
+                if( naluLengthSize == 0 )
+                {
+                    memcpy( ( void * ) &( pFrame->pFrameData[ prefixIndex ] ),
+                            ( const void * ) &( startCode[ 0 ] ),
+                            sizeof( startCode ) );
+                }
+                else if( ( naluLengthSize < sizeof( size_t ) ) &&
+                         ( ( nalu.naluDataLength >> ( 8 * naluLengthSize ) ) != 0 ) )
+                {
+                    /* The NALU length does not fit in the prefix. */
+                    result = H264_RESULT_BAD_PARAM;
+                }
+                else
+                {
+                    for( i = 0; i < naluLengthSize; i++ )
+                    {
+                        pFrame->pFrameData[ prefixIndex + i ] = ( uint8_t ) ( nalu.naluDataLength >>
+                                                                              ( 8 * ( naluLengthSize - 1 - i ) ) );
+                    }
+                }
             }
-            else
+
+            if( result == H264_RESULT_OK )
             {
-                result = H264_RESULT_OUT_OF_MEMORY;
+                currentFrameDataIndex += prefixLength;
+                currentFrameDataIndex += nalu.naluDataLength;
             }
+        }
+        else
+        {
+            result = H264_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    pFrame->frameDataLength = currentFrameDataIndex;
 
-            /* Update NALU length. */
-            pNalu->naluDataLength = naluLength;
+    if( result == H264_RESULT_NO_MORE_NALUS )
+    {
+        result = H264_RESULT_OK;
+    }
+
+    /* Consume the boundary of the frame assembled. */
+    if( ( result == H264_RESULT_OK ) &&
+        ( pCtx->packetCount > 0 ) )
+    {
+        MoveToNextPacket( pCtx );
+    }
+
+    /* Do not return the rest of a damaged frame as the next frame. */
+    if( result == H264_RESULT_INCOMPLETE_NALU )
+    {
+        DiscardFrame( pCtx );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Compute the length of the frame assembled by AssembleFrame, and the length
+ * of its largest NALU, without consuming any packet. */
+static H264Result_t ComputeFrameLength( const H264DepacketizerContext_t * pCtx,
+                                        size_t naluLengthSize,
+                                        size_t * pFrameLength,
+                                        size_t * pMaxNaluLength )
+{
+    H264Result_t result = H264_RESULT_OK;
+    const uint8_t * pCurPacketData;
+    size_t i, packetIndex, curPacketLength, curPacketIndex, naluLength, prefixLength, frameLength = 0;
+    size_t fragmentedNaluLength = 0, maxNaluLength = 0;
+    uint8_t packetType, fuHeader, isInFragmentedNalu = 0;
 
-            /* Move to next Nalu in the next call to H264Depacketizer_GetNalu. */
-            pCtx->curPacketIndex += naluLength;
+    prefixLength = ( naluLengthSize == 0 ) ? ANNEX_B_START_CODE_LENGTH : naluLengthSize;
+
+    packetIndex = pCtx->tailIndex;
+    curPacketIndex = pCtx->curPacketIndex;
+
+    for( i = 0; ( i < pCtx->packetCount ) && ( result == H264_RESULT_OK ); i++ )
+    {
+        if( IS_FRAME_BOUNDARY( pCtx, packetIndex ) )
+        {
+            break;
         }
-        else
+
+        pCurPacketData = pCtx->pPacketsArray[ packetIndex ].pPacketData;
+        curPacketLength = pCtx->pPacketsArray[ packetIndex ].packetDataLength;
+        packetType = pCurPacketData[ 0 ] & NALU_HEADER_TYPE_MASK;
+
+        if( packetType != FU_A_PACKET_TYPE )
         {
-            result = H264_RESULT_MALFORMED_PACKET;
+            isInFragmentedNalu = 0;
+        }
+
+        if( ( packetType >= SINGLE_NALU_PACKET_TYPE_START ) &&
+            ( packetType <= SINGLE_NALU_PACKET_TYPE_END ) )
+        {
+            frameLength += prefixLength + curPacketLength;
+            maxNaluLength = H264_MAX( maxNaluLength, curPacketLength );
+        }
+        else if( packetType == STAP_A_PACKET_TYPE )
+        {
+            /* A partially read STAP-A packet continues from curPacketIndex. */
+            if( curPacketIndex == 0 )
+            {
+                curPacketIndex = STAP_A_HEADER_SIZE;
+            }
 
-            /* Still move the curPacketIndex so that we move to the next packet
-             * at the end of this function. */
-            pCtx->curPacketIndex += naluLength;
+            while( ( result == H264_RESULT_OK ) &&
+                   ( ( curPacketIndex + STAP_A_NALU_SIZE ) <= curPacketLength ) )
+            {
+                naluLength = pCurPacketData[ curPacketIndex ];
+                naluLength = ( naluLength << 8 ) |
+                             ( pCurPacketData[ curPacketIndex + 1 ] );
+                curPacketIndex += STAP_A_NALU_SIZE;
+
+                if( ( curPacketIndex + naluLength ) <= curPacketLength )
+                {
+                    frameLength += prefixLength + naluLength;
+                    maxNaluLength = H264_MAX( maxNaluLength, naluLength );
+                    curPacketIndex += naluLength;
+                }
+                else
+                {
+                    result = H264_RESULT_MALFORMED_PACKET;
+                }
+            }
+        }
+        else if( packetType == FU_A_PACKET_TYPE )
+        {
+            if( curPacketLength < FU_A_HEADER_SIZE )
+            {
+                result = H264_RESULT_MALFORMED_PACKET;
+            }
+            else
+            {
+                fuHeader = pCurPacketData[ FU_A_HEADER_OFFSET ];
+
+                /* Consecutive fragments up to the end fragment form one NALU. */
+                if( isInFragmentedNalu == 0 )
+                {
+                    frameLength += prefixLength;
+                    fragmentedNaluLength = 0;
+                    isInFragmentedNalu = 1;
+                }
+
+                /* NALU header is reconstructed from the first fragment. */
+                if( ( fuHeader & FU_A_HEADER_S_BIT_MASK ) != 0 )
+                {
+                    frameLength += 1;
+                    fragmentedNaluLength += 1;
+                }
+
+                frameLength += curPacketLength - FU_A_HEADER_SIZE;
+                fragmentedNaluLength += curPacketLength - FU_A_HEADER_SIZE;
+                maxNaluLength = H264_MAX( maxNaluLength, fragmentedNaluLength );
+
+                if( ( fuHeader & FU_A_HEADER_E_BIT_MASK ) != 0 )
+                {
+                    isInFragmentedNalu = 0;
+                }
+            }
+        }
+        else
+        {
+            result = H264_RESULT_UNSUPPORTED_PACKET;
         }
+
+        curPacketIndex = 0;
+        packetIndex = ( packetIndex + 1 ) % pCtx->packetsArrayLength;
     }
 
-    /* If we do not have enough data left in this packet, move to the next
-     * packet in the next call to H264Depacketizer_GetNalu. */
-    if( ( pCtx->curPacketIndex + STAP_A_NALU_SIZE ) > curPacketLength )
+    if( result == H264_RESULT_OK )
     {
-        pCtx->curPacketIndex = 0;
-        pCtx->tailIndex += 1;
-        pCtx->packetCount -= 1;
+        *pFrameLength = frameLength;
+        *pMaxNaluLength = maxNaluLength;
     }
 
     return result;
@@ -167,6 +511,34 @@ static H264Result_t DepacketizeAggregationPacket( H264DepacketizerContext_t * pC
 
 /*-----------------------------------------------------------*/
 
+static uint32_t GetNaluTypeProperties( uint8_t naluType,
+                                       uint8_t isNaluStart )
+{
+    uint32_t properties = 0;
+
+    if( naluType == NALU_TYPE_SPS )
+    {
+        properties = H264_PACKET_PROPERTY_SPS | H264_PACKET_PROPERTY_KEYFRAME;
+    }
+    else if( naluType == NALU_TYPE_PPS )
+    {
+        properties = H264_PACKET_PROPERTY_PPS;
+    }
+    else if( naluType == NALU_TYPE_IDR )
+    {
+        properties = H264_PACKET_PROPERTY_IDR;
+
+        if( isNaluStart != 0 )
+        {
+            properties |= H264_PACKET_PROPERTY_KEYFRAME;
+        }
+    }
+
+    return properties;
+}
+
+/*-----------------------------------------------------------*/
+
 H264Result_t H264Depacketizer_Init( H264DepacketizerContext_t * pCtx,
                                     H264Packet_t * pPacketsArray,
                                     size_t packetsArrayLength )
@@ -189,6 +561,7 @@ H264Result_t H264Depacketizer_Init( H264DepacketizerContext_t * pCtx,
         pCtx->tailIndex = 0;
         pCtx->packetCount = 0;
         pCtx->curPacketIndex = 0;
+        pCtx->pSeqNumArray = NULL;
     }
 
     return result;
@@ -202,7 +575,9 @@ H264Result_t H264Depacketizer_AddPacket( H264DepacketizerContext_t * pCtx,
     H264Result_t result = H264_RESULT_OK;
 
     if( ( pCtx == NULL ) ||
-        ( pPacket == NULL ) )
+        ( pPacket == NULL ) ||
+        ( pPacket->pPacketData == NULL ) ||
+        ( pPacket->packetDataLength == 0 ) )
     {
         result = H264_RESULT_BAD_PARAM;
     }
@@ -219,7 +594,7 @@ H264Result_t H264Depacketizer_AddPacket( H264DepacketizerContext_t * pCtx,
     {
         pCtx->pPacketsArray[ pCtx->headIndex ].pPacketData = pPacket->pPacketData;
         pCtx->pPacketsArray[ pCtx->headIndex ].packetDataLength = pPacket->packetDataLength;
-        pCtx->headIndex += 1;
+        pCtx->headIndex = ( pCtx->headIndex + 1 ) % pCtx->packetsArrayLength;
         pCtx->packetCount += 1;
     }
 
@@ -228,6 +603,87 @@ H264Result_t H264Depacketizer_AddPacket( H264DepacketizerContext_t * pCtx,
 
 /*-----------------------------------------------------------*/
 
+H264Result_t H264Depacketizer_EndFrame( H264DepacketizerContext_t * pCtx )
+{
+    H264Result_t result = H264_RESULT_OK;
+
+    if( pCtx == NULL )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        if( pCtx->packetCount >= pCtx->packetsArrayLength )
+        {
+            result = H264_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        pCtx->pPacketsArray[ pCtx->headIndex ].pPacketData = NULL;
+        pCtx->pPacketsArray[ pCtx->headIndex ].packetDataLength = 0;
+        pCtx->headIndex = ( pCtx->headIndex + 1 ) % pCtx->packetsArrayLength;
+        pCtx->packetCount += 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H264Result_t H264Depacketizer_SetSeqNumArray( H264DepacketizerContext_t * pCtx,
+                                              uint16_t * pSeqNumArray )
+{
+    H264Result_t result = H264_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pSeqNumArray == NULL ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        pCtx->pSeqNumArray = pSeqNumArray;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H264Result_t H264Depacketizer_AddPacketWithSeqNum( H264DepacketizerContext_t * pCtx,
+                                                   const H264Packet_t * pPacket,
+                                                   uint16_t seqNum )
+{
+    H264Result_t result = H264_RESULT_OK;
+    size_t packetIndex = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pCtx->pSeqNumArray == NULL ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        packetIndex = pCtx->headIndex;
+        result = H264Depacketizer_AddPacket( pCtx,
+                                             pPacket );
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        pCtx->pSeqNumArray[ packetIndex ] = seqNum;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
 H264Result_t H264Depacketizer_GetNalu( H264DepacketizerContext_t * pCtx,
                                        Nalu_t * pNalu )
 {
@@ -242,6 +698,13 @@ H264Result_t H264Depacketizer_GetNalu( H264DepacketizerContext_t * pCtx,
 
     if( result == H264_RESULT_OK )
     {
+        /* Frame boundaries do not matter when reading NALUs one by one. */
+        while( ( pCtx->packetCount > 0 ) &&
+               ( IS_FRAME_BOUNDARY( pCtx, pCtx->tailIndex ) ) )
+        {
+            MoveToNextPacket( pCtx );
+        }
+
         if( pCtx->packetCount == 0 )
         {
             result = H264_RESULT_NO_MORE_NALUS;
@@ -284,9 +747,6 @@ H264Result_t H264Depacketizer_GetFrame( H264DepacketizerContext_t * pCtx,
                                         Frame_t * pFrame )
 {
     H264Result_t result = H264_RESULT_OK;
-    Nalu_t nalu;
-    size_t currentFrameDataIndex = 0, naluDataIndex = 0, startCodeIndex = 0;
-    uint8_t startCode[] = { 0x00, 0x00, 0x00, 0x01 };
 
     if( ( pCtx == NULL ) ||
         ( pFrame == NULL ) ||
@@ -298,47 +758,224 @@ H264Result_t H264Depacketizer_GetFrame( H264DepacketizerContext_t * pCtx,
 
     if( result == H264_RESULT_OK )
     {
+        result = AssembleFrame( pCtx,
+                                pFrame,
+                                0 );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H264Result_t H264Depacketizer_GetLengthPrefixedFrame( H264DepacketizerContext_t * pCtx,
+                                                      Frame_t * pFrame,
+                                                      size_t naluLengthSize )
+{
+    H264Result_t result = H264_RESULT_OK;
+    size_t frameLength, maxNaluLength;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pFrame->pFrameData == NULL ) ||
+        ( pFrame->frameDataLength == 0 ) ||
+        ( !IS_VALID_NALU_LENGTH_SIZE( naluLengthSize ) ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    /* Check that the NALU lengths fit in the prefix before consuming any
+     * packet so that the caller can retry with a larger naluLengthSize. */
+    if( ( result == H264_RESULT_OK ) &&
+        ( naluLengthSize < sizeof( size_t ) ) &&
+        ( ComputeFrameLength( pCtx,
+                              naluLengthSize,
+                              &( frameLength ),
+                              &( maxNaluLength ) ) == H264_RESULT_OK ) &&
+        ( ( maxNaluLength >> ( 8 * naluLengthSize ) ) != 0 ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        result = AssembleFrame( pCtx,
+                                pFrame,
+                                naluLengthSize );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H264Result_t H264Depacketizer_GetFrameLength( const H264DepacketizerContext_t * pCtx,
+                                              size_t * pFrameLength )
+{
+    H264Result_t result = H264_RESULT_OK;
+    size_t maxNaluLength;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrameLength == NULL ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        result = ComputeFrameLength( pCtx,
+                                     0,
+                                     pFrameLength,
+                                     &( maxNaluLength ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H264Result_t H264Depacketizer_GetLengthPrefixedFrameLength( const H264DepacketizerContext_t * pCtx,
+                                                            size_t naluLengthSize,
+                                                            size_t * pFrameLength )
+{
+    H264Result_t result = H264_RESULT_OK;
+    size_t maxNaluLength;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrameLength == NULL ) ||
+        ( !IS_VALID_NALU_LENGTH_SIZE( naluLengthSize ) ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        result = ComputeFrameLength( pCtx,
+                                     naluLengthSize,
+                                     pFrameLength,
+                                     &( maxNaluLength ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H264Result_t H264Depacketizer_GetFrameNalus( H264DepacketizerContext_t * pCtx,
+                                             Nalu_t * pNalusArray,
+                                             size_t * pNalusCount,
+                                             uint8_t * pScratchBuffer,
+                                             size_t scratchBufferLength )
+{
+    H264Result_t result = H264_RESULT_OK;
+    H264Packet_t * pCurPacket;
+    uint8_t packetType, * pAggregatedNaluData;
+    size_t naluLength, nalusArrayLength = 0, naluIndex = 0, scratchBufferIndex = 0;
+    Nalu_t nalu;
+
+    if( ( pCtx == NULL ) ||
+        ( pNalusArray == NULL ) ||
+        ( pNalusCount == NULL ) ||
+        ( *pNalusCount == 0 ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        nalusArrayLength = *pNalusCount;
+
         if( pCtx->packetCount == 0 )
         {
             result = H264_RESULT_NO_MORE_FRAMES;
         }
     }
 
-    while( result == H264_RESULT_OK )
+    while( ( result == H264_RESULT_OK ) &&
+           ( pCtx->packetCount > 0 ) &&
+           ( !IS_FRAME_BOUNDARY( pCtx, pCtx->tailIndex ) ) )
     {
-        if( ( pFrame->frameDataLength - currentFrameDataIndex ) > sizeof( startCode ) )
+        if( naluIndex >= nalusArrayLength )
         {
-            /* NALU data starts after the start code. */
-            startCodeIndex = currentFrameDataIndex;
-            naluDataIndex = currentFrameDataIndex + sizeof( startCode );
+            result = H264_RESULT_OUT_OF_MEMORY;
+            break;
+        }
 
-            nalu.pNaluData = &( pFrame->pFrameData[ naluDataIndex ] );
-            nalu.naluDataLength = pFrame->frameDataLength - naluDataIndex;
+        pCurPacket = &( pCtx->pPacketsArray[ pCtx->tailIndex ] );
+        packetType = pCurPacket->pPacketData[ 0 ] & NALU_HEADER_TYPE_MASK;
 
-            result = H264Depacketizer_GetNalu( pCtx,
-                                               &( nalu ) );
+        if( ( packetType >= SINGLE_NALU_PACKET_TYPE_START ) &&
+            ( packetType <= SINGLE_NALU_PACKET_TYPE_END ) )
+        {
+            /* Refer to the packet payload directly. */
+            pNalusArray[ naluIndex ].pNaluData = pCurPacket->pPacketData;
+            pNalusArray[ naluIndex ].naluDataLength = pCurPacket->packetDataLength;
+            naluIndex += 1;
+
+            MoveToNextPacket( pCtx );
+        }
+        else if( packetType == STAP_A_PACKET_TYPE )
+        {
+            /* Refer to the aggregated NALU inside the packet directly. */
+            result = ParseAggregationPacket( pCtx,
+                                             &( pAggregatedNaluData ),
+                                             &( naluLength ) );
+
+            if( ( result == H264_RESULT_OK ) &&
+                ( pAggregatedNaluData != NULL ) )
+            {
+                pNalusArray[ naluIndex ].pNaluData = pAggregatedNaluData;
+                pNalusArray[ naluIndex ].naluDataLength = naluLength;
+                naluIndex += 1;
+            }
+        }
+        else if( packetType == FU_A_PACKET_TYPE )
+        {
+            /* Fragments need to be joined - copy them to the scratch buffer. */
+            if( pScratchBuffer == NULL )
+            {
+                result = H264_RESULT_OUT_OF_MEMORY;
+            }
+            else
+            {
+                nalu.pNaluData = &( pScratchBuffer[ scratchBufferIndex ] );
+                nalu.naluDataLength = scratchBufferLength - scratchBufferIndex;
+
+                result = DepacketizeFragmentationUnitPacket( pCtx,
+                                                             &( nalu ) );
+            }
 
             if( result == H264_RESULT_OK )
             {
-                memcpy( ( void * ) &( pFrame->pFrameData[ startCodeIndex ] ),
-                        ( const void * ) &( startCode[ 0 ] ),
-                        sizeof( startCode ) );
+                pNalusArray[ naluIndex ].pNaluData = nalu.pNaluData;
+                pNalusArray[ naluIndex ].naluDataLength = nalu.naluDataLength;
+                naluIndex += 1;
 
-                currentFrameDataIndex += sizeof( startCode );
-                currentFrameDataIndex += nalu.naluDataLength;
+                scratchBufferIndex += nalu.naluDataLength;
             }
         }
         else
         {
-            result = H264_RESULT_OUT_OF_MEMORY;
+            result = H264_RESULT_UNSUPPORTED_PACKET;
         }
     }
 
-    pFrame->frameDataLength = currentFrameDataIndex;
+    /* Consume the boundary of the frame returned. */
+    if( ( result == H264_RESULT_OK ) &&
+        ( pCtx->packetCount > 0 ) )
+    {
+        MoveToNextPacket( pCtx );
+    }
 
-    if( result == H264_RESULT_NO_MORE_NALUS )
+    /* Do not return the rest of a damaged frame as the next frame. */
+    if( result == H264_RESULT_INCOMPLETE_NALU )
     {
-        result = H264_RESULT_OK;
+        DiscardFrame( pCtx );
+    }
+
+    if( pNalusCount != NULL )
+    {
+        *pNalusCount = naluIndex;
     }
 
     return result;
@@ -352,10 +989,11 @@ H264Result_t H264Depacketizer_GetPacketProperties( const uint8_t * pPacketData,
 {
     H264Result_t result = H264_RESULT_OK;
     uint8_t packetType, fuHeader;
+    size_t currentOffset, naluSize;
 
-    ( void ) packetDataLength;
-
-    if( pProperties == NULL )
+    if( ( pPacketData == NULL ) ||
+        ( packetDataLength == 0 ) ||
+        ( pProperties == NULL ) )
     {
         result = H264_RESULT_BAD_PARAM;
     }
@@ -368,25 +1006,66 @@ H264Result_t H264Depacketizer_GetPacketProperties( const uint8_t * pPacketData,
             ( packetType <= SINGLE_NALU_PACKET_TYPE_END ) )
         {
             *pProperties = H264_PACKET_PROPERTY_START_PACKET;
+            *pProperties |= GetNaluTypeProperties( packetType,
+                                                   1 );
         }
         else if( packetType == FU_A_PACKET_TYPE )
         {
-            *pProperties = 0;
-            fuHeader = pPacketData[ FU_A_HEADER_OFFSET ];
-
-            if( ( fuHeader & FU_A_HEADER_S_BIT_MASK ) != 0 )
+            if( packetDataLength < FU_A_HEADER_SIZE )
             {
-                *pProperties |= H264_PACKET_PROPERTY_START_PACKET;
+                result = H264_RESULT_MALFORMED_PACKET;
             }
-
-            if( ( fuHeader & FU_A_HEADER_E_BIT_MASK ) != 0 )
+            else
             {
-                *pProperties |= H264_PACKET_PROPERTY_END_PACKET;
+                *pProperties = 0;
+                fuHeader = pPacketData[ FU_A_HEADER_OFFSET ];
+
+                if( ( fuHeader & FU_A_HEADER_S_BIT_MASK ) != 0 )
+                {
+                    *pProperties |= H264_PACKET_PROPERTY_START_PACKET;
+                }
+
+                if( ( fuHeader & FU_A_HEADER_E_BIT_MASK ) != 0 )
+                {
+                    *pProperties |= H264_PACKET_PROPERTY_END_PACKET;
+                }
+
+                *pProperties |= GetNaluTypeProperties( fuHeader & FU_A_HEADER_TYPE_MASK,
+                                                       ( ( fuHeader & FU_A_HEADER_S_BIT_MASK ) != 0 ) ? 1 : 0 );
             }
         }
         else if( packetType == STAP_A_PACKET_TYPE )
         {
             *pProperties = H264_PACKET_PROPERTY_START_PACKET;
+            currentOffset = STAP_A_HEADER_SIZE;
+
+            /* Walk the aggregated NALU headers without copying. */
+            while( ( result == H264_RESULT_OK ) &&
+                   ( currentOffset < packetDataLength ) )
+            {
+                if( ( currentOffset + STAP_A_NALU_SIZE ) >= packetDataLength )
+                {
+                    result = H264_RESULT_MALFORMED_PACKET;
+                }
+                else
+                {
+                    naluSize = ( ( size_t ) pPacketData[ currentOffset ] << 8 ) |
+                               ( size_t ) pPacketData[ currentOffset + 1 ];
+                    currentOffset += STAP_A_NALU_SIZE;
+
+                    if( ( naluSize == 0 ) ||
+                        ( naluSize > ( packetDataLength - currentOffset ) ) )
+                    {
+                        result = H264_RESULT_MALFORMED_PACKET;
+                    }
+                    else
+                    {
+                        *pProperties |= GetNaluTypeProperties( pPacketData[ currentOffset ] & NALU_HEADER_TYPE_MASK,
+                                                               1 );
+                        currentOffset += naluSize;
+                    }
+                }
+            }
         }
         else
         {
@@ -0,0 +1,74 @@
+/* API includes. */
+#include "h264_interface.h"
+#include "codec_interface_adapter.h"
+
+/*-----------------------------------------------------------*/
+
+/* In the order of H264Result_t. */
+static const CodecResult_t resultMap[] =
+{
+    CODEC_RESULT_OK,
+    CODEC_RESULT_BAD_PARAM,
+    CODEC_RESULT_OUT_OF_MEMORY,
+    CODEC_RESULT_NO_MORE_PACKETS,
+    CODEC_RESULT_NO_MORE_FRAMES,
+    CODEC_RESULT_NO_MORE_FRAMES,
+    CODEC_RESULT_MALFORMED_PACKET,
+    CODEC_RESULT_UNSUPPORTED_PACKET,
+    CODEC_RESULT_INCOMPLETE_FRAME
+};
+
+/*-----------------------------------------------------------*/
+
+CODEC_INTERFACE_DEFINE_ADD_FRAME( AddFrame,
+                                  H264PacketizerContext_t,
+                                  Frame_t,
+                                  H264Packetizer_AddFrame,
+                                  resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_PACKET( GetPacket,
+                                   H264PacketizerContext_t,
+                                   H264Packet_t,
+                                   H264Packetizer_GetPacket,
+                                   resultMap )
+
+CODEC_INTERFACE_DEFINE_ADD_PACKET( AddPacket,
+                                   H264DepacketizerContext_t,
+                                   H264Packet_t,
+                                   H264Depacketizer_AddPacket,
+                                   resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_FRAME( GetFrame,
+                                  H264DepacketizerContext_t,
+                                  Frame_t,
+                                  H264Depacketizer_GetFrame,
+                                  resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_PACKET_PROPERTIES( GetPacketProperties,
+                                              H264Depacketizer_GetPacketProperties,
+                                              resultMap )
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t H264Interface_InitPacketizer( CodecPacketizer_t * pPacketizer,
+                                            H264PacketizerContext_t * pCtx )
+{
+    return CodecInterface_BindPacketizer( pPacketizer,
+                                          ( void * ) pCtx,
+                                          AddFrame,
+                                          GetPacket );
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t H264Interface_InitDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                              H264DepacketizerContext_t * pCtx )
+{
+    return CodecInterface_BindDepacketizer( pDepacketizer,
+                                            ( void * ) pCtx,
+                                            AddPacket,
+                                            GetFrame,
+                                            GetPacketProperties );
+}
+
+/*-----------------------------------------------------------*/
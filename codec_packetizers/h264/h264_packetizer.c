@@ -4,6 +4,26 @@
 /* API includes. */
 #include "h264_packetizer.h"
 
+/* Parameter sets added right before the current NALU. */
+#define PARAMETER_SET_SPS_ADDED     ( 1 << 0 )
+#define PARAMETER_SET_PPS_ADDED     ( 1 << 1 )
+
+/* The first bit after the NALU header of a slice is set when
+ * first_mb_in_slice is 0 i.e. the slice is the first one of a picture. */
+#define SLICE_FIRST_MB_ZERO_MASK    0x80
+
+/* NALU types 1 to 5 carry slice data. */
+#define IS_SLICE_NALU_TYPE( naluType ) \
+    ( ( ( naluType ) >= SINGLE_NALU_PACKET_TYPE_START ) && ( ( naluType ) <= NALU_TYPE_IDR ) )
+
+/* Parameter set of an injected STAP-A being sent as a separate NALU. */
+#define INJECTED_NALU_NONE          0
+#define INJECTED_NALU_SPS           1
+#define INJECTED_NALU_PPS           2
+
+/* Offset of the SPS in the parameter set cache. */
+#define CACHE_SPS_INDEX             ( STAP_A_HEADER_SIZE + STAP_A_NALU_SIZE )
+
 /*-----------------------------------------------------------*/
 
 static void PacketizeSingleNaluPacket( H264PacketizerContext_t * pCtx,
@@ -12,6 +32,23 @@ static void PacketizeSingleNaluPacket( H264PacketizerContext_t * pCtx,
 static void PacketizeFragmentationUnitPacket( H264PacketizerContext_t * pCtx,
                                               H264Packet_t * pPacket );
 
+static void MoveToNextNalu( H264PacketizerContext_t * pCtx );
+
+static H264Result_t AppendToCarryBuffer( H264PacketizerContext_t * pCtx,
+                                         const uint8_t * pData,
+                                         size_t dataLength );
+
+static H264Result_t CompleteCarriedNalu( H264PacketizerContext_t * pCtx,
+                                         uint8_t * pChunkData,
+                                         size_t chunkNaluEndIndex,
+                                         size_t startCodeZeroCount );
+
+static void CacheParameterSet( H264PacketizerContext_t * pCtx,
+                               const Nalu_t * pNalu,
+                               uint8_t naluType );
+
+static void ApplyStagedParameterSets( H264PacketizerContext_t * pCtx );
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -39,8 +76,7 @@ static void PacketizeSingleNaluPacket( H264PacketizerContext_t * pCtx,
     pPacket->packetDataLength = pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength;
 
     /* Move to the next NALU in the next call to H264Packetizer_GetPacket. */
-    pCtx->tailIndex += 1;
-    pCtx->naluCount -= 1;
+    MoveToNextNalu( pCtx );
 }
 
 /*-----------------------------------------------------------*/
@@ -105,13 +141,252 @@ static void PacketizeFragmentationUnitPacket( H264PacketizerContext_t * pCtx,
         pCtx->currentlyProcessingPacket = H264_PACKET_NONE;
 
         /* Move to the next NALU in the next call to H264Packetizer_GetPacket. */
-        pCtx->tailIndex += 1;
+        MoveToNextNalu( pCtx );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void MoveToNextNalu( H264PacketizerContext_t * pCtx )
+{
+    ParameterSetCache_t * pCache = &( pCtx->parameterSetCache );
+    Nalu_t * pNalu = &( pCtx->pNaluArray[ pCtx->tailIndex ] );
+
+    if( pCache->injectedNalu == INJECTED_NALU_SPS )
+    {
+        /* The SPS of an injected STAP-A is sent - send its PPS next. */
+        pNalu->pNaluData = &( pCache->pCacheBuffer[ CACHE_SPS_INDEX + pCache->spsLength + STAP_A_NALU_SIZE ] );
+        pNalu->naluDataLength = pCache->ppsLength;
+        pCache->injectedNalu = INJECTED_NALU_PPS;
+    }
+    else
+    {
+        if( ( pCache->injectedNalu == INJECTED_NALU_PPS ) ||
+            ( ( pCache->pendingStapACount > 0 ) &&
+              ( pNalu->pNaluData == pCache->pCacheBuffer ) ) )
+        {
+            pCache->injectedNalu = INJECTED_NALU_NONE;
+            pCache->pendingStapACount -= 1;
+
+            if( pCache->pendingStapACount == 0 )
+            {
+                ApplyStagedParameterSets( pCtx );
+            }
+        }
+
+        pCtx->tailIndex = ( pCtx->tailIndex + 1 ) % pCtx->naluArrayLength;
         pCtx->naluCount -= 1;
     }
 }
 
 /*-----------------------------------------------------------*/
 
+static H264Result_t AppendToCarryBuffer( H264PacketizerContext_t * pCtx,
+                                         const uint8_t * pData,
+                                         size_t dataLength )
+{
+    H264Result_t result = H264_RESULT_OK;
+    FrameChunkState_t * pState = &( pCtx->frameChunkState );
+
+    if( pState->naluInCarryBuffer == 0 )
+    {
+        /* Carried NALUs are referenced by the NALU array until packetized.
+         * Once all of them are sent, reuse the carry buffer from the start. */
+        if( ( pCtx->naluCount == 0 ) &&
+            ( pCtx->currentlyProcessingPacket == H264_PACKET_NONE ) )
+        {
+            pState->carryNaluStartIndex = 0;
+        }
+
+        pState->carryNaluLength = 0;
+        pState->naluInCarryBuffer = 1;
+
+        /* Move the part of the NALU from the previous chunk first. */
+        if( pState->pendingNaluLength > 0 )
+        {
+            result = AppendToCarryBuffer( pCtx,
+                                          pState->pPendingNaluData,
+                                          pState->pendingNaluLength );
+        }
+
+        pState->pPendingNaluData = NULL;
+        pState->pendingNaluLength = 0;
+    }
+
+    if( ( result == H264_RESULT_OK ) &&
+        ( dataLength > 0 ) )
+    {
+        if( ( pState->pCarryBuffer != NULL ) &&
+            ( ( pState->carryNaluStartIndex + pState->carryNaluLength + dataLength ) <= pState->carryBufferLength ) )
+        {
+            memcpy( ( void * ) &( pState->pCarryBuffer[ pState->carryNaluStartIndex + pState->carryNaluLength ] ),
+                    ( const void * ) &( pData[ 0 ] ),
+                    dataLength );
+            pState->carryNaluLength += dataLength;
+        }
+        else
+        {
+            result = H264_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Complete a NALU which started in one of the previous chunks. The first
+ * chunkNaluEndIndex bytes of the current chunk belong to the NALU, followed by
+ * startCodeZeroCount zero bytes of the next start code - some of which may
+ * have been in the previous chunks. */
+static H264Result_t CompleteCarriedNalu( H264PacketizerContext_t * pCtx,
+                                         uint8_t * pChunkData,
+                                         size_t chunkNaluEndIndex,
+                                         size_t startCodeZeroCount )
+{
+    H264Result_t result = H264_RESULT_OK;
+    FrameChunkState_t * pState = &( pCtx->frameChunkState );
+    size_t chunkNaluLength = 0, trimLength = 0;
+    Nalu_t nalu;
+
+    if( chunkNaluEndIndex > startCodeZeroCount )
+    {
+        chunkNaluLength = chunkNaluEndIndex - startCodeZeroCount;
+    }
+    else
+    {
+        trimLength = startCodeZeroCount - chunkNaluEndIndex;
+    }
+
+    if( chunkNaluLength > 0 )
+    {
+        /* The NALU straddles chunks - join it in the carry buffer. */
+        result = AppendToCarryBuffer( pCtx,
+                                      pChunkData,
+                                      chunkNaluLength );
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        if( pState->naluInCarryBuffer != 0 )
+        {
+            nalu.pNaluData = &( pState->pCarryBuffer[ pState->carryNaluStartIndex ] );
+            nalu.naluDataLength = pState->carryNaluLength - trimLength;
+
+            pState->carryNaluStartIndex += nalu.naluDataLength;
+            pState->carryNaluLength = 0;
+            pState->naluInCarryBuffer = 0;
+        }
+        else
+        {
+            /* The NALU lies completely within the previous chunk. */
+            nalu.pNaluData = pState->pPendingNaluData;
+            nalu.naluDataLength = pState->pendingNaluLength - trimLength;
+        }
+
+        pState->pPendingNaluData = NULL;
+        pState->pendingNaluLength = 0;
+
+        if( nalu.naluDataLength > 0 )
+        {
+            result = H264Packetizer_AddNalu( pCtx,
+                                             &( nalu ) );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void CacheParameterSet( H264PacketizerContext_t * pCtx,
+                               const Nalu_t * pNalu,
+                               uint8_t naluType )
+{
+    ParameterSetCache_t * pCache = &( pCtx->parameterSetCache );
+    uint8_t * pCacheBuffer = pCache->pCacheBuffer;
+    size_t spsLength, ppsLength, spsIndex, ppsIndex;
+    uint8_t nri = 0;
+
+    spsLength = ( naluType == NALU_TYPE_SPS ) ? pNalu->naluDataLength : pCache->spsLength;
+    ppsLength = ( naluType == NALU_TYPE_PPS ) ? pNalu->naluDataLength : pCache->ppsLength;
+
+    /* Keep the cache unchanged if the new parameter set does not fit. */
+    if( ( pCacheBuffer != NULL ) &&
+        ( ( STAP_A_HEADER_SIZE + ( 2 * STAP_A_NALU_SIZE ) + spsLength + ppsLength ) <= pCache->cacheBufferLength ) )
+    {
+        spsIndex = CACHE_SPS_INDEX;
+        ppsIndex = spsIndex + spsLength + STAP_A_NALU_SIZE;
+
+        if( naluType == NALU_TYPE_SPS )
+        {
+            /* Move the cached PPS, along with its size, as per the new SPS size. */
+            if( pCache->ppsLength > 0 )
+            {
+                memmove( ( void * ) &( pCacheBuffer[ ppsIndex - STAP_A_NALU_SIZE ] ),
+                         ( const void * ) &( pCacheBuffer[ spsIndex + pCache->spsLength ] ),
+                         STAP_A_NALU_SIZE + pCache->ppsLength );
+            }
+
+            memcpy( ( void * ) &( pCacheBuffer[ spsIndex ] ),
+                    ( const void * ) &( pNalu->pNaluData[ 0 ] ),
+                    spsLength );
+            pCacheBuffer[ spsIndex - 2 ] = ( uint8_t ) ( spsLength >> 8 );
+            pCacheBuffer[ spsIndex - 1 ] = ( uint8_t ) ( spsLength & 0xFF );
+        }
+        else
+        {
+            memcpy( ( void * ) &( pCacheBuffer[ ppsIndex ] ),
+                    ( const void * ) &( pNalu->pNaluData[ 0 ] ),
+                    ppsLength );
+            pCacheBuffer[ ppsIndex - 2 ] = ( uint8_t ) ( ppsLength >> 8 );
+            pCacheBuffer[ ppsIndex - 1 ] = ( uint8_t ) ( ppsLength & 0xFF );
+        }
+
+        pCache->spsLength = spsLength;
+        pCache->ppsLength = ppsLength;
+
+        /* NRI of the STAP-A is the maximum NRI of the aggregated NALUs. */
+        if( spsLength > 0 )
+        {
+            nri = H264_MAX( nri, pCacheBuffer[ spsIndex ] & NALU_HEADER_NRI_MASK );
+        }
+
+        if( ppsLength > 0 )
+        {
+            nri = H264_MAX( nri, pCacheBuffer[ ppsIndex ] & NALU_HEADER_NRI_MASK );
+        }
+
+        pCacheBuffer[ 0 ] = STAP_A_PACKET_TYPE | nri;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void ApplyStagedParameterSets( H264PacketizerContext_t * pCtx )
+{
+    ParameterSetCache_t * pCache = &( pCtx->parameterSetCache );
+
+    /* The staged NALUs are queued after the sent STAP-A and are still valid. */
+    if( pCache->stagedSps.naluDataLength > 0 )
+    {
+        CacheParameterSet( pCtx,
+                           &( pCache->stagedSps ),
+                           NALU_TYPE_SPS );
+        pCache->stagedSps.naluDataLength = 0;
+    }
+
+    if( pCache->stagedPps.naluDataLength > 0 )
+    {
+        CacheParameterSet( pCtx,
+                           &( pCache->stagedPps ),
+                           NALU_TYPE_PPS );
+        pCache->stagedPps.naluDataLength = 0;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
 H264Result_t H264Packetizer_Init( H264PacketizerContext_t * pCtx,
                                   Nalu_t * pNaluArray,
                                   size_t naluArrayLength )
@@ -139,6 +414,12 @@ H264Result_t H264Packetizer_Init( H264PacketizerContext_t * pCtx,
         pCtx->fuAPacketizationState.naluDataIndex = 0;
         pCtx->fuAPacketizationState.remainingNaluLength = 0;
 
+        memset( &( pCtx->frameChunkState ),
+                0,
+                sizeof( FrameChunkState_t ) );
+        memset( &( pCtx->parameterSetCache ),
+                0,
+                sizeof( ParameterSetCache_t ) );
     }
 
     return result;
@@ -235,10 +516,296 @@ H264Result_t H264Packetizer_AddFrame( H264PacketizerContext_t * pCtx,
 
 /*-----------------------------------------------------------*/
 
+H264Result_t H264Packetizer_AddLengthPrefixedFrame( H264PacketizerContext_t * pCtx,
+                                                    Frame_t * pFrame,
+                                                    size_t naluLengthSize )
+{
+    H264Result_t result = H264_RESULT_OK;
+    Nalu_t nalu;
+    size_t i, currentIndex = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pFrame->pFrameData == NULL ) ||
+        ( pFrame->frameDataLength == 0 ) ||
+        ( !IS_VALID_NALU_LENGTH_SIZE( naluLengthSize ) ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    while( ( result == H264_RESULT_OK ) &&
+           ( currentIndex < pFrame->frameDataLength ) )
+    {
+        /* Is there enough data left in the frame to read the NALU length? */
+        if( ( pFrame->frameDataLength - currentIndex ) >= naluLengthSize )
+        {
+            nalu.naluDataLength = 0;
+
+            for( i = 0; i < naluLengthSize; i++ )
+            {
+                nalu.naluDataLength = ( nalu.naluDataLength << 8 ) |
+                                      pFrame->pFrameData[ currentIndex + i ];
+            }
+
+            currentIndex += naluLengthSize;
+
+            /* Is there enough data left in the frame to read the NALU? */
+            if( nalu.naluDataLength <= ( pFrame->frameDataLength - currentIndex ) )
+            {
+                if( nalu.naluDataLength > 0 )
+                {
+                    nalu.pNaluData = &( pFrame->pFrameData[ currentIndex ] );
+                    result = H264Packetizer_AddNalu( pCtx,
+                                                     &( nalu ) );
+                }
+
+                currentIndex += nalu.naluDataLength;
+            }
+            else
+            {
+                result = H264_RESULT_MALFORMED_PACKET;
+            }
+        }
+        else
+        {
+            result = H264_RESULT_MALFORMED_PACKET;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H264Result_t H264Packetizer_SetCarryBuffer( H264PacketizerContext_t * pCtx,
+                                            uint8_t * pCarryBuffer,
+                                            size_t carryBufferLength )
+{
+    H264Result_t result = H264_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pCarryBuffer == NULL ) ||
+        ( carryBufferLength == 0 ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        pCtx->frameChunkState.pCarryBuffer = pCarryBuffer;
+        pCtx->frameChunkState.carryBufferLength = carryBufferLength;
+        pCtx->frameChunkState.carryNaluStartIndex = 0;
+        pCtx->frameChunkState.carryNaluLength = 0;
+        pCtx->frameChunkState.naluInCarryBuffer = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H264Result_t H264Packetizer_AddFrameChunk( H264PacketizerContext_t * pCtx,
+                                           Frame_t * pChunk,
+                                           uint8_t isLastChunk )
+{
+    H264Result_t result = H264_RESULT_OK;
+    FrameChunkState_t * pState = NULL;
+    Nalu_t nalu;
+    size_t currentIndex, naluStartIndex = 0;
+    uint8_t naluStartedInChunk = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pChunk == NULL ) ||
+        ( ( pChunk->pFrameData == NULL ) && ( pChunk->frameDataLength > 0 ) ) ||
+        ( ( pChunk->frameDataLength == 0 ) && ( isLastChunk == 0 ) ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        pState = &( pCtx->frameChunkState );
+
+        for( currentIndex = 0;
+             ( result == H264_RESULT_OK ) && ( currentIndex < pChunk->frameDataLength );
+             currentIndex++ )
+        {
+            if( pChunk->pFrameData[ currentIndex ] == 0x00 )
+            {
+                /* Zeros beyond the 4 byte start code belong to the NALU. */
+                if( pState->zeroCount < 3 )
+                {
+                    pState->zeroCount += 1;
+                }
+            }
+            else if( ( pChunk->pFrameData[ currentIndex ] == 0x01 ) &&
+                     ( pState->zeroCount >= 2 ) )
+            {
+                /* Found a 3 or 4 byte start code, possibly starting in one of
+                 * the previous chunks. */
+                if( ( pState->naluStarted != 0 ) &&
+                    ( naluStartedInChunk != 0 ) )
+                {
+                    nalu.pNaluData = &( pChunk->pFrameData[ naluStartIndex ] );
+                    nalu.naluDataLength = currentIndex - pState->zeroCount - naluStartIndex;
+
+                    if( nalu.naluDataLength > 0 )
+                    {
+                        result = H264Packetizer_AddNalu( pCtx,
+                                                         &( nalu ) );
+                    }
+                }
+                else if( pState->naluStarted != 0 )
+                {
+                    result = CompleteCarriedNalu( pCtx,
+                                                  pChunk->pFrameData,
+                                                  currentIndex,
+                                                  pState->zeroCount );
+                }
+
+                pState->naluStarted = 1;
+                pState->zeroCount = 0;
+                naluStartedInChunk = 1;
+                naluStartIndex = currentIndex + 1;
+            }
+            else
+            {
+                pState->zeroCount = 0;
+            }
+        }
+    }
+
+    if( ( result == H264_RESULT_OK ) &&
+        ( pState->naluStarted != 0 ) )
+    {
+        if( isLastChunk != 0 )
+        {
+            /* No more start codes - the rest of the frame is the last NALU. */
+            if( naluStartedInChunk != 0 )
+            {
+                nalu.pNaluData = &( pChunk->pFrameData[ naluStartIndex ] );
+                nalu.naluDataLength = pChunk->frameDataLength - naluStartIndex;
+
+                if( nalu.naluDataLength > 0 )
+                {
+                    result = H264Packetizer_AddNalu( pCtx,
+                                                     &( nalu ) );
+                }
+            }
+            else
+            {
+                result = CompleteCarriedNalu( pCtx,
+                                              pChunk->pFrameData,
+                                              pChunk->frameDataLength,
+                                              0 );
+            }
+        }
+        else if( naluStartedInChunk != 0 )
+        {
+            /* Do not copy yet - the NALU may still end within this chunk once
+             * the start code straddling into the next chunk is found. */
+            pState->pPendingNaluData = &( pChunk->pFrameData[ naluStartIndex ] );
+            pState->pendingNaluLength = pChunk->frameDataLength - naluStartIndex;
+        }
+        else
+        {
+            /* The NALU spans this complete chunk. */
+            result = AppendToCarryBuffer( pCtx,
+                                          pChunk->pFrameData,
+                                          pChunk->frameDataLength );
+        }
+    }
+
+    if( ( result == H264_RESULT_OK ) &&
+        ( isLastChunk != 0 ) )
+    {
+        pState->naluStarted = 0;
+        pState->zeroCount = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H264Result_t H264Packetizer_SetParameterSetCache( H264PacketizerContext_t * pCtx,
+                                                  uint8_t * pCacheBuffer,
+                                                  size_t cacheBufferLength,
+                                                  uint8_t injectBeforeIdr )
+{
+    H264Result_t result = H264_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pCacheBuffer == NULL ) ||
+        ( cacheBufferLength <= ( STAP_A_HEADER_SIZE + ( 2 * STAP_A_NALU_SIZE ) ) ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        if( pCtx->parameterSetCache.pendingStapACount > 0 )
+        {
+            /* The current cache buffer is still referred by a queued NALU. */
+            result = H264_RESULT_BAD_PARAM;
+        }
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        pCtx->parameterSetCache.pCacheBuffer = pCacheBuffer;
+        pCtx->parameterSetCache.cacheBufferLength = cacheBufferLength;
+        pCtx->parameterSetCache.spsLength = 0;
+        pCtx->parameterSetCache.ppsLength = 0;
+        pCtx->parameterSetCache.injectBeforeIdr = injectBeforeIdr;
+        pCtx->parameterSetCache.parameterSetsAdded = 0;
+        pCtx->parameterSetCache.stagedSps.naluDataLength = 0;
+        pCtx->parameterSetCache.stagedPps.naluDataLength = 0;
+        pCtx->parameterSetCache.injectedNalu = INJECTED_NALU_NONE;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H264Result_t H264Packetizer_GetParameterSets( H264PacketizerContext_t * pCtx,
+                                              Nalu_t * pSps,
+                                              Nalu_t * pPps )
+{
+    H264Result_t result = H264_RESULT_OK;
+    ParameterSetCache_t * pCache;
+
+    if( ( pCtx == NULL ) ||
+        ( pSps == NULL ) ||
+        ( pPps == NULL ) ||
+        ( pCtx->parameterSetCache.pCacheBuffer == NULL ) )
+    {
+        result = H264_RESULT_BAD_PARAM;
+    }
+
+    if( result == H264_RESULT_OK )
+    {
+        pCache = &( pCtx->parameterSetCache );
+
+        pSps->pNaluData = &( pCache->pCacheBuffer[ CACHE_SPS_INDEX ] );
+        pSps->naluDataLength = pCache->spsLength;
+
+        pPps->pNaluData = &( pCache->pCacheBuffer[ CACHE_SPS_INDEX + pCache->spsLength + STAP_A_NALU_SIZE ] );
+        pPps->naluDataLength = pCache->ppsLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
 H264Result_t H264Packetizer_AddNalu( H264PacketizerContext_t * pCtx,
                                      Nalu_t * pNalu )
 {
     H264Result_t result = H264_RESULT_OK;
+    ParameterSetCache_t * pCache = NULL;
+    uint8_t naluType = 0, injectParameterSets = 0;
 
     if( ( pCtx == NULL ) ||
         ( pNalu == NULL ) )
@@ -248,18 +815,86 @@ H264Result_t H264Packetizer_AddNalu( H264PacketizerContext_t * pCtx,
 
     if( result == H264_RESULT_OK )
     {
-        if( pCtx->naluCount >= pCtx->naluArrayLength )
+        pCache = &( pCtx->parameterSetCache );
+
+        if( ( pNalu->pNaluData != NULL ) &&
+            ( pNalu->naluDataLength > 1 ) )
+        {
+            naluType = pNalu->pNaluData[ 0 ] & NALU_HEADER_TYPE_MASK;
+
+            /* Inject the cached parameter sets before the first slice of an
+             * IDR picture, unless the encoder already sent them. The cache is
+             * stale while parameter sets are staged. */
+            if( ( naluType == NALU_TYPE_IDR ) &&
+                ( ( pNalu->pNaluData[ 1 ] & SLICE_FIRST_MB_ZERO_MASK ) != 0 ) &&
+                ( pCache->injectBeforeIdr != 0 ) &&
+                ( pCache->spsLength > 0 ) &&
+                ( pCache->ppsLength > 0 ) &&
+                ( pCache->stagedSps.naluDataLength == 0 ) &&
+                ( pCache->stagedPps.naluDataLength == 0 ) &&
+                ( pCache->parameterSetsAdded != ( PARAMETER_SET_SPS_ADDED | PARAMETER_SET_PPS_ADDED ) ) )
+            {
+                injectParameterSets = 1;
+            }
+        }
+
+        if( ( pCtx->naluCount + injectParameterSets ) >= pCtx->naluArrayLength )
         {
             result = H264_RESULT_OUT_OF_MEMORY;
         }
     }
 
+    if( ( result == H264_RESULT_OK ) &&
+        ( injectParameterSets != 0 ) )
+    {
+        pCtx->pNaluArray[ pCtx->headIndex ].pNaluData = pCache->pCacheBuffer;
+        pCtx->pNaluArray[ pCtx->headIndex ].naluDataLength = STAP_A_HEADER_SIZE +
+                                                             ( 2 * STAP_A_NALU_SIZE ) +
+                                                             pCache->spsLength +
+                                                             pCache->ppsLength;
+        pCtx->headIndex = ( pCtx->headIndex + 1 ) % pCtx->naluArrayLength;
+        pCtx->naluCount += 1;
+        pCache->pendingStapACount += 1;
+    }
+
     if( result == H264_RESULT_OK )
     {
         pCtx->pNaluArray[ pCtx->headIndex ].pNaluData = pNalu->pNaluData;
         pCtx->pNaluArray[ pCtx->headIndex ].naluDataLength = pNalu->naluDataLength;
-        pCtx->headIndex += 1;
+        pCtx->headIndex = ( pCtx->headIndex + 1 ) % pCtx->naluArrayLength;
         pCtx->naluCount += 1;
+
+        if( ( naluType == NALU_TYPE_SPS ) ||
+            ( naluType == NALU_TYPE_PPS ) )
+        {
+            if( pCache->pendingStapACount > 0 )
+            {
+                /* A pending STAP-A refers to the cache - stage the update. */
+                if( naluType == NALU_TYPE_SPS )
+                {
+                    pCache->stagedSps = *pNalu;
+                }
+                else
+                {
+                    pCache->stagedPps = *pNalu;
+                }
+            }
+            else
+            {
+                CacheParameterSet( pCtx,
+                                   pNalu,
+                                   naluType );
+            }
+
+            pCache->parameterSetsAdded |= ( naluType == NALU_TYPE_SPS ) ? PARAMETER_SET_SPS_ADDED :
+                                                                          PARAMETER_SET_PPS_ADDED;
+        }
+        else if( IS_SLICE_NALU_TYPE( naluType ) )
+        {
+            /* SEI, AUD etc. between the parameter sets and the IDR do not
+             * need another injection. */
+            pCache->parameterSetsAdded = 0;
+        }
     }
 
     return result;
@@ -286,6 +921,20 @@ H264Result_t H264Packetizer_GetPacket( H264PacketizerContext_t * pCtx,
         }
     }
 
+    if( ( result == H264_RESULT_OK ) &&
+        ( pCtx->currentlyProcessingPacket == H264_PACKET_NONE ) &&
+        ( pCtx->parameterSetCache.pendingStapACount > 0 ) &&
+        ( pCtx->parameterSetCache.injectedNalu == INJECTED_NALU_NONE ) &&
+        ( pCtx->pNaluArray[ pCtx->tailIndex ].pNaluData == pCtx->parameterSetCache.pCacheBuffer ) &&
+        ( pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength > pPacket->packetDataLength ) )
+    {
+        /* An injected STAP-A must not be fragmented - send the SPS and the
+         * PPS as separate NALUs instead. */
+        pCtx->pNaluArray[ pCtx->tailIndex ].pNaluData = &( pCtx->parameterSetCache.pCacheBuffer[ CACHE_SPS_INDEX ] );
+        pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength = pCtx->parameterSetCache.spsLength;
+        pCtx->parameterSetCache.injectedNalu = INJECTED_NALU_SPS;
+    }
+
     if( result == H264_RESULT_OK )
     {
         /* Are we in the middle of packetizing fragments of a NALU? */
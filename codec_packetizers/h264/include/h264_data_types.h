@@ -30,6 +30,10 @@
 #define STAP_A_PACKET_TYPE              24
 #define FU_A_PACKET_TYPE                28
 
+#define NALU_TYPE_IDR                   5
+#define NALU_TYPE_SPS                   7
+#define NALU_TYPE_PPS                   8
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -121,9 +125,21 @@
 
 /*-----------------------------------------------------------*/
 
+/* Valid NALU length prefix sizes for length prefixed (AVCC) frames. */
+#define IS_VALID_NALU_LENGTH_SIZE( size ) \
+    ( ( ( size ) == 1 ) || ( ( size ) == 2 ) || ( ( size ) == 4 ) )
+
+/*-----------------------------------------------------------*/
+
 /* Packet properties, used in H264Depacketizer_GetPacketProperties. */
 #define H264_PACKET_PROPERTY_START_PACKET   ( 1 << 0 )
 #define H264_PACKET_PROPERTY_END_PACKET     ( 1 << 1 )
+/* Packet starts an IDR picture or carries an SPS. */
+#define H264_PACKET_PROPERTY_KEYFRAME       ( 1 << 2 )
+#define H264_PACKET_PROPERTY_SPS            ( 1 << 3 )
+#define H264_PACKET_PROPERTY_PPS            ( 1 << 4 )
+/* Packet carries an IDR slice or a fragment of it. */
+#define H264_PACKET_PROPERTY_IDR            ( 1 << 5 )
 
 /*-----------------------------------------------------------*/
 
@@ -141,7 +157,8 @@ typedef enum H264Result
     H264_RESULT_NO_MORE_NALUS,
     H264_RESULT_NO_MORE_FRAMES,
     H264_RESULT_MALFORMED_PACKET,
-    H264_RESULT_UNSUPPORTED_PACKET
+    H264_RESULT_UNSUPPORTED_PACKET,
+    H264_RESULT_INCOMPLETE_NALU
 } H264Result_t;
 
 typedef enum H264PacketType
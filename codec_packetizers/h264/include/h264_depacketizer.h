@@ -12,6 +12,7 @@ typedef struct H264DePacketizerContext
     size_t tailIndex;
     size_t curPacketIndex;
     size_t packetCount;
+    uint16_t * pSeqNumArray; /* RTP sequence numbers parallel to pPacketsArray - NULL if not used. */
 } H264DepacketizerContext_t;
 
 H264Result_t H264Depacketizer_Init( H264DepacketizerContext_t * pCtx,
@@ -21,14 +22,69 @@ H264Result_t H264Depacketizer_Init( H264DepacketizerContext_t * pCtx,
 H264Result_t H264Depacketizer_AddPacket( H264DepacketizerContext_t * pCtx,
                                          const H264Packet_t * pPacket );
 
+/* Marks the end of the current frame. The packets array is used as a ring so
+ * packets of the next frames can be added before the current frame is read.
+ * H264Depacketizer_GetFrame and its variants stop at the frame end, and
+ * consider all the packets added so far as one frame if it is not marked.
+ * The frame end takes one entry in the packets array. */
+H264Result_t H264Depacketizer_EndFrame( H264DepacketizerContext_t * pCtx );
+
+/* Enables detection of lost FU-A fragments. pSeqNumArray must be of the same
+ * length as the packets array passed to H264Depacketizer_Init and packets must
+ * then be added using H264Depacketizer_AddPacketWithSeqNum. A NALU with a
+ * missing start fragment, a missing end fragment or a gap in sequence numbers
+ * is consumed and reported as H264_RESULT_INCOMPLETE_NALU. */
+H264Result_t H264Depacketizer_SetSeqNumArray( H264DepacketizerContext_t * pCtx,
+                                              uint16_t * pSeqNumArray );
+
+H264Result_t H264Depacketizer_AddPacketWithSeqNum( H264DepacketizerContext_t * pCtx,
+                                                   const H264Packet_t * pPacket,
+                                                   uint16_t seqNum );
+
 H264Result_t H264Depacketizer_GetNalu( H264DepacketizerContext_t * pCtx,
                                        Nalu_t * pNalu );
 
-/* It assumes that all the packets added using H264Depacketizer_AddPacket are
- * part of the same frame. It also adds start codes to separate NALUs. */
+/* It returns the packets up to the next frame end marked using
+ * H264Depacketizer_EndFrame, or all the packets added using
+ * H264Depacketizer_AddPacket if none is marked, as one frame. It also adds
+ * start codes to separate NALUs. If a NALU of the frame is incomplete, the
+ * rest of the frame, up to and including its end, is discarded and
+ * H264_RESULT_INCOMPLETE_NALU is returned. The same applies to the variants
+ * below. */
 H264Result_t H264Depacketizer_GetFrame( H264DepacketizerContext_t * pCtx,
                                         Frame_t * pFrame );
 
+/* Same as H264Depacketizer_GetFrame but each NALU is preceded by its length in
+ * naluLengthSize (1, 2 or 4) bytes in network byte order (AVCC format).
+ * H264_RESULT_BAD_PARAM is returned, without consuming any packet, if the
+ * length of a NALU does not fit in naluLengthSize bytes. */
+H264Result_t H264Depacketizer_GetLengthPrefixedFrame( H264DepacketizerContext_t * pCtx,
+                                                      Frame_t * pFrame,
+                                                      size_t naluLengthSize );
+
+/* Returns the exact length of the frame which H264Depacketizer_GetFrame
+ * would assemble from the packets added so far, without consuming them. */
+H264Result_t H264Depacketizer_GetFrameLength( const H264DepacketizerContext_t * pCtx,
+                                              size_t * pFrameLength );
+
+/* Same as H264Depacketizer_GetFrameLength for
+ * H264Depacketizer_GetLengthPrefixedFrame. */
+H264Result_t H264Depacketizer_GetLengthPrefixedFrameLength( const H264DepacketizerContext_t * pCtx,
+                                                            size_t naluLengthSize,
+                                                            size_t * pFrameLength );
+
+/* Same as H264Depacketizer_GetFrame but returns the NALUs of the frame in
+ * pNalusArray without start codes. *pNalusCount is the length of pNalusArray
+ * on input and the number of NALUs returned on output. Single NALU and STAP-A
+ * NALUs refer to the packet buffers directly, only FU-A NALUs are joined in
+ * pScratchBuffer. The returned NALUs remain valid as long as the packet
+ * buffers and the scratch buffer are. */
+H264Result_t H264Depacketizer_GetFrameNalus( H264DepacketizerContext_t * pCtx,
+                                             Nalu_t * pNalusArray,
+                                             size_t * pNalusCount,
+                                             uint8_t * pScratchBuffer,
+                                             size_t scratchBufferLength );
+
 H264Result_t H264Depacketizer_GetPacketProperties( const uint8_t * pPacketData,
                                                    const size_t packetDataLength,
                                                    uint32_t * pProperties );
@@ -0,0 +1,20 @@
+#ifndef H264_INTERFACE_H
+#define H264_INTERFACE_H
+
+/* API includes. */
+#include "codec_interface.h"
+#include "h264_packetizer.h"
+#include "h264_depacketizer.h"
+
+/* Binds an H.264 packetizer context to the common packetizer interface.
+ * pCtx must be initialized with H264Packetizer_Init. Frames are added
+ * with H264Packetizer_AddFrame. */
+CodecResult_t H264Interface_InitPacketizer( CodecPacketizer_t * pPacketizer,
+                                            H264PacketizerContext_t * pCtx );
+
+/* Binds an H.264 depacketizer context to the common depacketizer interface.
+ * pCtx must be initialized with H264Depacketizer_Init. */
+CodecResult_t H264Interface_InitDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                              H264DepacketizerContext_t * pCtx );
+
+#endif /* H264_INTERFACE_H */
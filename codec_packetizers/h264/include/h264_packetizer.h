@@ -11,6 +11,39 @@ typedef struct FuAPacketizationState
     size_t remainingNaluLength;
 } FuAPacketizationState_t;
 
+/* State used to find NALUs in an Annex-B frame delivered in chunks. A NALU
+ * which lies completely within a chunk is referenced in place, only a NALU
+ * straddling chunk boundaries is joined in the caller supplied carry buffer. */
+typedef struct FrameChunkState
+{
+    uint8_t * pCarryBuffer;
+    size_t carryBufferLength;
+    size_t carryNaluStartIndex; /* Start of the NALU being joined in the carry buffer. */
+    size_t carryNaluLength;     /* Bytes of the NALU joined so far. */
+    uint8_t * pPendingNaluData; /* Tail NALU of the previous chunk, not yet joined. */
+    size_t pendingNaluLength;
+    uint8_t naluInCarryBuffer;
+    uint8_t naluStarted;
+    uint8_t zeroCount;          /* Number of consecutive zero bytes seen. */
+} FrameChunkState_t;
+
+/* Latest SPS and PPS, kept as a ready to send STAP-A in the caller supplied
+ * buffer:
+ * [STAP-A header][SPS size][SPS][PPS size][PPS] */
+typedef struct ParameterSetCache
+{
+    uint8_t * pCacheBuffer;
+    size_t cacheBufferLength;
+    size_t spsLength;
+    size_t ppsLength;
+    size_t pendingStapACount;   /* Injected STAP-As not yet packetized. */
+    Nalu_t stagedSps;           /* Added while STAP-As are pending, cached once they are sent. */
+    Nalu_t stagedPps;
+    uint8_t injectBeforeIdr;
+    uint8_t parameterSetsAdded; /* SPS/PPS added since the last slice. */
+    uint8_t injectedNalu;       /* Parameter set of an injected STAP-A being sent on its own. */
+} ParameterSetCache_t;
+
 typedef struct H264PacketizerContext
 {
     Nalu_t * pNaluArray;
@@ -20,6 +53,8 @@ typedef struct H264PacketizerContext
     size_t naluCount;
     H264PacketType_t currentlyProcessingPacket;
     FuAPacketizationState_t fuAPacketizationState;
+    FrameChunkState_t frameChunkState;
+    ParameterSetCache_t parameterSetCache;
 } H264PacketizerContext_t;
 
 H264Result_t H264Packetizer_Init( H264PacketizerContext_t * pCtx,
@@ -30,6 +65,52 @@ H264Result_t H264Packetizer_Init( H264PacketizerContext_t * pCtx,
 H264Result_t H264Packetizer_AddFrame( H264PacketizerContext_t * pCtx,
                                       Frame_t * pFrame );
 
+/* A frame comprising of multiple NALUs, each preceded by its length in
+ * naluLengthSize (1, 2 or 4) bytes in network byte order (AVCC format). */
+H264Result_t H264Packetizer_AddLengthPrefixedFrame( H264PacketizerContext_t * pCtx,
+                                                    Frame_t * pFrame,
+                                                    size_t naluLengthSize );
+
+/* Buffer used to join NALUs which straddle the chunks passed to
+ * H264Packetizer_AddFrameChunk. Joined NALUs are appended one after another
+ * and the buffer is reused from the start only once all the packets are
+ * retrieved. It must therefore be large enough to hold all the straddling
+ * NALUs added between two points where the packetizer is drained - the
+ * largest such NALU if all the packets are retrieved after every chunk,
+ * otherwise up to the size of the frame. It must not be modified until all
+ * the packets are retrieved. */
+H264Result_t H264Packetizer_SetCarryBuffer( H264PacketizerContext_t * pCtx,
+                                            uint8_t * pCarryBuffer,
+                                            size_t carryBufferLength );
+
+/* A chunk of a frame comprising of multiple NALUs separated by start codes.
+ * Start codes may straddle chunks. NALUs are added as soon as they are
+ * complete and the last NALU is added when isLastChunk is set. The chunk
+ * data must remain valid until all the packets are retrieved. */
+H264Result_t H264Packetizer_AddFrameChunk( H264PacketizerContext_t * pCtx,
+                                           Frame_t * pChunk,
+                                           uint8_t isLastChunk );
+
+/* Cache the latest SPS and PPS added using H264Packetizer_AddNalu in the
+ * caller supplied buffer. If injectBeforeIdr is set, the cached SPS and PPS
+ * are sent in a STAP-A packet before every IDR which the encoder did not
+ * precede with them since the last slice. An SPS or PPS added while an
+ * injected STAP-A is pending is cached only once the STAP-A is sent, so that
+ * the STAP-A carries the parameter sets of its IDR - no STAP-A is injected
+ * until then. If the STAP-A does not fit in the packet passed to
+ * H264Packetizer_GetPacket, the SPS and PPS are sent as separate NALUs. */
+H264Result_t H264Packetizer_SetParameterSetCache( H264PacketizerContext_t * pCtx,
+                                                  uint8_t * pCacheBuffer,
+                                                  size_t cacheBufferLength,
+                                                  uint8_t injectBeforeIdr );
+
+/* The returned NALUs point to the cache and have zero length if not seen yet.
+ * An SPS or PPS staged while an injected STAP-A is pending is not returned
+ * until the STAP-A is sent. */
+H264Result_t H264Packetizer_GetParameterSets( H264PacketizerContext_t * pCtx,
+                                              Nalu_t * pSps,
+                                              Nalu_t * pPps );
+
 H264Result_t H264Packetizer_AddNalu( H264PacketizerContext_t * pCtx,
                                      Nalu_t * pNalu );
 
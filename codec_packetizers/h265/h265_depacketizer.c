@@ -0,0 +1,562 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "h265_depacketizer.h"
+
+/* Length of the start code added before each NALU of an Annex-B frame. */
+#define ANNEX_B_START_CODE_LENGTH    4
+
+/* Frame boundaries, added using H265Depacketizer_EndFrame, are stored in the
+ * packets array as packets with no data. */
+#define IS_FRAME_BOUNDARY( pCtx, index ) \
+    ( ( pCtx )->pPacketsArray[ ( index ) ].pPacketData == NULL )
+
+static void MoveToNextPacket( H265DepacketizerContext_t * pCtx );
+
+static H265Result_t DepacketizeSingleNaluPacket( H265DepacketizerContext_t * pCtx,
+                                                 H265Nalu_t * pNalu );
+
+static H265Result_t DepacketizeFragmentationUnitPacket( H265DepacketizerContext_t * pCtx,
+                                                        H265Nalu_t * pNalu );
+
+static H265Result_t DepacketizeAggregationPacket( H265DepacketizerContext_t * pCtx,
+                                                  H265Nalu_t * pNalu );
+
+static uint32_t GetNaluTypeProperties( uint8_t naluType,
+                                       uint8_t isNaluStart );
+
+/*-----------------------------------------------------------*/
+
+static void MoveToNextPacket( H265DepacketizerContext_t * pCtx )
+{
+    pCtx->tailIndex = ( pCtx->tailIndex + 1 ) % pCtx->packetsArrayLength;
+    pCtx->packetCount -= 1;
+}
+
+/*-----------------------------------------------------------*/
+
+static H265Result_t DepacketizeSingleNaluPacket( H265DepacketizerContext_t * pCtx,
+                                                 H265Nalu_t * pNalu )
+{
+    H265Result_t result = H265_RESULT_OK;
+    size_t curPacketLength = pCtx->pPacketsArray[ pCtx->tailIndex ].packetDataLength;
+
+    if( curPacketLength <= pNalu->naluDataLength )
+    {
+        memcpy( ( void * ) &( pNalu->pNaluData[ 0 ] ),
+                ( const void * ) &( pCtx->pPacketsArray[ pCtx->tailIndex ].pPacketData[ 0 ] ),
+                curPacketLength );
+    }
+    else
+    {
+        result = H265_RESULT_OUT_OF_MEMORY;
+    }
+
+    pNalu->naluDataLength = curPacketLength;
+
+    /* Move to the next packet in the next call to H265Depacketizer_GetNalu. */
+    MoveToNextPacket( pCtx );
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static H265Result_t DepacketizeFragmentationUnitPacket( H265DepacketizerContext_t * pCtx,
+                                                        H265Nalu_t * pNalu )
+{
+    uint8_t * pCurPacketData;
+    uint8_t fuHeader = 0;
+    size_t curPacketLength, curNaluDataIndex = 0;
+    H265Result_t result = H265_RESULT_OK;
+
+    /* While there are more fragments to process and we have not yet processed
+     * the last fragment. */
+    while( ( pCtx->packetCount > 0 ) &&
+           ( ( fuHeader & H265_FU_HEADER_E_BIT_MASK ) == 0 ) )
+    {
+        /* Break if the frame ends before the last fragment. */
+        if( IS_FRAME_BOUNDARY( pCtx, pCtx->tailIndex ) )
+        {
+            break;
+        }
+
+        pCurPacketData = pCtx->pPacketsArray[ pCtx->tailIndex ].pPacketData;
+        curPacketLength = pCtx->pPacketsArray[ pCtx->tailIndex ].packetDataLength;
+
+        /* Break if this packet is not a fragment of the current packet. */
+        if( H265_NALU_HEADER_GET_TYPE( pCurPacketData ) != H265_FU_PACKET_TYPE )
+        {
+            break;
+        }
+
+        if( curPacketLength < H265_FU_HEADER_SIZE )
+        {
+            result = H265_RESULT_MALFORMED_PACKET;
+            MoveToNextPacket( pCtx );
+            break;
+        }
+
+        fuHeader = pCurPacketData[ H265_FU_HEADER_OFFSET ];
+
+        /* Write NALU header for the first fragment only. */
+        if( ( fuHeader & H265_FU_HEADER_S_BIT_MASK ) != 0 )
+        {
+            if( ( curNaluDataIndex + H265_NALU_HEADER_SIZE ) <= pNalu->naluDataLength )
+            {
+                pNalu->pNaluData[ curNaluDataIndex ] = ( uint8_t ) ( ( pCurPacketData[ H265_FU_PAYLOAD_HEADER_OFFSET ] &
+                                                                       ( uint8_t ) ~H265_NALU_HEADER_TYPE_MASK ) |
+                                                                     ( ( fuHeader & H265_FU_HEADER_TYPE_MASK ) << H265_NALU_HEADER_TYPE_LOCATION ) );
+                pNalu->pNaluData[ curNaluDataIndex + 1 ] = pCurPacketData[ H265_FU_PAYLOAD_HEADER_OFFSET + 1 ];
+            }
+            else
+            {
+                result = H265_RESULT_OUT_OF_MEMORY;
+            }
+            curNaluDataIndex += H265_NALU_HEADER_SIZE;
+        }
+
+        /* Write NALU payload. */
+        if( ( curNaluDataIndex + curPacketLength - H265_FU_HEADER_SIZE ) <= pNalu->naluDataLength )
+        {
+            memcpy( ( void * ) &( pNalu->pNaluData[ curNaluDataIndex ] ),
+                    ( const void * ) &( pCurPacketData[ H265_FU_PAYLOAD_OFFSET ] ),
+                    curPacketLength - H265_FU_HEADER_SIZE );
+        }
+        else
+        {
+            result = H265_RESULT_OUT_OF_MEMORY;
+        }
+        curNaluDataIndex += ( curPacketLength - H265_FU_HEADER_SIZE );
+
+        /* Move to the next packet. */
+        MoveToNextPacket( pCtx );
+    }
+
+    /* Update NALU Length. */
+    pNalu->naluDataLength = curNaluDataIndex;
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static H265Result_t DepacketizeAggregationPacket( H265DepacketizerContext_t * pCtx,
+                                                  H265Nalu_t * pNalu )
+{
+    uint8_t * pCurPacketData;
+    size_t curPacketLength, naluLength;
+    H265Result_t result = H265_RESULT_OK;
+
+    pCurPacketData = pCtx->pPacketsArray[ pCtx->tailIndex ].pPacketData;
+    curPacketLength = pCtx->pPacketsArray[ pCtx->tailIndex ].packetDataLength;
+
+    /* We are just starting to parse an AP. Skip the payload header. */
+    if( pCtx->curPacketIndex == 0 )
+    {
+        pCtx->curPacketIndex += H265_AP_HEADER_SIZE;
+    }
+
+    /* Is there enough data left in the packet to read the next NALU size? */
+    if( ( pCtx->curPacketIndex + H265_AP_NALU_SIZE ) <= curPacketLength )
+    {
+        /* Read NALU length. */
+        naluLength = pCurPacketData[ pCtx->curPacketIndex ];
+        naluLength = ( naluLength << 8 ) |
+                     ( pCurPacketData[ pCtx->curPacketIndex + 1 ] );
+
+        pCtx->curPacketIndex += H265_AP_NALU_SIZE;
+
+        /* Is there enough data left in the packet to read the next NALU? */
+        if( ( pCtx->curPacketIndex + naluLength ) <= curPacketLength )
+        {
+            /* Is there enough space in the output buffer? */
+            if( naluLength <= pNalu->naluDataLength )
+            {
+                memcpy( ( void * ) &( pNalu->pNaluData[ 0 ] ),
+                        ( const void * ) &( pCurPacketData[ pCtx->curPacketIndex ] ),
+                        naluLength );
+            }
+            else
+            {
+                result = H265_RESULT_OUT_OF_MEMORY;
+            }
+
+            /* Update NALU length. */
+            pNalu->naluDataLength = naluLength;
+        }
+        else
+        {
+            result = H265_RESULT_MALFORMED_PACKET;
+        }
+
+        /* Move to next Nalu in the next call to H265Depacketizer_GetNalu. In
+         * case of malformed packet, this ensures that we move to the next
+         * packet below. */
+        pCtx->curPacketIndex += naluLength;
+    }
+
+    /* If we do not have enough data left in this packet, move to the next
+     * packet in the next call to H265Depacketizer_GetNalu. */
+    if( ( pCtx->curPacketIndex + H265_AP_NALU_SIZE ) > curPacketLength )
+    {
+        pCtx->curPacketIndex = 0;
+        MoveToNextPacket( pCtx );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint32_t GetNaluTypeProperties( uint8_t naluType,
+                                       uint8_t isNaluStart )
+{
+    uint32_t properties = 0;
+
+    if( naluType == H265_NALU_TYPE_VPS )
+    {
+        properties = H265_PACKET_PROPERTY_VPS | H265_PACKET_PROPERTY_KEYFRAME;
+    }
+    else if( naluType == H265_NALU_TYPE_SPS )
+    {
+        properties = H265_PACKET_PROPERTY_SPS | H265_PACKET_PROPERTY_KEYFRAME;
+    }
+    else if( naluType == H265_NALU_TYPE_PPS )
+    {
+        properties = H265_PACKET_PROPERTY_PPS;
+    }
+    else if( ( naluType >= H265_NALU_TYPE_IRAP_START ) &&
+             ( naluType <= H265_NALU_TYPE_IRAP_END ) )
+    {
+        properties = H265_PACKET_PROPERTY_IRAP;
+
+        if( isNaluStart != 0 )
+        {
+            properties |= H265_PACKET_PROPERTY_KEYFRAME;
+        }
+    }
+
+    return properties;
+}
+
+/*-----------------------------------------------------------*/
+
+H265Result_t H265Depacketizer_Init( H265DepacketizerContext_t * pCtx,
+                                    H265Packet_t * pPacketsArray,
+                                    size_t packetsArrayLength )
+{
+    H265Result_t result = H265_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pPacketsArray == NULL ) ||
+        ( packetsArrayLength == 0 ) )
+    {
+        result = H265_RESULT_BAD_PARAM;
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        pCtx->pPacketsArray = pPacketsArray;
+        pCtx->packetsArrayLength = packetsArrayLength;
+
+        pCtx->headIndex = 0;
+        pCtx->tailIndex = 0;
+        pCtx->packetCount = 0;
+        pCtx->curPacketIndex = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H265Result_t H265Depacketizer_AddPacket( H265DepacketizerContext_t * pCtx,
+                                         const H265Packet_t * pPacket )
+{
+    H265Result_t result = H265_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pPacket == NULL ) ||
+        ( pPacket->pPacketData == NULL ) ||
+        ( pPacket->packetDataLength < H265_NALU_HEADER_SIZE ) )
+    {
+        result = H265_RESULT_BAD_PARAM;
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        if( pCtx->packetCount >= pCtx->packetsArrayLength )
+        {
+            result = H265_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        pCtx->pPacketsArray[ pCtx->headIndex ].pPacketData = pPacket->pPacketData;
+        pCtx->pPacketsArray[ pCtx->headIndex ].packetDataLength = pPacket->packetDataLength;
+        pCtx->headIndex = ( pCtx->headIndex + 1 ) % pCtx->packetsArrayLength;
+        pCtx->packetCount += 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H265Result_t H265Depacketizer_EndFrame( H265DepacketizerContext_t * pCtx )
+{
+    H265Result_t result = H265_RESULT_OK;
+
+    if( pCtx == NULL )
+    {
+        result = H265_RESULT_BAD_PARAM;
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        if( pCtx->packetCount >= pCtx->packetsArrayLength )
+        {
+            result = H265_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        pCtx->pPacketsArray[ pCtx->headIndex ].pPacketData = NULL;
+        pCtx->pPacketsArray[ pCtx->headIndex ].packetDataLength = 0;
+        pCtx->headIndex = ( pCtx->headIndex + 1 ) % pCtx->packetsArrayLength;
+        pCtx->packetCount += 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H265Result_t H265Depacketizer_GetNalu( H265DepacketizerContext_t * pCtx,
+                                       H265Nalu_t * pNalu )
+{
+    H265Result_t result = H265_RESULT_OK;
+    uint8_t packetType;
+
+    if( ( pCtx == NULL ) ||
+        ( pNalu == NULL ) ||
+        ( pNalu->pNaluData == NULL ) )
+    {
+        result = H265_RESULT_BAD_PARAM;
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        /* Frame boundaries do not matter when reading NALUs one by one. */
+        while( ( pCtx->packetCount > 0 ) &&
+               ( IS_FRAME_BOUNDARY( pCtx, pCtx->tailIndex ) ) )
+        {
+            MoveToNextPacket( pCtx );
+        }
+
+        if( pCtx->packetCount == 0 )
+        {
+            result = H265_RESULT_NO_MORE_NALUS;
+        }
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        packetType = H265_NALU_HEADER_GET_TYPE( pCtx->pPacketsArray[ pCtx->tailIndex ].pPacketData );
+
+        if( packetType <= H265_SINGLE_NALU_PACKET_TYPE_END )
+        {
+            result = DepacketizeSingleNaluPacket( pCtx,
+                                                  pNalu );
+        }
+        else if( packetType == H265_FU_PACKET_TYPE )
+        {
+            result = DepacketizeFragmentationUnitPacket( pCtx,
+                                                         pNalu );
+        }
+        else if( packetType == H265_AP_PACKET_TYPE )
+        {
+            result = DepacketizeAggregationPacket( pCtx,
+                                                   pNalu );
+        }
+        else
+        {
+            result = H265_RESULT_UNSUPPORTED_PACKET;
+            MoveToNextPacket( pCtx );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H265Result_t H265Depacketizer_GetFrame( H265DepacketizerContext_t * pCtx,
+                                        H265Frame_t * pFrame )
+{
+    H265Result_t result = H265_RESULT_OK;
+    H265Nalu_t nalu;
+    size_t currentFrameDataIndex = 0;
+    uint8_t startCode[ ANNEX_B_START_CODE_LENGTH ] = { 0x00, 0x00, 0x00, 0x01 };
+
+    if( ( pCtx == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pFrame->pFrameData == NULL ) ||
+        ( pFrame->frameDataLength == 0 ) )
+    {
+        result = H265_RESULT_BAD_PARAM;
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        if( pCtx->packetCount == 0 )
+        {
+            result = H265_RESULT_NO_MORE_FRAMES;
+        }
+    }
+
+    while( ( result == H265_RESULT_OK ) &&
+           ( pCtx->packetCount > 0 ) &&
+           ( !IS_FRAME_BOUNDARY( pCtx, pCtx->tailIndex ) ) )
+    {
+        if( ( pFrame->frameDataLength - currentFrameDataIndex ) > sizeof( startCode ) )
+        {
+            nalu.pNaluData = &( pFrame->pFrameData[ currentFrameDataIndex + sizeof( startCode ) ] );
+            nalu.naluDataLength = pFrame->frameDataLength - currentFrameDataIndex - sizeof( startCode );
+
+            result = H265Depacketizer_GetNalu( pCtx,
+                                               &( nalu ) );
+
+            if( result == H265_RESULT_OK )
+            {
+                memcpy( ( void * ) &( pFrame->pFrameData[ currentFrameDataIndex ] ),
+                        ( const void * ) &( startCode[ 0 ] ),
+                        sizeof( startCode ) );
+                currentFrameDataIndex += sizeof( startCode ) + nalu.naluDataLength;
+            }
+        }
+        else
+        {
+            result = H265_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result != H265_RESULT_BAD_PARAM )
+    {
+        pFrame->frameDataLength = currentFrameDataIndex;
+    }
+
+    if( result == H265_RESULT_NO_MORE_NALUS )
+    {
+        result = H265_RESULT_OK;
+    }
+
+    /* Consume the boundary of the frame assembled. */
+    if( ( result == H265_RESULT_OK ) &&
+        ( pCtx->packetCount > 0 ) )
+    {
+        MoveToNextPacket( pCtx );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H265Result_t H265Depacketizer_GetPacketProperties( const uint8_t * pPacketData,
+                                                   const size_t packetDataLength,
+                                                   uint32_t * pProperties )
+{
+    H265Result_t result = H265_RESULT_OK;
+    uint8_t packetType, fuHeader;
+    size_t currentOffset, naluSize;
+
+    if( ( pPacketData == NULL ) ||
+        ( packetDataLength < H265_NALU_HEADER_SIZE ) ||
+        ( pProperties == NULL ) )
+    {
+        result = H265_RESULT_BAD_PARAM;
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        packetType = H265_NALU_HEADER_GET_TYPE( pPacketData );
+
+        if( packetType <= H265_SINGLE_NALU_PACKET_TYPE_END )
+        {
+            *pProperties = H265_PACKET_PROPERTY_START_PACKET;
+            *pProperties |= GetNaluTypeProperties( packetType,
+                                                   1 );
+        }
+        else if( packetType == H265_FU_PACKET_TYPE )
+        {
+            if( packetDataLength < H265_FU_HEADER_SIZE )
+            {
+                result = H265_RESULT_MALFORMED_PACKET;
+            }
+            else
+            {
+                *pProperties = 0;
+                fuHeader = pPacketData[ H265_FU_HEADER_OFFSET ];
+
+                if( ( fuHeader & H265_FU_HEADER_S_BIT_MASK ) != 0 )
+                {
+                    *pProperties |= H265_PACKET_PROPERTY_START_PACKET;
+                }
+
+                if( ( fuHeader & H265_FU_HEADER_E_BIT_MASK ) != 0 )
+                {
+                    *pProperties |= H265_PACKET_PROPERTY_END_PACKET;
+                }
+
+                *pProperties |= GetNaluTypeProperties( fuHeader & H265_FU_HEADER_TYPE_MASK,
+                                                       ( ( fuHeader & H265_FU_HEADER_S_BIT_MASK ) != 0 ) ? 1 : 0 );
+            }
+        }
+        else if( packetType == H265_AP_PACKET_TYPE )
+        {
+            *pProperties = H265_PACKET_PROPERTY_START_PACKET;
+            currentOffset = H265_AP_HEADER_SIZE;
+
+            /* Walk the aggregated NALU headers without copying. */
+            while( ( result == H265_RESULT_OK ) &&
+                   ( currentOffset < packetDataLength ) )
+            {
+                if( ( currentOffset + H265_AP_NALU_SIZE + H265_NALU_HEADER_SIZE ) > packetDataLength )
+                {
+                    result = H265_RESULT_MALFORMED_PACKET;
+                }
+                else
+                {
+                    naluSize = ( ( size_t ) pPacketData[ currentOffset ] << 8 ) |
+                               ( size_t ) pPacketData[ currentOffset + 1 ];
+                    currentOffset += H265_AP_NALU_SIZE;
+
+                    if( ( naluSize < H265_NALU_HEADER_SIZE ) ||
+                        ( naluSize > ( packetDataLength - currentOffset ) ) )
+                    {
+                        result = H265_RESULT_MALFORMED_PACKET;
+                    }
+                    else
+                    {
+                        *pProperties |= GetNaluTypeProperties( H265_NALU_HEADER_GET_TYPE( &( pPacketData[ currentOffset ] ) ),
+                                                               1 );
+                        currentOffset += naluSize;
+                    }
+                }
+            }
+        }
+        else
+        {
+            result = H265_RESULT_UNSUPPORTED_PACKET;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
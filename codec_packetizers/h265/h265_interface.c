@@ -0,0 +1,73 @@
+/* API includes. */
+#include "h265_interface.h"
+#include "codec_interface_adapter.h"
+
+/*-----------------------------------------------------------*/
+
+/* In the order of H265Result_t. */
+static const CodecResult_t resultMap[] =
+{
+    CODEC_RESULT_OK,
+    CODEC_RESULT_BAD_PARAM,
+    CODEC_RESULT_OUT_OF_MEMORY,
+    CODEC_RESULT_NO_MORE_PACKETS,
+    CODEC_RESULT_NO_MORE_FRAMES,
+    CODEC_RESULT_NO_MORE_FRAMES,
+    CODEC_RESULT_MALFORMED_PACKET,
+    CODEC_RESULT_UNSUPPORTED_PACKET
+};
+
+/*-----------------------------------------------------------*/
+
+CODEC_INTERFACE_DEFINE_ADD_FRAME( AddFrame,
+                                  H265PacketizerContext_t,
+                                  H265Frame_t,
+                                  H265Packetizer_AddFrame,
+                                  resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_PACKET( GetPacket,
+                                   H265PacketizerContext_t,
+                                   H265Packet_t,
+                                   H265Packetizer_GetPacket,
+                                   resultMap )
+
+CODEC_INTERFACE_DEFINE_ADD_PACKET( AddPacket,
+                                   H265DepacketizerContext_t,
+                                   H265Packet_t,
+                                   H265Depacketizer_AddPacket,
+                                   resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_FRAME( GetFrame,
+                                  H265DepacketizerContext_t,
+                                  H265Frame_t,
+                                  H265Depacketizer_GetFrame,
+                                  resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_PACKET_PROPERTIES( GetPacketProperties,
+                                              H265Depacketizer_GetPacketProperties,
+                                              resultMap )
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t H265Interface_InitPacketizer( CodecPacketizer_t * pPacketizer,
+                                            H265PacketizerContext_t * pCtx )
+{
+    return CodecInterface_BindPacketizer( pPacketizer,
+                                          ( void * ) pCtx,
+                                          AddFrame,
+                                          GetPacket );
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t H265Interface_InitDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                              H265DepacketizerContext_t * pCtx )
+{
+    return CodecInterface_BindDepacketizer( pDepacketizer,
+                                            ( void * ) pCtx,
+                                            AddPacket,
+                                            GetFrame,
+                                            GetPacketProperties );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,476 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "h265_packetizer.h"
+
+/* Frame boundaries, added using H265Packetizer_EndFrame, are stored in the
+ * NALU array as NALUs with no data. */
+#define IS_FRAME_BOUNDARY( pCtx, index ) \
+    ( ( pCtx )->pNaluArray[ ( index ) ].pNaluData == NULL )
+
+/*-----------------------------------------------------------*/
+
+static void MoveToNextNalu( H265PacketizerContext_t * pCtx );
+
+static size_t GetAggregatableNaluCount( const H265PacketizerContext_t * pCtx,
+                                        size_t packetDataLength );
+
+static void PacketizeSingleNaluPacket( H265PacketizerContext_t * pCtx,
+                                       H265Packet_t * pPacket );
+
+static void PacketizeAggregationPacket( H265PacketizerContext_t * pCtx,
+                                        H265Packet_t * pPacket,
+                                        size_t naluCount );
+
+static void PacketizeFragmentationUnitPacket( H265PacketizerContext_t * pCtx,
+                                              H265Packet_t * pPacket );
+
+/*-----------------------------------------------------------*/
+
+static void MoveToNextNalu( H265PacketizerContext_t * pCtx )
+{
+    pCtx->tailIndex = ( pCtx->tailIndex + 1 ) % pCtx->naluArrayLength;
+    pCtx->naluCount -= 1;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Number of consecutive NALUs, starting from the current one, which fit in an
+ * aggregation packet of packetDataLength bytes. An aggregation packet must
+ * not span access units, so it stops at the frame boundary. */
+static size_t GetAggregatableNaluCount( const H265PacketizerContext_t * pCtx,
+                                        size_t packetDataLength )
+{
+    size_t i, naluIndex, naluDataLength, aggregationPacketLength = H265_AP_HEADER_SIZE, count = 0;
+
+    naluIndex = pCtx->tailIndex;
+
+    for( i = 0; i < pCtx->naluCount; i++ )
+    {
+        naluDataLength = pCtx->pNaluArray[ naluIndex ].naluDataLength;
+
+        if( ( IS_FRAME_BOUNDARY( pCtx, naluIndex ) ) ||
+            ( naluDataLength < H265_NALU_HEADER_SIZE ) ||
+            ( ( aggregationPacketLength + H265_AP_NALU_SIZE + naluDataLength ) > packetDataLength ) )
+        {
+            break;
+        }
+
+        aggregationPacketLength += H265_AP_NALU_SIZE + naluDataLength;
+        count += 1;
+        naluIndex = ( naluIndex + 1 ) % pCtx->naluArrayLength;
+    }
+
+    return count;
+}
+
+/*-----------------------------------------------------------*/
+
+/*
+ * RTP payload format for single NAL unit packet:
+ *
+ *  0                   1                   2                   3
+ *  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |           PayloadHdr          |                               |
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+                               |
+ * |                                                               |
+ * |                  NAL unit payload data                        |
+ * |                                                               |
+ * |                               +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |                               :...OPTIONAL RTP padding        |
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ */
+static void PacketizeSingleNaluPacket( H265PacketizerContext_t * pCtx,
+                                       H265Packet_t * pPacket )
+{
+    /* Fill packet. */
+    memcpy( ( void * ) &( pPacket->pPacketData[ 0 ] ),
+            ( const void * ) &( pCtx->pNaluArray[ pCtx->tailIndex ].pNaluData[ 0 ] ),
+            pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength );
+    pPacket->packetDataLength = pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength;
+
+    /* Move to the next NALU in the next call to H265Packetizer_GetPacket. */
+    MoveToNextNalu( pCtx );
+}
+
+/*-----------------------------------------------------------*/
+
+static void PacketizeAggregationPacket( H265PacketizerContext_t * pCtx,
+                                        H265Packet_t * pPacket,
+                                        size_t naluCount )
+{
+    size_t i, naluDataLength, packetDataIndex = H265_AP_HEADER_SIZE;
+    uint8_t * pNaluData;
+    uint8_t forbiddenBit = 0, layerId = 0x3F, tid = H265_NALU_HEADER_TID_MASK;
+
+    for( i = 0; i < naluCount; i++ )
+    {
+        pNaluData = pCtx->pNaluArray[ pCtx->tailIndex ].pNaluData;
+        naluDataLength = pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength;
+
+        /* F bit is set if any of the aggregated NALUs has it set. LayerId and
+         * TID are the lowest of all the aggregated NALUs. */
+        forbiddenBit |= pNaluData[ 0 ] & H265_NALU_HEADER_F_MASK;
+        layerId = H265_MIN( layerId,
+                            ( uint8_t ) ( ( ( pNaluData[ 0 ] & H265_NALU_HEADER_LAYER_ID_MSB_MASK ) << H265_NALU_HEADER_LAYER_ID_MSB_LOCATION ) |
+                                          ( ( pNaluData[ 1 ] & H265_NALU_HEADER_LAYER_ID_LSB_MASK ) >> H265_NALU_HEADER_LAYER_ID_LSB_LOCATION ) ) );
+        tid = H265_MIN( tid,
+                        pNaluData[ 1 ] & H265_NALU_HEADER_TID_MASK );
+
+        /* Write NALU size followed by the NALU. */
+        pPacket->pPacketData[ packetDataIndex ] = ( uint8_t ) ( naluDataLength >> 8 );
+        pPacket->pPacketData[ packetDataIndex + 1 ] = ( uint8_t ) ( naluDataLength & 0xFF );
+        packetDataIndex += H265_AP_NALU_SIZE;
+
+        memcpy( ( void * ) &( pPacket->pPacketData[ packetDataIndex ] ),
+                ( const void * ) &( pNaluData[ 0 ] ),
+                naluDataLength );
+        packetDataIndex += naluDataLength;
+
+        MoveToNextNalu( pCtx );
+    }
+
+    /* Write payload header. */
+    pPacket->pPacketData[ 0 ] = ( uint8_t ) ( forbiddenBit |
+                                              ( H265_AP_PACKET_TYPE << H265_NALU_HEADER_TYPE_LOCATION ) |
+                                              ( layerId >> H265_NALU_HEADER_LAYER_ID_MSB_LOCATION ) );
+    pPacket->pPacketData[ 1 ] = ( uint8_t ) ( ( ( layerId << H265_NALU_HEADER_LAYER_ID_LSB_LOCATION ) &
+                                                H265_NALU_HEADER_LAYER_ID_LSB_MASK ) |
+                                              tid );
+    pPacket->packetDataLength = packetDataIndex;
+}
+
+/*-----------------------------------------------------------*/
+
+static void PacketizeFragmentationUnitPacket( H265PacketizerContext_t * pCtx,
+                                              H265Packet_t * pPacket )
+{
+    uint8_t fuHeader = 0;
+    size_t maxNaluDataLengthToSend, naluDataLengthToSend;
+    uint8_t * pNaluData = pCtx->pNaluArray[ pCtx->tailIndex ].pNaluData;
+
+    /* Is this the first fragment? */
+    if( pCtx->currentlyProcessingPacket == H265_PACKET_NONE )
+    {
+        pCtx->currentlyProcessingPacket = H265_FU_PACKET;
+        pCtx->fuPacketizationState.naluHeader[ 0 ] = pNaluData[ 0 ];
+        pCtx->fuPacketizationState.naluHeader[ 1 ] = pNaluData[ 1 ];
+
+        /* Per RFC https://www.rfc-editor.org/rfc/rfc7798.html, we do not need
+         * to send NALU header in FU as the information can be constructed
+         * using payload header and FU header. */
+        pCtx->fuPacketizationState.naluDataIndex = H265_NALU_HEADER_SIZE;
+        pCtx->fuPacketizationState.remainingNaluLength = pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength -
+                                                         H265_NALU_HEADER_SIZE;
+
+        /* Indicate start fragment in the FU header. */
+        fuHeader |= H265_FU_HEADER_S_BIT_MASK;
+    }
+
+    /* Maximum NALU data that we can send in this packet. */
+    maxNaluDataLengthToSend = pPacket->packetDataLength - H265_FU_HEADER_SIZE;
+    /* Actual NALU data what we will send in this packet. */
+    naluDataLengthToSend = H265_MIN( maxNaluDataLengthToSend,
+                                     pCtx->fuPacketizationState.remainingNaluLength );
+
+    if( pCtx->fuPacketizationState.remainingNaluLength == naluDataLengthToSend )
+    {
+        /* Indicate end fragment in the FU header. */
+        fuHeader |= H265_FU_HEADER_E_BIT_MASK;
+    }
+
+    /* Write payload header and FU header. */
+    pPacket->pPacketData[ H265_FU_PAYLOAD_HEADER_OFFSET ] = ( uint8_t ) ( ( pCtx->fuPacketizationState.naluHeader[ 0 ] &
+                                                                           ( uint8_t ) ~H265_NALU_HEADER_TYPE_MASK ) |
+                                                                         ( H265_FU_PACKET_TYPE << H265_NALU_HEADER_TYPE_LOCATION ) );
+    pPacket->pPacketData[ H265_FU_PAYLOAD_HEADER_OFFSET + 1 ] = pCtx->fuPacketizationState.naluHeader[ 1 ];
+    pPacket->pPacketData[ H265_FU_HEADER_OFFSET ] = ( uint8_t ) ( fuHeader |
+                                                                  H265_NALU_HEADER_GET_TYPE( pCtx->fuPacketizationState.naluHeader ) );
+
+    /* Write FU payload. */
+    memcpy( ( void * ) &( pPacket->pPacketData[ H265_FU_PAYLOAD_OFFSET ] ),
+            ( const void * ) &( pNaluData[ pCtx->fuPacketizationState.naluDataIndex ] ),
+            naluDataLengthToSend );
+    pPacket->packetDataLength = naluDataLengthToSend + H265_FU_HEADER_SIZE;
+
+    pCtx->fuPacketizationState.naluDataIndex += naluDataLengthToSend;
+    pCtx->fuPacketizationState.remainingNaluLength -= naluDataLengthToSend;
+
+    if( pCtx->fuPacketizationState.remainingNaluLength == 0 )
+    {
+        /* Reset state. */
+        pCtx->fuPacketizationState.naluDataIndex = 0;
+        pCtx->fuPacketizationState.naluHeader[ 0 ] = 0;
+        pCtx->fuPacketizationState.naluHeader[ 1 ] = 0;
+        pCtx->currentlyProcessingPacket = H265_PACKET_NONE;
+
+        /* Move to the next NALU in the next call to H265Packetizer_GetPacket. */
+        MoveToNextNalu( pCtx );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+H265Result_t H265Packetizer_Init( H265PacketizerContext_t * pCtx,
+                                  H265Nalu_t * pNaluArray,
+                                  size_t naluArrayLength )
+{
+    H265Result_t result = H265_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pNaluArray == NULL ) ||
+        ( naluArrayLength == 0 ) )
+    {
+        result = H265_RESULT_BAD_PARAM;
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        pCtx->pNaluArray = pNaluArray;
+        pCtx->naluArrayLength = naluArrayLength;
+
+        pCtx->headIndex = 0;
+        pCtx->tailIndex = 0;
+        pCtx->naluCount = 0;
+
+        pCtx->currentlyProcessingPacket = H265_PACKET_NONE;
+        memset( &( pCtx->fuPacketizationState ),
+                0,
+                sizeof( H265FuPacketizationState_t ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H265Result_t H265Packetizer_AddFrame( H265PacketizerContext_t * pCtx,
+                                      H265Frame_t * pFrame )
+{
+    H265Result_t result = H265_RESULT_OK;
+    H265Nalu_t nalu;
+    size_t currentIndex = 0, naluStartIndex = 0, remainingFrameLength;
+    uint8_t startCode1[] = { 0x00, 0x00, 0x00, 0x01 };
+    uint8_t startCode2[] = { 0x00, 0x00, 0x01 };
+    uint8_t firstStartCode = 1;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pFrame->pFrameData == NULL ) ||
+        ( pFrame->frameDataLength == 0 ) )
+    {
+        result = H265_RESULT_BAD_PARAM;
+    }
+
+    while( ( result == H265_RESULT_OK ) &&
+           ( currentIndex < pFrame->frameDataLength ) )
+    {
+        remainingFrameLength = pFrame->frameDataLength - currentIndex;
+
+        /* Check the presence of 4 byte start code. */
+        if( remainingFrameLength >= sizeof( startCode1 ) )
+        {
+            if( memcmp( &( pFrame->pFrameData[ currentIndex ] ),
+                        &( startCode1[ 0 ] ),
+                        sizeof( startCode1 ) ) == 0 )
+            {
+                if( firstStartCode == 1 )
+                {
+                    firstStartCode = 0;
+                }
+                else
+                {
+                    nalu.pNaluData = &( pFrame->pFrameData[ naluStartIndex ] );
+                    nalu.naluDataLength = currentIndex - naluStartIndex;
+                    result = H265Packetizer_AddNalu( pCtx,
+                                                     &( nalu ) );
+                }
+
+                naluStartIndex = currentIndex + sizeof( startCode1 );
+                currentIndex = currentIndex + sizeof( startCode1 );
+                continue;
+            }
+        }
+
+        /* Check the presence of 3 byte start code. */
+        if( remainingFrameLength >= sizeof( startCode2 ) )
+        {
+            if( memcmp( &( pFrame->pFrameData[ currentIndex ] ),
+                        &( startCode2[ 0 ] ),
+                        sizeof( startCode2 ) ) == 0 )
+            {
+                if( firstStartCode == 1 )
+                {
+                    firstStartCode = 0;
+                }
+                else
+                {
+                    nalu.pNaluData = &( pFrame->pFrameData[ naluStartIndex ] );
+                    nalu.naluDataLength = currentIndex - naluStartIndex;
+                    result = H265Packetizer_AddNalu( pCtx,
+                                                     &( nalu ) );
+                }
+
+                naluStartIndex = currentIndex + sizeof( startCode2 );
+                currentIndex = currentIndex + sizeof( startCode2 );
+                continue;
+            }
+        }
+
+        currentIndex += 1;
+    }
+
+    if( ( result == H265_RESULT_OK ) &&
+        ( naluStartIndex > 0 ) )
+    {
+        nalu.pNaluData = &( pFrame->pFrameData[ naluStartIndex ] );
+        nalu.naluDataLength = pFrame->frameDataLength - naluStartIndex;
+        result = H265Packetizer_AddNalu( pCtx,
+                                         &( nalu ) );
+
+        if( result == H265_RESULT_OK )
+        {
+            result = H265Packetizer_EndFrame( pCtx );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H265Result_t H265Packetizer_AddNalu( H265PacketizerContext_t * pCtx,
+                                     H265Nalu_t * pNalu )
+{
+    H265Result_t result = H265_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pNalu == NULL ) ||
+        ( pNalu->pNaluData == NULL ) ||
+        ( pNalu->naluDataLength < H265_NALU_HEADER_SIZE ) )
+    {
+        result = H265_RESULT_BAD_PARAM;
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        if( pCtx->naluCount >= pCtx->naluArrayLength )
+        {
+            result = H265_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        pCtx->pNaluArray[ pCtx->headIndex ].pNaluData = pNalu->pNaluData;
+        pCtx->pNaluArray[ pCtx->headIndex ].naluDataLength = pNalu->naluDataLength;
+        pCtx->headIndex = ( pCtx->headIndex + 1 ) % pCtx->naluArrayLength;
+        pCtx->naluCount += 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H265Result_t H265Packetizer_EndFrame( H265PacketizerContext_t * pCtx )
+{
+    H265Result_t result = H265_RESULT_OK;
+
+    if( pCtx == NULL )
+    {
+        result = H265_RESULT_BAD_PARAM;
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        if( pCtx->naluCount >= pCtx->naluArrayLength )
+        {
+            result = H265_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        pCtx->pNaluArray[ pCtx->headIndex ].pNaluData = NULL;
+        pCtx->pNaluArray[ pCtx->headIndex ].naluDataLength = 0;
+        pCtx->headIndex = ( pCtx->headIndex + 1 ) % pCtx->naluArrayLength;
+        pCtx->naluCount += 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+H265Result_t H265Packetizer_GetPacket( H265PacketizerContext_t * pCtx,
+                                       H265Packet_t * pPacket )
+{
+    H265Result_t result = H265_RESULT_OK;
+    size_t aggregatableNaluCount;
+
+    if( ( pCtx == NULL ) ||
+        ( pPacket == NULL ) ||
+        ( pPacket->pPacketData == NULL ) ||
+        ( pPacket->packetDataLength <= H265_FU_HEADER_SIZE ) )
+    {
+        result = H265_RESULT_BAD_PARAM;
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        if( pCtx->naluCount == 0 )
+        {
+            result = H265_RESULT_NO_MORE_PACKETS;
+        }
+        else if( IS_FRAME_BOUNDARY( pCtx, pCtx->tailIndex ) )
+        {
+            /* The previous packet was the last one of the frame. */
+            MoveToNextNalu( pCtx );
+            result = H265_RESULT_NO_MORE_PACKETS;
+        }
+    }
+
+    if( result == H265_RESULT_OK )
+    {
+        /* Are we in the middle of packetizing fragments of a NALU? */
+        if( pCtx->currentlyProcessingPacket == H265_FU_PACKET )
+        {
+            /* Continue packetizing fragments. */
+            PacketizeFragmentationUnitPacket( pCtx,
+                                              pPacket );
+        }
+        else
+        {
+            aggregatableNaluCount = GetAggregatableNaluCount( pCtx,
+                                                              pPacket->packetDataLength );
+
+            /* If more than one NAL Units can fit in one packet, use
+             * Aggregation Packet. */
+            if( aggregatableNaluCount > 1 )
+            {
+                PacketizeAggregationPacket( pCtx,
+                                            pPacket,
+                                            aggregatableNaluCount );
+            }
+            /* If a NAL Unit can fit in one packet, use Single NAL Unit packet. */
+            else if( pCtx->pNaluArray[ pCtx->tailIndex ].naluDataLength <= pPacket->packetDataLength )
+            {
+                PacketizeSingleNaluPacket( pCtx,
+                                           pPacket );
+            }
+            else
+            {
+                /* Otherwise, fragment the NAL Unit in more than one packets. */
+                PacketizeFragmentationUnitPacket( pCtx,
+                                                  pPacket );
+            }
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,184 @@
+#ifndef H265_DATA_TYPES_H
+#define H265_DATA_TYPES_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * NAL Unit (NALU) Header:
+ *
+ * +---------------+---------------+
+ * |0|1|2|3|4|5|6|7|0|1|2|3|4|5|6|7|
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |F|   Type    |  LayerId  | TID |
+ * +-------------+-----------------+
+ */
+#define H265_NALU_HEADER_SIZE               2
+
+#define H265_NALU_HEADER_F_MASK                 0x80
+#define H265_NALU_HEADER_F_LOCATION             7
+
+#define H265_NALU_HEADER_TYPE_MASK              0x7E
+#define H265_NALU_HEADER_TYPE_LOCATION          1
+
+/* Most significant bit of LayerId is in the first byte of the header. */
+#define H265_NALU_HEADER_LAYER_ID_MSB_MASK      0x01
+#define H265_NALU_HEADER_LAYER_ID_MSB_LOCATION  5
+#define H265_NALU_HEADER_LAYER_ID_LSB_MASK      0xF8
+#define H265_NALU_HEADER_LAYER_ID_LSB_LOCATION  3
+
+#define H265_NALU_HEADER_TID_MASK               0x07
+#define H265_NALU_HEADER_TID_LOCATION           0
+
+#define H265_NALU_HEADER_GET_TYPE( pNaluHeader ) \
+    ( ( uint8_t ) ( ( ( pNaluHeader )[ 0 ] & H265_NALU_HEADER_TYPE_MASK ) >> H265_NALU_HEADER_TYPE_LOCATION ) )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * NAL Unit types.
+ */
+#define H265_SINGLE_NALU_PACKET_TYPE_START  0
+#define H265_SINGLE_NALU_PACKET_TYPE_END    47
+#define H265_AP_PACKET_TYPE                 48
+#define H265_FU_PACKET_TYPE                 49
+
+/* Intra Random Access Point (IRAP) pictures i.e. BLA, IDR and CRA. */
+#define H265_NALU_TYPE_IRAP_START           16
+#define H265_NALU_TYPE_IRAP_END             23
+#define H265_NALU_TYPE_VPS                  32
+#define H265_NALU_TYPE_SPS                  33
+#define H265_NALU_TYPE_PPS                  34
+
+/*-----------------------------------------------------------*/
+
+/*
+ * RTP payload format for FU:
+ *
+ *  0                   1                   2                   3
+ *  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |    PayloadHdr (Type=49)       |   FU header   |               |
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+               |
+ * |                                                               |
+ * |                         FU payload                            |
+ * |                                                               |
+ * |                               +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |                               :...OPTIONAL RTP padding        |
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *
+ * FU header:
+ *
+ * +---------------+
+ * |0|1|2|3|4|5|6|7|
+ * +-+-+-+-+-+-+-+-+
+ * |S|E|  FuType   |
+ * +---------------+
+ */
+#define H265_FU_HEADER_SIZE                 3
+
+#define H265_FU_PAYLOAD_HEADER_OFFSET       0
+#define H265_FU_HEADER_OFFSET               2
+#define H265_FU_PAYLOAD_OFFSET              3
+
+#define H265_FU_HEADER_TYPE_MASK            0x3F
+#define H265_FU_HEADER_TYPE_LOCATION        0
+
+#define H265_FU_HEADER_S_BIT_MASK           0x80
+#define H265_FU_HEADER_S_BIT_LOCATION       7
+
+#define H265_FU_HEADER_E_BIT_MASK           0x40
+#define H265_FU_HEADER_E_BIT_LOCATION       6
+
+/*-----------------------------------------------------------*/
+
+/*
+ * RTP payload format for AP (without DONL/DOND fields as sprop-max-don-diff
+ * is 0):
+ *
+ *  0                   1                   2                   3
+ *  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |    PayloadHdr (Type=48)       |         NALU 1 Size           |
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |          NALU 1 HDR           |                               |
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+         NALU 1 Data           |
+ * |                   . . .                                       |
+ * |                                                               |
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |  . . .                        |         NALU 2 Size           |
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |          NALU 2 HDR           |                               |
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+         NALU 2 Data           |
+ * |                   . . .                                       |
+ * |                               +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |                               :...OPTIONAL RTP padding        |
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ */
+#define H265_AP_HEADER_SIZE                 2
+#define H265_AP_NALU_SIZE                   2
+
+/*-----------------------------------------------------------*/
+
+/* Packet properties, used in H265Depacketizer_GetPacketProperties. */
+#define H265_PACKET_PROPERTY_START_PACKET   ( 1 << 0 )
+#define H265_PACKET_PROPERTY_END_PACKET     ( 1 << 1 )
+/* Packet starts an IRAP picture or carries a VPS or an SPS. */
+#define H265_PACKET_PROPERTY_KEYFRAME       ( 1 << 2 )
+#define H265_PACKET_PROPERTY_VPS            ( 1 << 3 )
+#define H265_PACKET_PROPERTY_SPS            ( 1 << 4 )
+#define H265_PACKET_PROPERTY_PPS            ( 1 << 5 )
+/* Packet carries an IRAP slice or a fragment of it. */
+#define H265_PACKET_PROPERTY_IRAP           ( 1 << 6 )
+
+/*-----------------------------------------------------------*/
+
+#define H265_MIN( a, b ) ( ( a ) < ( b ) ? ( a ) : ( b ) )
+#define H265_MAX( a, b ) ( ( a ) > ( b ) ? ( a ) : ( b ) )
+
+/*-----------------------------------------------------------*/
+
+typedef enum H265Result
+{
+    H265_RESULT_OK,
+    H265_RESULT_BAD_PARAM,
+    H265_RESULT_OUT_OF_MEMORY,
+    H265_RESULT_NO_MORE_PACKETS,
+    H265_RESULT_NO_MORE_NALUS,
+    H265_RESULT_NO_MORE_FRAMES,
+    H265_RESULT_MALFORMED_PACKET,
+    H265_RESULT_UNSUPPORTED_PACKET
+} H265Result_t;
+
+typedef enum H265PacketType
+{
+    H265_PACKET_NONE,
+    H265_SINGLE_NALU_PACKET,
+    H265_AP_PACKET,
+    H265_FU_PACKET
+} H265PacketType_t;
+
+/*-----------------------------------------------------------*/
+
+typedef struct H265Packet
+{
+    uint8_t * pPacketData;
+    size_t packetDataLength;
+} H265Packet_t;
+
+typedef struct H265Nalu
+{
+    uint8_t * pNaluData;
+    size_t naluDataLength;
+} H265Nalu_t;
+
+typedef struct H265Frame
+{
+    uint8_t * pFrameData;
+    size_t frameDataLength;
+} H265Frame_t;
+
+/*-----------------------------------------------------------*/
+
+#endif /* H265_DATA_TYPES_H */
@@ -0,0 +1,42 @@
+#ifndef H265_DEPACKETIZER_H
+#define H265_DEPACKETIZER_H
+
+/* Data types includes. */
+#include "h265_data_types.h"
+
+typedef struct H265DepacketizerContext
+{
+    H265Packet_t * pPacketsArray;
+    size_t packetsArrayLength;
+    size_t headIndex;
+    size_t tailIndex;
+    size_t curPacketIndex;
+    size_t packetCount;
+} H265DepacketizerContext_t;
+
+H265Result_t H265Depacketizer_Init( H265DepacketizerContext_t * pCtx,
+                                    H265Packet_t * pPacketsArray,
+                                    size_t packetsArrayLength );
+
+H265Result_t H265Depacketizer_AddPacket( H265DepacketizerContext_t * pCtx,
+                                         const H265Packet_t * pPacket );
+
+/* Marks the end of the current frame. The packets array is used as a ring so
+ * packets of the next frames can be added before the current frame is read.
+ * The frame end takes one entry in the packets array. */
+H265Result_t H265Depacketizer_EndFrame( H265DepacketizerContext_t * pCtx );
+
+H265Result_t H265Depacketizer_GetNalu( H265DepacketizerContext_t * pCtx,
+                                       H265Nalu_t * pNalu );
+
+/* It returns the packets up to the next frame end marked using
+ * H265Depacketizer_EndFrame, or all the packets added if none is marked, as
+ * one frame. It also adds start codes to separate NALUs. */
+H265Result_t H265Depacketizer_GetFrame( H265DepacketizerContext_t * pCtx,
+                                        H265Frame_t * pFrame );
+
+H265Result_t H265Depacketizer_GetPacketProperties( const uint8_t * pPacketData,
+                                                   const size_t packetDataLength,
+                                                   uint32_t * pProperties );
+
+#endif /* H265_DEPACKETIZER_H */
@@ -0,0 +1,20 @@
+#ifndef H265_INTERFACE_H
+#define H265_INTERFACE_H
+
+/* API includes. */
+#include "codec_interface.h"
+#include "h265_packetizer.h"
+#include "h265_depacketizer.h"
+
+/* Binds an H.265 packetizer context to the common packetizer interface.
+ * pCtx must be initialized with H265Packetizer_Init. Frames are added
+ * with H265Packetizer_AddFrame. */
+CodecResult_t H265Interface_InitPacketizer( CodecPacketizer_t * pPacketizer,
+                                            H265PacketizerContext_t * pCtx );
+
+/* Binds an H.265 depacketizer context to the common depacketizer interface.
+ * pCtx must be initialized with H265Depacketizer_Init. */
+CodecResult_t H265Interface_InitDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                              H265DepacketizerContext_t * pCtx );
+
+#endif /* H265_INTERFACE_H */
@@ -0,0 +1,52 @@
+#ifndef H265_PACKETIZER_H
+#define H265_PACKETIZER_H
+
+/* Data types includes. */
+#include "h265_data_types.h"
+
+typedef struct H265FuPacketizationState
+{
+    uint8_t naluHeader[ H265_NALU_HEADER_SIZE ];
+    size_t naluDataIndex;
+    size_t remainingNaluLength;
+} H265FuPacketizationState_t;
+
+typedef struct H265PacketizerContext
+{
+    H265Nalu_t * pNaluArray;
+    size_t naluArrayLength;
+    size_t headIndex;
+    size_t tailIndex;
+    size_t naluCount;
+    H265PacketType_t currentlyProcessingPacket;
+    H265FuPacketizationState_t fuPacketizationState;
+} H265PacketizerContext_t;
+
+H265Result_t H265Packetizer_Init( H265PacketizerContext_t * pCtx,
+                                  H265Nalu_t * pNaluArray,
+                                  size_t naluArrayLength );
+
+/* A frame comprising of multiple NALUs separated by start codes. The end of
+ * the frame is marked as with H265Packetizer_EndFrame. */
+H265Result_t H265Packetizer_AddFrame( H265PacketizerContext_t * pCtx,
+                                      H265Frame_t * pFrame );
+
+H265Result_t H265Packetizer_AddNalu( H265PacketizerContext_t * pCtx,
+                                     H265Nalu_t * pNalu );
+
+/* Marks the end of the current frame (access unit) after its NALUs are added
+ * using H265Packetizer_AddNalu, so that NALUs of the next frames can be added
+ * before the packets of the current frame are retrieved. The frame end takes
+ * one entry in the NALU array. */
+H265Result_t H265Packetizer_EndFrame( H265PacketizerContext_t * pCtx );
+
+/* Consecutive NALUs which fit together in one packet are sent in an
+ * Aggregation Packet (AP), NALUs larger than the packet are fragmented in
+ * Fragmentation Units (FU) and others are sent as single NALU packets. An AP
+ * never spans a frame end. H265_RESULT_NO_MORE_PACKETS is returned once at
+ * each frame end, so the packet before it is the last one of the frame and
+ * gets the RTP marker bit. */
+H265Result_t H265Packetizer_GetPacket( H265PacketizerContext_t * pCtx,
+                                       H265Packet_t * pPacket );
+
+#endif /* H265_PACKETIZER_H */
@@ -5,8 +5,73 @@
 #include <stdint.h>
 #include <stddef.h>
 
+/* API includes. */
+#include "codec_interface.h"
+
+/*
+ * Opus TOC byte:
+ *
+ *        0 1 2 3 4 5 6 7
+ *       +-+-+-+-+-+-+-+-+
+ *       | config  |s| c |
+ *       +-+-+-+-+-+-+-+-+
+ *
+ * Frame count byte, present when c = 3:
+ *
+ *        0 1 2 3 4 5 6 7
+ *       +-+-+-+-+-+-+-+-+
+ *       |v|p|     M     |
+ *       +-+-+-+-+-+-+-+-+
+ */
+#define OPUS_TOC_OFFSET                     0
+
+#define OPUS_TOC_CONFIG_BITMASK             0xF8
+#define OPUS_TOC_CONFIG_LOCATION            3
+
+#define OPUS_TOC_S_BITMASK                  0x04
+#define OPUS_TOC_S_LOCATION                 2
+
+#define OPUS_TOC_CODE_BITMASK               0x03
+#define OPUS_TOC_CODE_LOCATION              0
+
+#define OPUS_FRAME_COUNT_V_BITMASK          0x80
+#define OPUS_FRAME_COUNT_V_LOCATION         7
+
+#define OPUS_FRAME_COUNT_P_BITMASK          0x40
+#define OPUS_FRAME_COUNT_P_LOCATION         6
+
+#define OPUS_FRAME_COUNT_M_BITMASK          0x3F
+#define OPUS_FRAME_COUNT_M_LOCATION         0
+
+/* Frame count codes. */
+#define OPUS_CODE_ONE_FRAME                 0
+#define OPUS_CODE_TWO_EQUAL_FRAMES          1
+#define OPUS_CODE_TWO_FRAMES                2
+#define OPUS_CODE_ARBITRARY_FRAMES          3
+
+#define OPUS_MAX_FRAME_LENGTH               1275
+#define OPUS_MAX_PACKET_DURATION_SAMPLES    5760 /* 120 ms at 48 kHz. */
+
+/* A DTX (silence) packet carries the TOC byte and at most one more byte. */
+#define OPUS_DTX_MAX_PACKET_LENGTH          2
+
+/* Audio bandwidth, derived from the TOC config. */
+#define OPUS_BANDWIDTH_NARROWBAND           0
+#define OPUS_BANDWIDTH_MEDIUMBAND           1
+#define OPUS_BANDWIDTH_WIDEBAND             2
+#define OPUS_BANDWIDTH_SUPERWIDEBAND        3
+#define OPUS_BANDWIDTH_FULLBAND             4
+
 /* Packet properties, used in OPUSDepacketizer_GetPacketProperties. */
 #define OPUS_PACKET_PROPERTY_START_PACKET   ( 1 << 0 )
+#define OPUS_PACKET_PROPERTY_DTX            ( 1 << 1 )
+#define OPUS_PACKET_PROPERTY_STEREO         ( 1 << 2 )
+
+#define OPUS_PACKET_PROPERTY_BANDWIDTH_BITMASK  0x70
+#define OPUS_PACKET_PROPERTY_BANDWIDTH_LOCATION 4
+
+#define OPUS_PACKET_PROPERTY_GET_BANDWIDTH( properties ) \
+    ( ( ( properties ) & OPUS_PACKET_PROPERTY_BANDWIDTH_BITMASK ) >> OPUS_PACKET_PROPERTY_BANDWIDTH_LOCATION )
 
 /*-----------------------------------------------------------*/
 
@@ -20,22 +85,27 @@ typedef enum OpusResult
     OPUS_RESULT_OK,
     OPUS_RESULT_BAD_PARAM,
     OPUS_RESULT_OUT_OF_MEMORY,
-    OPUS_RESULT_NO_MORE_PACKETS
+    OPUS_RESULT_NO_MORE_PACKETS,
+    OPUS_RESULT_MALFORMED_PACKET
 } OpusResult_t;
 
 /*-----------------------------------------------------------*/
 
-typedef struct OpusPacket
-{
-    uint8_t * pPacketData;
-    size_t packetDataLength;
-} OpusPacket_t;
+/* Same as the common codec types so that packets are stored in the simple
+ * payload assembler directly. */
+typedef CodecPacket_t OpusPacket_t;
+typedef CodecFrame_t OpusFrame_t;
 
-typedef struct OpusFrame
+typedef struct OpusTocInfo
 {
-    uint8_t * pFrameData;
-    size_t frameDataLength;
-} OpusFrame_t;
+    uint8_t config;
+    uint8_t isStereo;
+    uint8_t bandwidth;
+    uint8_t frameCountCode;
+    size_t frameCount;
+    uint32_t frameDurationSamples;  /* At 48 kHz. */
+    uint32_t packetDurationSamples; /* At 48 kHz. */
+} OpusTocInfo_t;
 
 /*-----------------------------------------------------------*/
 
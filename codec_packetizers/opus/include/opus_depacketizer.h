@@ -3,12 +3,12 @@
 
 /* Data types includes. */
 #include "opus_data_types.h"
+#include "simple_payload_assembler.h"
+#include "opus_toc.h"
 
 typedef struct OpusDePacketizerContext
 {
-    OpusPacket_t * pPacketsArray;
-    size_t packetsArrayLength;
-    size_t packetCount;
+    SimplePayloadAssembler_t assembler;
 } OpusDepacketizerContext_t;
 
 OpusResult_t OpusDepacketizer_Init( OpusDepacketizerContext_t * pCtx,
@@ -18,9 +18,17 @@ OpusResult_t OpusDepacketizer_Init( OpusDepacketizerContext_t * pCtx,
 OpusResult_t OpusDepacketizer_AddPacket( OpusDepacketizerContext_t * pCtx,
                                          const OpusPacket_t * pPacket );
 
+/* Returns one Opus frame (complete Opus packet) per call in the order the
+ * packets were added. */
 OpusResult_t OpusDepacketizer_GetFrame( OpusDepacketizerContext_t * pCtx,
                                         OpusFrame_t * pFrame );
 
+/* Same as OpusDepacketizer_GetFrame and also returns the parsed TOC, which
+ * carries the frame duration in samples at 48 kHz. */
+OpusResult_t OpusDepacketizer_GetFrameWithTocInfo( OpusDepacketizerContext_t * pCtx,
+                                                   OpusFrame_t * pFrame,
+                                                   OpusTocInfo_t * pTocInfo );
+
 OpusResult_t OpusDepacketizer_GetPacketProperties( const uint8_t * pPacketData,
                                                    const size_t packetDataLength,
                                                    uint32_t * pProperties );
@@ -0,0 +1,19 @@
+#ifndef OPUS_INTERFACE_H
+#define OPUS_INTERFACE_H
+
+/* API includes. */
+#include "codec_interface.h"
+#include "opus_packetizer.h"
+#include "opus_depacketizer.h"
+
+/* Binds a Opus packetizer context to the common packetizer interface.
+ * Each Opus packet is added with OpusPacketizer_Init. */
+CodecResult_t OpusInterface_InitPacketizer( CodecPacketizer_t * pPacketizer,
+                                            OpusPacketizerContext_t * pCtx );
+
+/* Binds a Opus depacketizer context to the common depacketizer interface.
+ * pCtx must be initialized with OpusDepacketizer_Init. */
+CodecResult_t OpusInterface_InitDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                              OpusDepacketizerContext_t * pCtx );
+
+#endif /* OPUS_INTERFACE_H */
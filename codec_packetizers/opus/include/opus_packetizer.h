@@ -3,13 +3,19 @@
 
 /* Data types includes. */
 #include "opus_data_types.h"
+#include "opus_toc.h"
 
 typedef struct OpusPacketizerContext
 {
     OpusFrame_t frame;
     size_t curFrameDataIndex;
+    OpusTocInfo_t tocInfo;
 } OpusPacketizerContext_t;
 
+/* An Opus frame here is one complete Opus packet (TOC byte and frames) which is
+ * always sent in a single RTP packet (RFC 7587). tocInfo in the context reports
+ * its duration, in samples at 48 kHz, after a successful init. */
+
 OpusResult_t OpusPacketizer_Init( OpusPacketizerContext_t * pCtx,
                                   OpusFrame_t * pFrame );
 
@@ -0,0 +1,16 @@
+#ifndef OPUS_TOC_H
+#define OPUS_TOC_H
+
+/* Data types includes. */
+#include "opus_data_types.h"
+
+/* Parses the TOC byte and validates the packet structure as per RFC 6716
+ * section 3.4. Durations are in samples at 48 kHz. */
+OpusResult_t OpusToc_Parse( const uint8_t * pPacketData,
+                            size_t packetDataLength,
+                            OpusTocInfo_t * pTocInfo );
+
+/* Returns the OPUS_BANDWIDTH_* value for a TOC config. */
+uint8_t OpusToc_GetBandwidth( uint8_t config );
+
+#endif /* OPUS_TOC_H */
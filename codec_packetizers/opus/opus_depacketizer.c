@@ -4,24 +4,48 @@
 /* API includes. */
 #include "opus_depacketizer.h"
 
+static OpusResult_t ToOpusResult( CodecResult_t result );
+
+/*-----------------------------------------------------------*/
+
+/* In the order of CodecResult_t, for the results returned by the simple
+ * payload assembler. */
+static const uint32_t resultMap[] =
+{
+    OPUS_RESULT_OK,
+    OPUS_RESULT_BAD_PARAM,
+    OPUS_RESULT_OUT_OF_MEMORY,
+    OPUS_RESULT_NO_MORE_PACKETS
+};
+
+/*-----------------------------------------------------------*/
+
+static OpusResult_t ToOpusResult( CodecResult_t result )
+{
+    return ( OpusResult_t ) SimplePayloadAssembler_MapResult( result,
+                                                              &( resultMap[ 0 ] ),
+                                                              sizeof( resultMap ) / sizeof( resultMap[ 0 ] ),
+                                                              OPUS_RESULT_MALFORMED_PACKET );
+}
+
+/*-----------------------------------------------------------*/
+
 OpusResult_t OpusDepacketizer_Init( OpusDepacketizerContext_t * pCtx,
                                     OpusPacket_t * pPacketsArray,
                                     size_t packetsArrayLength )
 {
     OpusResult_t result = OPUS_RESULT_OK;
 
-    if( ( pCtx == NULL ) ||
-        ( pPacketsArray == NULL ) ||
-        ( packetsArrayLength == 0 ) )
+    if( pCtx == NULL )
     {
         result = OPUS_RESULT_BAD_PARAM;
     }
 
     if( result == OPUS_RESULT_OK )
     {
-        pCtx->pPacketsArray = pPacketsArray;
-        pCtx->packetsArrayLength = packetsArrayLength;
-        pCtx->packetCount = 0;
+        result = ToOpusResult( SimplePayloadAssembler_Init( &( pCtx->assembler ),
+                                                            pPacketsArray,
+                                                            packetsArrayLength ) );
     }
 
     return result;
@@ -43,17 +67,8 @@ OpusResult_t OpusDepacketizer_AddPacket( OpusDepacketizerContext_t * pCtx,
 
     if( result == OPUS_RESULT_OK )
     {
-        if( pCtx->packetCount >= pCtx->packetsArrayLength )
-        {
-            result = OPUS_RESULT_OUT_OF_MEMORY;
-        }
-    }
-
-    if( result == OPUS_RESULT_OK )
-    {
-        pCtx->pPacketsArray[ pCtx->packetCount ].pPacketData = pPacket->pPacketData;
-        pCtx->pPacketsArray[ pCtx->packetCount ].packetDataLength = pPacket->packetDataLength;
-        pCtx->packetCount += 1;
+        result = ToOpusResult( SimplePayloadAssembler_AddPacket( &( pCtx->assembler ),
+                                                                 pPacket ) );
     }
 
     return result;
@@ -63,40 +78,41 @@ OpusResult_t OpusDepacketizer_AddPacket( OpusDepacketizerContext_t * pCtx,
 
 OpusResult_t OpusDepacketizer_GetFrame( OpusDepacketizerContext_t * pCtx,
                                         OpusFrame_t * pFrame )
+{
+    OpusTocInfo_t tocInfo;
+
+    return OpusDepacketizer_GetFrameWithTocInfo( pCtx,
+                                                 pFrame,
+                                                 &( tocInfo ) );
+}
+
+/*-----------------------------------------------------------*/
+
+OpusResult_t OpusDepacketizer_GetFrameWithTocInfo( OpusDepacketizerContext_t * pCtx,
+                                                   OpusFrame_t * pFrame,
+                                                   OpusTocInfo_t * pTocInfo )
 {
     OpusResult_t result = OPUS_RESULT_OK;
-    size_t i, currentFrameDataIndex = 0;
-    OpusPacket_t * pPacket;
+    OpusPacket_t packet;
 
     if( ( pCtx == NULL ) ||
         ( pFrame == NULL ) ||
         ( pFrame->pFrameData == NULL ) ||
-        ( pFrame->frameDataLength == 0 ) )
+        ( pFrame->frameDataLength == 0 ) ||
+        ( pTocInfo == NULL ) )
     {
         result = OPUS_RESULT_BAD_PARAM;
     }
 
     if( result == OPUS_RESULT_OK )
     {
-        if( pCtx->packetCount == 0 )
-        {
-            result = OPUS_RESULT_NO_MORE_PACKETS;
-        }
+        result = ToOpusResult( SimplePayloadAssembler_PeekPacket( &( pCtx->assembler ),
+                                                                  &( packet ) ) );
     }
 
-    for( i = 0; ( result == OPUS_RESULT_OK ) && ( i < pCtx->packetCount ); i++ )
+    if( result == OPUS_RESULT_OK )
     {
-        pPacket = &( pCtx->pPacketsArray[ i ] );
-
-        if( ( pFrame->frameDataLength - currentFrameDataIndex ) >= pPacket->packetDataLength )
-        {
-            memcpy( ( void * ) &( pFrame->pFrameData[ currentFrameDataIndex ] ),
-                    ( const void * ) &( pPacket->pPacketData[ 0 ] ),
-                    pPacket->packetDataLength );
-
-            currentFrameDataIndex += pPacket->packetDataLength;
-        }
-        else
+        if( pFrame->frameDataLength < packet.packetDataLength )
         {
             result = OPUS_RESULT_OUT_OF_MEMORY;
         }
@@ -104,7 +120,22 @@ OpusResult_t OpusDepacketizer_GetFrame( OpusDepacketizerContext_t * pCtx,
 
     if( result == OPUS_RESULT_OK )
     {
-        pFrame->frameDataLength = currentFrameDataIndex;
+        /* Malformed packets are consumed so that the next call moves on. */
+        ( void ) SimplePayloadAssembler_GetPacket( &( pCtx->assembler ),
+                                                   &( packet ) );
+
+        result = OpusToc_Parse( packet.pPacketData,
+                                packet.packetDataLength,
+                                pTocInfo );
+    }
+
+    if( result == OPUS_RESULT_OK )
+    {
+        memcpy( ( void * ) &( pFrame->pFrameData[ 0 ] ),
+                ( const void * ) &( packet.pPacketData[ 0 ] ),
+                packet.packetDataLength );
+
+        pFrame->frameDataLength = packet.packetDataLength;
     }
 
     return result;
@@ -117,6 +148,7 @@ OpusResult_t OpusDepacketizer_GetPacketProperties( const uint8_t * pPacketData,
                                                    uint32_t * pProperties )
 {
     OpusResult_t result = OPUS_RESULT_OK;
+    uint8_t toc, bandwidth;
 
     if( ( pPacketData == NULL ) ||
         ( pProperties == NULL ) ||
@@ -128,6 +160,24 @@ OpusResult_t OpusDepacketizer_GetPacketProperties( const uint8_t * pPacketData,
     if( result == OPUS_RESULT_OK )
     {
         *pProperties = OPUS_PACKET_PROPERTY_START_PACKET;
+
+        /* Only the TOC byte is read so that silent streams can be dropped
+         * without parsing the packet. */
+        toc = pPacketData[ OPUS_TOC_OFFSET ];
+        bandwidth = OpusToc_GetBandwidth( ( toc & OPUS_TOC_CONFIG_BITMASK ) >> OPUS_TOC_CONFIG_LOCATION );
+
+        *pProperties |= ( ( uint32_t ) bandwidth << OPUS_PACKET_PROPERTY_BANDWIDTH_LOCATION ) &
+                        OPUS_PACKET_PROPERTY_BANDWIDTH_BITMASK;
+
+        if( ( toc & OPUS_TOC_S_BITMASK ) != 0 )
+        {
+            *pProperties |= OPUS_PACKET_PROPERTY_STEREO;
+        }
+
+        if( packetDataLength <= OPUS_DTX_MAX_PACKET_LENGTH )
+        {
+            *pProperties |= OPUS_PACKET_PROPERTY_DTX;
+        }
     }
 
     return result;
@@ -0,0 +1,73 @@
+/* API includes. */
+#include "opus_interface.h"
+#include "codec_interface_adapter.h"
+
+/*-----------------------------------------------------------*/
+
+/* In the order of OpusResult_t. */
+static const CodecResult_t resultMap[] =
+{
+    CODEC_RESULT_OK,
+    CODEC_RESULT_BAD_PARAM,
+    CODEC_RESULT_OUT_OF_MEMORY,
+    CODEC_RESULT_NO_MORE_PACKETS,
+    CODEC_RESULT_MALFORMED_PACKET
+};
+
+/*-----------------------------------------------------------*/
+
+CODEC_INTERFACE_DEFINE_ADD_FRAME( AddFrame,
+                                  OpusPacketizerContext_t,
+                                  OpusFrame_t,
+                                  OpusPacketizer_Init,
+                                  resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_PACKET( GetPacket,
+                                   OpusPacketizerContext_t,
+                                   OpusPacket_t,
+                                   OpusPacketizer_GetPacket,
+                                   resultMap )
+
+CODEC_INTERFACE_DEFINE_ADD_PACKET( AddPacket,
+                                   OpusDepacketizerContext_t,
+                                   OpusPacket_t,
+                                   OpusDepacketizer_AddPacket,
+                                   resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_FRAME( GetFrame,
+                                  OpusDepacketizerContext_t,
+                                  OpusFrame_t,
+                                  OpusDepacketizer_GetFrame,
+                                  resultMap )
+
+/* Every packet begins a frame. */
+CODEC_INTERFACE_DEFINE_GET_PACKET_PROPERTIES_WITH_FRAME_START( GetPacketProperties,
+                                                               OpusDepacketizer_GetPacketProperties,
+                                                               resultMap,
+                                                               0,
+                                                               0 )
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t OpusInterface_InitPacketizer( CodecPacketizer_t * pPacketizer,
+                                            OpusPacketizerContext_t * pCtx )
+{
+    return CodecInterface_BindPacketizer( pPacketizer,
+                                          ( void * ) pCtx,
+                                          AddFrame,
+                                          GetPacket );
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t OpusInterface_InitDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                              OpusDepacketizerContext_t * pCtx )
+{
+    return CodecInterface_BindDepacketizer( pDepacketizer,
+                                            ( void * ) pCtx,
+                                            AddPacket,
+                                            GetFrame,
+                                            GetPacketProperties );
+}
+
+/*-----------------------------------------------------------*/
@@ -19,6 +19,13 @@ OpusResult_t OpusPacketizer_Init( OpusPacketizerContext_t * pCtx,
         result = OPUS_RESULT_BAD_PARAM;
     }
 
+    if( result == OPUS_RESULT_OK )
+    {
+        result = OpusToc_Parse( pFrame->pFrameData,
+                                pFrame->frameDataLength,
+                                &( pCtx->tocInfo ) );
+    }
+
     if( result == OPUS_RESULT_OK )
     {
         pCtx->frame.pFrameData = pFrame->pFrameData;
@@ -35,7 +42,6 @@ OpusResult_t OpusPacketizer_GetPacket( OpusPacketizerContext_t * pCtx,
                                        OpusPacket_t * pPacket )
 {
     OpusResult_t result = OPUS_RESULT_OK;
-    size_t frameDataLengthToSend;
 
     if( ( pCtx == NULL ) ||
         ( pPacket == NULL ) ||
@@ -52,17 +58,23 @@ OpusResult_t OpusPacketizer_GetPacket( OpusPacketizerContext_t * pCtx,
         }
     }
 
+    /* An Opus packet must not be split across RTP packets. */
     if( result == OPUS_RESULT_OK )
     {
-        frameDataLengthToSend = OPUS_MIN( pPacket->packetDataLength,
-                                          pCtx->frame.frameDataLength - pCtx->curFrameDataIndex );
+        if( pPacket->packetDataLength < pCtx->frame.frameDataLength )
+        {
+            result = OPUS_RESULT_OUT_OF_MEMORY;
+        }
+    }
 
+    if( result == OPUS_RESULT_OK )
+    {
         memcpy( ( void * ) &( pPacket->pPacketData[ 0 ] ),
-                ( const void * ) &( pCtx->frame.pFrameData[ pCtx->curFrameDataIndex ] ),
-                frameDataLengthToSend );
+                ( const void * ) &( pCtx->frame.pFrameData[ 0 ] ),
+                pCtx->frame.frameDataLength );
 
-        pPacket->packetDataLength = frameDataLengthToSend;
-        pCtx->curFrameDataIndex += frameDataLengthToSend;
+        pPacket->packetDataLength = pCtx->frame.frameDataLength;
+        pCtx->curFrameDataIndex = pCtx->frame.frameDataLength;
     }
 
     return result;
@@ -0,0 +1,289 @@
+/* API includes. */
+#include "opus_toc.h"
+
+static uint32_t GetFrameDurationSamples( uint8_t config );
+
+static size_t ReadFrameLength( const uint8_t * pBuffer,
+                               size_t bufferLength,
+                               size_t * pFrameLength );
+
+static OpusResult_t ValidateArbitraryFrames( const uint8_t * pPacketData,
+                                             size_t packetDataLength,
+                                             OpusTocInfo_t * pTocInfo );
+
+/*-----------------------------------------------------------*/
+
+static uint32_t GetFrameDurationSamples( uint8_t config )
+{
+    uint32_t frameDurationSamples;
+
+    if( config < 12 )
+    {
+        /* SILK - 10, 20, 40 or 60 ms. */
+        if( ( config % 4 ) == 3 )
+        {
+            frameDurationSamples = 2880;
+        }
+        else
+        {
+            frameDurationSamples = 480U << ( config % 4 );
+        }
+    }
+    else if( config < 16 )
+    {
+        /* Hybrid - 10 or 20 ms. */
+        frameDurationSamples = 480U << ( config % 2 );
+    }
+    else
+    {
+        /* CELT - 2.5, 5, 10 or 20 ms. */
+        frameDurationSamples = 120U << ( config % 4 );
+    }
+
+    return frameDurationSamples;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Returns the number of bytes used by the frame length or 0 if the buffer is
+ * too short. */
+static size_t ReadFrameLength( const uint8_t * pBuffer,
+                               size_t bufferLength,
+                               size_t * pFrameLength )
+{
+    size_t lengthSize = 0;
+
+    if( bufferLength >= 1 )
+    {
+        if( pBuffer[ 0 ] < 252 )
+        {
+            *pFrameLength = pBuffer[ 0 ];
+            lengthSize = 1;
+        }
+        else if( bufferLength >= 2 )
+        {
+            *pFrameLength = pBuffer[ 0 ] + ( 4 * ( size_t ) pBuffer[ 1 ] );
+            lengthSize = 2;
+        }
+    }
+
+    return lengthSize;
+}
+
+/*-----------------------------------------------------------*/
+
+static OpusResult_t ValidateArbitraryFrames( const uint8_t * pPacketData,
+                                             size_t packetDataLength,
+                                             OpusTocInfo_t * pTocInfo )
+{
+    OpusResult_t result = OPUS_RESULT_OK;
+    size_t curIndex = OPUS_TOC_OFFSET + 2, paddingLength = 0, lengthSize;
+    size_t i, frameLength = 0, totalFrameLength = 0, remainingLength;
+    uint8_t frameCountByte = 0, isMorePadding;
+
+    if( packetDataLength < curIndex )
+    {
+        result = OPUS_RESULT_MALFORMED_PACKET;
+    }
+
+    if( result == OPUS_RESULT_OK )
+    {
+        frameCountByte = pPacketData[ OPUS_TOC_OFFSET + 1 ];
+        pTocInfo->frameCount = ( frameCountByte & OPUS_FRAME_COUNT_M_BITMASK ) >> OPUS_FRAME_COUNT_M_LOCATION;
+
+        if( ( pTocInfo->frameCount == 0 ) ||
+            ( ( pTocInfo->frameCount * pTocInfo->frameDurationSamples ) > OPUS_MAX_PACKET_DURATION_SAMPLES ) )
+        {
+            result = OPUS_RESULT_MALFORMED_PACKET;
+        }
+    }
+
+    /* Padding length bytes - 255 means 254 bytes of padding and another
+     * padding length byte. */
+    if( ( result == OPUS_RESULT_OK ) &&
+        ( ( frameCountByte & OPUS_FRAME_COUNT_P_BITMASK ) != 0 ) )
+    {
+        isMorePadding = 1;
+
+        while( ( result == OPUS_RESULT_OK ) && ( isMorePadding == 1 ) )
+        {
+            if( curIndex >= packetDataLength )
+            {
+                result = OPUS_RESULT_MALFORMED_PACKET;
+            }
+            else
+            {
+                isMorePadding = ( pPacketData[ curIndex ] == 255 ) ? 1 : 0;
+                paddingLength += ( isMorePadding == 1 ) ? 254 : pPacketData[ curIndex ];
+                curIndex += 1;
+            }
+        }
+    }
+
+    if( result == OPUS_RESULT_OK )
+    {
+        if( ( packetDataLength - curIndex ) < paddingLength )
+        {
+            result = OPUS_RESULT_MALFORMED_PACKET;
+        }
+    }
+
+    if( result == OPUS_RESULT_OK )
+    {
+        if( ( frameCountByte & OPUS_FRAME_COUNT_V_BITMASK ) != 0 )
+        {
+            /* VBR - lengths of all frames but the last one. */
+            for( i = 0; ( result == OPUS_RESULT_OK ) && ( i < ( pTocInfo->frameCount - 1 ) ); i++ )
+            {
+                lengthSize = ReadFrameLength( &( pPacketData[ curIndex ] ),
+                                              packetDataLength - paddingLength - curIndex,
+                                              &( frameLength ) );
+
+                if( ( lengthSize == 0 ) ||
+                    ( frameLength > OPUS_MAX_FRAME_LENGTH ) )
+                {
+                    result = OPUS_RESULT_MALFORMED_PACKET;
+                }
+                else
+                {
+                    curIndex += lengthSize;
+                    totalFrameLength += frameLength;
+                }
+            }
+
+            if( result == OPUS_RESULT_OK )
+            {
+                remainingLength = packetDataLength - paddingLength - curIndex;
+
+                if( ( totalFrameLength > remainingLength ) ||
+                    ( ( remainingLength - totalFrameLength ) > OPUS_MAX_FRAME_LENGTH ) )
+                {
+                    result = OPUS_RESULT_MALFORMED_PACKET;
+                }
+            }
+        }
+        else
+        {
+            /* CBR - all frames have the same length. */
+            remainingLength = packetDataLength - paddingLength - curIndex;
+
+            if( ( ( remainingLength % pTocInfo->frameCount ) != 0 ) ||
+                ( ( remainingLength / pTocInfo->frameCount ) > OPUS_MAX_FRAME_LENGTH ) )
+            {
+                result = OPUS_RESULT_MALFORMED_PACKET;
+            }
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+OpusResult_t OpusToc_Parse( const uint8_t * pPacketData,
+                            size_t packetDataLength,
+                            OpusTocInfo_t * pTocInfo )
+{
+    OpusResult_t result = OPUS_RESULT_OK;
+    size_t lengthSize, frameLength = 0, payloadLength;
+    uint8_t toc;
+
+    if( ( pPacketData == NULL ) ||
+        ( packetDataLength == 0 ) ||
+        ( pTocInfo == NULL ) )
+    {
+        result = OPUS_RESULT_BAD_PARAM;
+    }
+
+    if( result == OPUS_RESULT_OK )
+    {
+        toc = pPacketData[ OPUS_TOC_OFFSET ];
+        pTocInfo->config = ( toc & OPUS_TOC_CONFIG_BITMASK ) >> OPUS_TOC_CONFIG_LOCATION;
+        pTocInfo->isStereo = ( toc & OPUS_TOC_S_BITMASK ) >> OPUS_TOC_S_LOCATION;
+        pTocInfo->bandwidth = OpusToc_GetBandwidth( pTocInfo->config );
+        pTocInfo->frameCountCode = ( toc & OPUS_TOC_CODE_BITMASK ) >> OPUS_TOC_CODE_LOCATION;
+        pTocInfo->frameDurationSamples = GetFrameDurationSamples( pTocInfo->config );
+
+        payloadLength = packetDataLength - 1;
+
+        if( pTocInfo->frameCountCode == OPUS_CODE_ONE_FRAME )
+        {
+            pTocInfo->frameCount = 1;
+
+            if( payloadLength > OPUS_MAX_FRAME_LENGTH )
+            {
+                result = OPUS_RESULT_MALFORMED_PACKET;
+            }
+        }
+        else if( pTocInfo->frameCountCode == OPUS_CODE_TWO_EQUAL_FRAMES )
+        {
+            pTocInfo->frameCount = 2;
+
+            if( ( ( payloadLength % 2 ) != 0 ) ||
+                ( ( payloadLength / 2 ) > OPUS_MAX_FRAME_LENGTH ) )
+            {
+                result = OPUS_RESULT_MALFORMED_PACKET;
+            }
+        }
+        else if( pTocInfo->frameCountCode == OPUS_CODE_TWO_FRAMES )
+        {
+            pTocInfo->frameCount = 2;
+
+            lengthSize = ReadFrameLength( &( pPacketData[ OPUS_TOC_OFFSET + 1 ] ),
+                                          payloadLength,
+                                          &( frameLength ) );
+
+            if( ( lengthSize == 0 ) ||
+                ( frameLength > OPUS_MAX_FRAME_LENGTH ) ||
+                ( frameLength > ( payloadLength - lengthSize ) ) ||
+                ( ( payloadLength - lengthSize - frameLength ) > OPUS_MAX_FRAME_LENGTH ) )
+            {
+                result = OPUS_RESULT_MALFORMED_PACKET;
+            }
+        }
+        else
+        {
+            result = ValidateArbitraryFrames( pPacketData,
+                                              packetDataLength,
+                                              pTocInfo );
+        }
+    }
+
+    if( result == OPUS_RESULT_OK )
+    {
+        pTocInfo->packetDurationSamples = ( uint32_t ) ( pTocInfo->frameCount * pTocInfo->frameDurationSamples );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+uint8_t OpusToc_GetBandwidth( uint8_t config )
+{
+    uint8_t bandwidth;
+
+    if( config < 12 )
+    {
+        /* SILK - NB, MB and WB in groups of 4 configs. */
+        bandwidth = OPUS_BANDWIDTH_NARROWBAND + ( config / 4 );
+    }
+    else if( config < 16 )
+    {
+        /* Hybrid - SWB and FB in groups of 2 configs. */
+        bandwidth = OPUS_BANDWIDTH_SUPERWIDEBAND + ( ( config - 12 ) / 2 );
+    }
+    else if( config < 20 )
+    {
+        /* CELT - NB, WB, SWB and FB in groups of 4 configs. */
+        bandwidth = OPUS_BANDWIDTH_NARROWBAND;
+    }
+    else
+    {
+        bandwidth = OPUS_BANDWIDTH_WIDEBAND + ( ( config - 20 ) / 4 );
+    }
+
+    return bandwidth;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,75 @@
+#ifndef RED_DATA_TYPES_H
+#define RED_DATA_TYPES_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * RED header of a redundant block (RFC 2198):
+ *
+ *     0                   1                   2                   3
+ *     0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ *    +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *    |F|   block PT  |  timestamp offset         |   block length    |
+ *    +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *
+ * RED header of the primary (last) block:
+ *
+ *     0 1 2 3 4 5 6 7
+ *    +-+-+-+-+-+-+-+-+
+ *    |0|   Block PT  |
+ *    +-+-+-+-+-+-+-+-+
+ */
+#define RED_HEADER_LENGTH                       4
+#define RED_PRIMARY_HEADER_LENGTH               1
+
+#define RED_HEADER_F_BITMASK                    0x80
+#define RED_HEADER_F_LOCATION                   7
+
+#define RED_HEADER_PT_BITMASK                   0x7F
+#define RED_HEADER_PT_LOCATION                  0
+
+/* Timestamp offset and block length are read from the last 3 bytes of the
+ * header. */
+#define RED_HEADER_TIMESTAMP_OFFSET_BITMASK     0xFFFC00
+#define RED_HEADER_TIMESTAMP_OFFSET_LOCATION    10
+
+#define RED_HEADER_BLOCK_LENGTH_BITMASK         0x0003FF
+#define RED_HEADER_BLOCK_LENGTH_LOCATION        0
+
+#define RED_MAX_TIMESTAMP_OFFSET                0x3FFF
+#define RED_MAX_BLOCK_LENGTH                    0x3FF
+
+/*-----------------------------------------------------------*/
+
+typedef enum RedResult
+{
+    RED_RESULT_OK,
+    RED_RESULT_BAD_PARAM,
+    RED_RESULT_OUT_OF_MEMORY,
+    RED_RESULT_NO_MORE_PACKETS,
+    RED_RESULT_NO_MORE_FRAMES,
+    RED_RESULT_MALFORMED_PACKET
+} RedResult_t;
+
+/*-----------------------------------------------------------*/
+
+typedef struct RedPacket
+{
+    uint8_t * pPacketData;
+    size_t packetDataLength;
+} RedPacket_t;
+
+/* An encoded audio frame (e.g. Opus or G.711 payload) carried in a block. */
+typedef struct RedFrame
+{
+    uint8_t payloadType;
+    uint32_t timestamp;
+    uint8_t * pFrameData;
+    size_t frameDataLength;
+} RedFrame_t;
+
+/*-----------------------------------------------------------*/
+
+#endif /* RED_DATA_TYPES_H */
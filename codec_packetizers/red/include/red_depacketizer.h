@@ -0,0 +1,32 @@
+#ifndef RED_DEPACKETIZER_H
+#define RED_DEPACKETIZER_H
+
+/* Data types includes. */
+#include "red_data_types.h"
+
+typedef struct RedDePacketizerContext
+{
+    RedFrame_t * pFramesArray;
+    size_t framesArrayLength;
+    size_t frameCount;
+    size_t curFrameIndex;
+    uint32_t lastTimestamp;
+    uint8_t isLastTimestampValid;
+} RedDepacketizerContext_t;
+
+RedResult_t RedDepacketizer_Init( RedDepacketizerContext_t * pCtx,
+                                  RedFrame_t * pFramesArray,
+                                  size_t framesArrayLength );
+
+/* Parses a RED packet with the given RTP timestamp. Redundant blocks newer
+ * than the last returned frame (i.e. frames lost earlier) and the primary
+ * block are queued, in timestamp order, for RedDepacketizer_GetFrame. */
+RedResult_t RedDepacketizer_AddPacket( RedDepacketizerContext_t * pCtx,
+                                       const RedPacket_t * pPacket,
+                                       uint32_t packetTimestamp );
+
+/* The returned frame data points into the packet. */
+RedResult_t RedDepacketizer_GetFrame( RedDepacketizerContext_t * pCtx,
+                                      RedFrame_t * pFrame );
+
+#endif /* RED_DEPACKETIZER_H */
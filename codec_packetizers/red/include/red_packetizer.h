@@ -0,0 +1,37 @@
+#ifndef RED_PACKETIZER_H
+#define RED_PACKETIZER_H
+
+/* Data types includes. */
+#include "red_data_types.h"
+
+typedef struct RedPacketizerContext
+{
+    RedFrame_t * pHistoryArray;
+    size_t historyArrayLength;
+    size_t historyCount;
+    size_t historyStartIndex;
+    RedFrame_t primaryFrame;
+    uint8_t isPrimaryFramePresent;
+    uint8_t isPacketPending;
+} RedPacketizerContext_t;
+
+/* pHistoryArray holds references to the last historyArrayLength frames which
+ * are sent as redundant blocks. The data of these frames must stay valid until
+ * they are out of the history. */
+RedResult_t RedPacketizer_Init( RedPacketizerContext_t * pCtx,
+                                RedFrame_t * pHistoryArray,
+                                size_t historyArrayLength );
+
+RedResult_t RedPacketizer_AddFrame( RedPacketizerContext_t * pCtx,
+                                    const RedFrame_t * pFrame );
+
+RedResult_t RedPacketizer_GetPacket( RedPacketizerContext_t * pCtx,
+                                     RedPacket_t * pPacket );
+
+/* Same as RedPacketizer_GetPacket but does not write the primary frame data,
+ * which the caller sends right after the returned data (e.g. using scatter
+ * gather I/O) to avoid copying it. */
+RedResult_t RedPacketizer_GetPacketPrefix( RedPacketizerContext_t * pCtx,
+                                           RedPacket_t * pPacket );
+
+#endif /* RED_PACKETIZER_H */
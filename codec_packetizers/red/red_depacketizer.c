@@ -0,0 +1,213 @@
+/* API includes. */
+#include "red_depacketizer.h"
+
+static uint8_t IsNewFrame( RedDepacketizerContext_t * pCtx,
+                           uint32_t timestamp );
+
+static RedResult_t QueueFrame( RedDepacketizerContext_t * pCtx,
+                               const RedFrame_t * pFrame );
+
+/*-----------------------------------------------------------*/
+
+static uint8_t IsNewFrame( RedDepacketizerContext_t * pCtx,
+                           uint32_t timestamp )
+{
+    uint8_t isNewFrame = 0;
+
+    /* Handles timestamp wrap around. */
+    if( ( pCtx->isLastTimestampValid == 0 ) ||
+        ( ( int32_t ) ( timestamp - pCtx->lastTimestamp ) > 0 ) )
+    {
+        isNewFrame = 1;
+    }
+
+    return isNewFrame;
+}
+
+/*-----------------------------------------------------------*/
+
+static RedResult_t QueueFrame( RedDepacketizerContext_t * pCtx,
+                               const RedFrame_t * pFrame )
+{
+    RedResult_t result = RED_RESULT_OK;
+
+    if( IsNewFrame( pCtx, pFrame->timestamp ) == 1 )
+    {
+        if( pCtx->frameCount >= pCtx->framesArrayLength )
+        {
+            result = RED_RESULT_OUT_OF_MEMORY;
+        }
+        else
+        {
+            pCtx->pFramesArray[ pCtx->frameCount ] = *pFrame;
+            pCtx->frameCount += 1;
+            pCtx->lastTimestamp = pFrame->timestamp;
+            pCtx->isLastTimestampValid = 1;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RedResult_t RedDepacketizer_Init( RedDepacketizerContext_t * pCtx,
+                                  RedFrame_t * pFramesArray,
+                                  size_t framesArrayLength )
+{
+    RedResult_t result = RED_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pFramesArray == NULL ) ||
+        ( framesArrayLength == 0 ) )
+    {
+        result = RED_RESULT_BAD_PARAM;
+    }
+
+    if( result == RED_RESULT_OK )
+    {
+        pCtx->pFramesArray = pFramesArray;
+        pCtx->framesArrayLength = framesArrayLength;
+        pCtx->frameCount = 0;
+        pCtx->curFrameIndex = 0;
+        pCtx->lastTimestamp = 0;
+        pCtx->isLastTimestampValid = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RedResult_t RedDepacketizer_AddPacket( RedDepacketizerContext_t * pCtx,
+                                       const RedPacket_t * pPacket,
+                                       uint32_t packetTimestamp )
+{
+    RedResult_t result = RED_RESULT_OK;
+    size_t headerIndex = 0, headersLength = 0, dataIndex, blocksLength = 0;
+    uint32_t word;
+    RedFrame_t frame;
+    uint8_t isRedundantBlock = 1;
+
+    if( ( pCtx == NULL ) ||
+        ( pPacket == NULL ) ||
+        ( pPacket->pPacketData == NULL ) ||
+        ( pPacket->packetDataLength == 0 ) )
+    {
+        result = RED_RESULT_BAD_PARAM;
+    }
+
+    /* Find the end of the headers and validate the block lengths. */
+    while( ( result == RED_RESULT_OK ) && ( isRedundantBlock == 1 ) )
+    {
+        if( headersLength >= pPacket->packetDataLength )
+        {
+            result = RED_RESULT_MALFORMED_PACKET;
+        }
+        else if( ( pPacket->pPacketData[ headersLength ] & RED_HEADER_F_BITMASK ) == 0 )
+        {
+            headersLength += RED_PRIMARY_HEADER_LENGTH;
+            isRedundantBlock = 0;
+        }
+        else if( ( pPacket->packetDataLength - headersLength ) < RED_HEADER_LENGTH )
+        {
+            result = RED_RESULT_MALFORMED_PACKET;
+        }
+        else
+        {
+            word = ( ( uint32_t ) pPacket->pPacketData[ headersLength + 1 ] << 16 ) |
+                   ( ( uint32_t ) pPacket->pPacketData[ headersLength + 2 ] << 8 ) |
+                   ( ( uint32_t ) pPacket->pPacketData[ headersLength + 3 ] );
+            blocksLength += ( word & RED_HEADER_BLOCK_LENGTH_BITMASK ) >> RED_HEADER_BLOCK_LENGTH_LOCATION;
+            headersLength += RED_HEADER_LENGTH;
+        }
+    }
+
+    if( result == RED_RESULT_OK )
+    {
+        if( ( pPacket->packetDataLength - headersLength ) < blocksLength )
+        {
+            result = RED_RESULT_MALFORMED_PACKET;
+        }
+    }
+
+    /* Queue the redundant blocks of lost frames. */
+    dataIndex = headersLength;
+
+    while( ( result == RED_RESULT_OK ) &&
+           ( headerIndex < ( headersLength - RED_PRIMARY_HEADER_LENGTH ) ) )
+    {
+        word = ( ( uint32_t ) pPacket->pPacketData[ headerIndex + 1 ] << 16 ) |
+               ( ( uint32_t ) pPacket->pPacketData[ headerIndex + 2 ] << 8 ) |
+               ( ( uint32_t ) pPacket->pPacketData[ headerIndex + 3 ] );
+
+        frame.payloadType = ( pPacket->pPacketData[ headerIndex ] & RED_HEADER_PT_BITMASK ) >> RED_HEADER_PT_LOCATION;
+        frame.timestamp = packetTimestamp - ( ( word & RED_HEADER_TIMESTAMP_OFFSET_BITMASK ) >> RED_HEADER_TIMESTAMP_OFFSET_LOCATION );
+        frame.pFrameData = &( pPacket->pPacketData[ dataIndex ] );
+        frame.frameDataLength = ( word & RED_HEADER_BLOCK_LENGTH_BITMASK ) >> RED_HEADER_BLOCK_LENGTH_LOCATION;
+
+        /* Zero length blocks carry no frame. */
+        if( frame.frameDataLength > 0 )
+        {
+            result = QueueFrame( pCtx, &( frame ) );
+        }
+
+        dataIndex += frame.frameDataLength;
+        headerIndex += RED_HEADER_LENGTH;
+    }
+
+    /* Queue the primary block. */
+    if( result == RED_RESULT_OK )
+    {
+        frame.payloadType = ( pPacket->pPacketData[ headerIndex ] & RED_HEADER_PT_BITMASK ) >> RED_HEADER_PT_LOCATION;
+        frame.timestamp = packetTimestamp;
+        frame.pFrameData = &( pPacket->pPacketData[ dataIndex ] );
+        frame.frameDataLength = pPacket->packetDataLength - dataIndex;
+
+        if( frame.frameDataLength > 0 )
+        {
+            result = QueueFrame( pCtx, &( frame ) );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RedResult_t RedDepacketizer_GetFrame( RedDepacketizerContext_t * pCtx,
+                                      RedFrame_t * pFrame )
+{
+    RedResult_t result = RED_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrame == NULL ) )
+    {
+        result = RED_RESULT_BAD_PARAM;
+    }
+
+    if( result == RED_RESULT_OK )
+    {
+        if( pCtx->curFrameIndex >= pCtx->frameCount )
+        {
+            result = RED_RESULT_NO_MORE_FRAMES;
+        }
+    }
+
+    if( result == RED_RESULT_OK )
+    {
+        *pFrame = pCtx->pFramesArray[ pCtx->curFrameIndex ];
+        pCtx->curFrameIndex += 1;
+
+        /* Release the frames array once every frame is read. */
+        if( pCtx->curFrameIndex == pCtx->frameCount )
+        {
+            pCtx->frameCount = 0;
+            pCtx->curFrameIndex = 0;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,225 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "red_packetizer.h"
+
+static uint8_t IsRedundantFrameSendable( const RedFrame_t * pPrimaryFrame,
+                                         const RedFrame_t * pFrame );
+
+static RedResult_t WritePacket( RedPacketizerContext_t * pCtx,
+                                RedPacket_t * pPacket,
+                                uint8_t isPrimaryDataWritten );
+
+/*-----------------------------------------------------------*/
+
+/* A redundant frame must precede the primary frame within the range of the
+ * timestamp offset and its length must fit in the block length field. */
+static uint8_t IsRedundantFrameSendable( const RedFrame_t * pPrimaryFrame,
+                                         const RedFrame_t * pFrame )
+{
+    uint8_t isSendable = 0;
+    uint32_t timestampOffset;
+
+    timestampOffset = pPrimaryFrame->timestamp - pFrame->timestamp;
+
+    if( ( timestampOffset != 0 ) &&
+        ( timestampOffset <= RED_MAX_TIMESTAMP_OFFSET ) &&
+        ( pFrame->frameDataLength <= RED_MAX_BLOCK_LENGTH ) )
+    {
+        isSendable = 1;
+    }
+
+    return isSendable;
+}
+
+/*-----------------------------------------------------------*/
+
+static RedResult_t WritePacket( RedPacketizerContext_t * pCtx,
+                                RedPacket_t * pPacket,
+                                uint8_t isPrimaryDataWritten )
+{
+    RedResult_t result = RED_RESULT_OK;
+    size_t i, headersLength = RED_PRIMARY_HEADER_LENGTH, packetLength, headerIndex = 0, dataIndex;
+    RedFrame_t * pFrame;
+    uint32_t word;
+
+    if( ( pCtx == NULL ) ||
+        ( pPacket == NULL ) ||
+        ( pPacket->pPacketData == NULL ) ||
+        ( pPacket->packetDataLength == 0 ) )
+    {
+        result = RED_RESULT_BAD_PARAM;
+    }
+
+    if( result == RED_RESULT_OK )
+    {
+        if( pCtx->isPacketPending == 0 )
+        {
+            result = RED_RESULT_NO_MORE_PACKETS;
+        }
+    }
+
+    /* Calculate the packet length. */
+    if( result == RED_RESULT_OK )
+    {
+        packetLength = RED_PRIMARY_HEADER_LENGTH;
+
+        for( i = 0; i < pCtx->historyCount; i++ )
+        {
+            pFrame = &( pCtx->pHistoryArray[ ( pCtx->historyStartIndex + i ) % pCtx->historyArrayLength ] );
+
+            if( IsRedundantFrameSendable( &( pCtx->primaryFrame ), pFrame ) == 1 )
+            {
+                headersLength += RED_HEADER_LENGTH;
+                packetLength += RED_HEADER_LENGTH + pFrame->frameDataLength;
+            }
+        }
+
+        dataIndex = headersLength;
+
+        if( isPrimaryDataWritten == 1 )
+        {
+            packetLength += pCtx->primaryFrame.frameDataLength;
+        }
+
+        if( pPacket->packetDataLength < packetLength )
+        {
+            result = RED_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    /* Redundant blocks, oldest first. */
+    if( result == RED_RESULT_OK )
+    {
+        for( i = 0; i < pCtx->historyCount; i++ )
+        {
+            pFrame = &( pCtx->pHistoryArray[ ( pCtx->historyStartIndex + i ) % pCtx->historyArrayLength ] );
+
+            if( IsRedundantFrameSendable( &( pCtx->primaryFrame ), pFrame ) == 1 )
+            {
+                word = ( ( ( pCtx->primaryFrame.timestamp - pFrame->timestamp ) << RED_HEADER_TIMESTAMP_OFFSET_LOCATION ) &
+                         RED_HEADER_TIMESTAMP_OFFSET_BITMASK ) |
+                       ( ( ( uint32_t ) pFrame->frameDataLength << RED_HEADER_BLOCK_LENGTH_LOCATION ) &
+                         RED_HEADER_BLOCK_LENGTH_BITMASK );
+
+                pPacket->pPacketData[ headerIndex ] = RED_HEADER_F_BITMASK |
+                                                      ( ( pFrame->payloadType << RED_HEADER_PT_LOCATION ) & RED_HEADER_PT_BITMASK );
+                pPacket->pPacketData[ headerIndex + 1 ] = ( uint8_t ) ( word >> 16 );
+                pPacket->pPacketData[ headerIndex + 2 ] = ( uint8_t ) ( word >> 8 );
+                pPacket->pPacketData[ headerIndex + 3 ] = ( uint8_t ) word;
+                headerIndex += RED_HEADER_LENGTH;
+
+                memcpy( ( void * ) &( pPacket->pPacketData[ dataIndex ] ),
+                        ( const void * ) &( pFrame->pFrameData[ 0 ] ),
+                        pFrame->frameDataLength );
+                dataIndex += pFrame->frameDataLength;
+            }
+        }
+
+        pPacket->pPacketData[ headerIndex ] = ( pCtx->primaryFrame.payloadType << RED_HEADER_PT_LOCATION ) & RED_HEADER_PT_BITMASK;
+
+        if( isPrimaryDataWritten == 1 )
+        {
+            memcpy( ( void * ) &( pPacket->pPacketData[ dataIndex ] ),
+                    ( const void * ) &( pCtx->primaryFrame.pFrameData[ 0 ] ),
+                    pCtx->primaryFrame.frameDataLength );
+        }
+
+        pPacket->packetDataLength = packetLength;
+        pCtx->isPacketPending = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RedResult_t RedPacketizer_Init( RedPacketizerContext_t * pCtx,
+                                RedFrame_t * pHistoryArray,
+                                size_t historyArrayLength )
+{
+    RedResult_t result = RED_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( ( pHistoryArray == NULL ) && ( historyArrayLength != 0 ) ) )
+    {
+        result = RED_RESULT_BAD_PARAM;
+    }
+
+    if( result == RED_RESULT_OK )
+    {
+        pCtx->pHistoryArray = pHistoryArray;
+        pCtx->historyArrayLength = historyArrayLength;
+        pCtx->historyCount = 0;
+        pCtx->historyStartIndex = 0;
+        pCtx->isPrimaryFramePresent = 0;
+        pCtx->isPacketPending = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RedResult_t RedPacketizer_AddFrame( RedPacketizerContext_t * pCtx,
+                                    const RedFrame_t * pFrame )
+{
+    RedResult_t result = RED_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pFrame->pFrameData == NULL ) ||
+        ( pFrame->frameDataLength == 0 ) )
+    {
+        result = RED_RESULT_BAD_PARAM;
+    }
+
+    if( result == RED_RESULT_OK )
+    {
+        /* The previous primary frame becomes the newest redundant frame,
+         * replacing the oldest one if the history is full. */
+        if( ( pCtx->isPrimaryFramePresent == 1 ) &&
+            ( pCtx->historyArrayLength > 0 ) )
+        {
+            if( pCtx->historyCount < pCtx->historyArrayLength )
+            {
+                pCtx->pHistoryArray[ ( pCtx->historyStartIndex + pCtx->historyCount ) % pCtx->historyArrayLength ] = pCtx->primaryFrame;
+                pCtx->historyCount += 1;
+            }
+            else
+            {
+                pCtx->pHistoryArray[ pCtx->historyStartIndex ] = pCtx->primaryFrame;
+                pCtx->historyStartIndex = ( pCtx->historyStartIndex + 1 ) % pCtx->historyArrayLength;
+            }
+        }
+
+        pCtx->primaryFrame = *pFrame;
+        pCtx->isPrimaryFramePresent = 1;
+        pCtx->isPacketPending = 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+RedResult_t RedPacketizer_GetPacket( RedPacketizerContext_t * pCtx,
+                                     RedPacket_t * pPacket )
+{
+    return WritePacket( pCtx,
+                        pPacket,
+                        1 );
+}
+
+/*-----------------------------------------------------------*/
+
+RedResult_t RedPacketizer_GetPacketPrefix( RedPacketizerContext_t * pCtx,
+                                           RedPacket_t * pPacket )
+{
+    return WritePacket( pCtx,
+                        pPacket,
+                        0 );
+}
+
+/*-----------------------------------------------------------*/
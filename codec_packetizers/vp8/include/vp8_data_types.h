@@ -63,6 +63,47 @@
 #define VP8_PAYLOAD_DESC_EXT_KEYIDX_BITMASK     0x1F
 #define VP8_PAYLOAD_DESC_EXT_KEYIDX_LOCATION    0
 
+/*
+ * VP8 Payload Header, present at the start of the payload of the first packet
+ * of a frame (S = 1 and PID = 0):
+ *
+ *        0 1 2 3 4 5 6 7
+ *       +-+-+-+-+-+-+-+-+
+ *       |Size0|H| VER |P|
+ *       +-+-+-+-+-+-+-+-+
+ *       |     Size1     |
+ *       +-+-+-+-+-+-+-+-+
+ *       |     Size2     |
+ *       +-+-+-+-+-+-+-+-+
+ *
+ * Key frames (P = 0) are followed by the start code and the dimensions:
+ *
+ *       | 0x9D | 0x01 | 0x2A | Horizontal Scale (2) + Width (14) |
+ *       | Vertical Scale (2) + Height (14) |
+ */
+#define VP8_PAYLOAD_HEADER_LENGTH               3
+#define VP8_KEYFRAME_HEADER_LENGTH              ( VP8_PAYLOAD_HEADER_LENGTH + 7 )
+
+#define VP8_PAYLOAD_HEADER_SIZE0_BITMASK        0xE0
+#define VP8_PAYLOAD_HEADER_SIZE0_LOCATION       5
+
+#define VP8_PAYLOAD_HEADER_H_BITMASK            0x10
+#define VP8_PAYLOAD_HEADER_H_LOCATION           4
+
+#define VP8_PAYLOAD_HEADER_P_BITMASK            0x01
+#define VP8_PAYLOAD_HEADER_P_LOCATION           0
+
+#define VP8_KEYFRAME_START_CODE_OFFSET          VP8_PAYLOAD_HEADER_LENGTH
+#define VP8_KEYFRAME_START_CODE_0               0x9D
+#define VP8_KEYFRAME_START_CODE_1               0x01
+#define VP8_KEYFRAME_START_CODE_2               0x2A
+
+#define VP8_KEYFRAME_WIDTH_OFFSET               ( VP8_KEYFRAME_START_CODE_OFFSET + 3 )
+#define VP8_KEYFRAME_HEIGHT_OFFSET              ( VP8_KEYFRAME_START_CODE_OFFSET + 5 )
+
+#define VP8_KEYFRAME_DIMENSION_BITMASK          0x3FFF
+#define VP8_KEYFRAME_SCALE_LOCATION             14
+
 /* Frame Properties. */
 #define VP8_FRAME_PROP_NON_REF_FRAME            ( 1 << 0 )
 #define VP8_FRAME_PROP_PICTURE_ID_PRESENT       ( 1 << 1 )
@@ -72,7 +113,15 @@
 #define VP8_FRAME_PROP_DEPENDS_ON_BASE_ONLY     ( 1 << 5 ) /* Y bit in TID/Y/KEYIDX extension is set. */
 
 /* Packet properties, used in VP8Depacketizer_GetPacketProperties. */
-#define VP8_PACKET_PROP_START_PACKET            ( 1 << 0 )
+#define VP8_PACKET_PROP_START_PACKET            ( 1 << 0 ) /* First packet of a frame - S = 1 and PID = 0. */
+#define VP8_PACKET_PROP_PARTITION_START         ( 1 << 1 ) /* S = 1. */
+#define VP8_PACKET_PROP_KEYFRAME                ( 1 << 2 )
+#define VP8_PACKET_PROP_SHOW_FRAME              ( 1 << 3 )
+
+#define VP8_PACKET_PROP_PID_BITMASK             0x0700
+#define VP8_PACKET_PROP_PID_LOCATION            8
+
+#define VP8_PACKET_PROP_GET_PID( properties )   ( ( uint8_t ) ( ( ( properties ) & VP8_PACKET_PROP_PID_BITMASK ) >> VP8_PACKET_PROP_PID_LOCATION ) )
 
 /*-----------------------------------------------------------*/
 
@@ -109,6 +158,22 @@ typedef struct VP8Frame
     size_t frameDataLength;
 } VP8Frame_t;
 
+typedef struct VP8FrameSlice
+{
+    uint8_t * pSliceData;
+    size_t sliceDataLength;
+} VP8FrameSlice_t;
+
+typedef struct VP8PacketInfo
+{
+    uint32_t packetProperties;
+    uint32_t firstPartitionSize;    /* Valid for the first packet of a frame. */
+    uint16_t width;                 /* Valid for key frames. */
+    uint16_t height;                /* Valid for key frames. */
+    uint8_t horizontalScale;        /* Valid for key frames. */
+    uint8_t verticalScale;          /* Valid for key frames. */
+} VP8PacketInfo_t;
+
 /*-----------------------------------------------------------*/
 
 #endif /* VP8_DATA_TYPES_H */
@@ -18,9 +18,30 @@ VP8Result_t VP8Depacketizer_Init( VP8DepacketizerContext_t * pCtx,
 VP8Result_t VP8Depacketizer_AddPacket( VP8DepacketizerContext_t * pCtx,
                                        const VP8Packet_t * pPacket );
 
+/* The packets are released once the frame is returned, so that the packets
+ * of the next frame can be added. */
 VP8Result_t VP8Depacketizer_GetFrame( VP8DepacketizerContext_t * pCtx,
                                       VP8Frame_t * pFrame );
 
+/* Returns the payload of each packet as a slice of the packet, without
+ * copying. The packets are not released as the slices refer to them - call
+ * VP8Depacketizer_Init before adding the next frame. The payload descriptor
+ * fields are read from the first packet. For
+ * a frame in a single packet, pFrame->pFrameData points to the payload in the
+ * packet. Otherwise pFrame->pFrameData is set to NULL and
+ * pFrame->frameDataLength is the total length of the slices. */
+VP8Result_t VP8Depacketizer_GetFrameSlices( VP8DepacketizerContext_t * pCtx,
+                                            VP8Frame_t * pFrame,
+                                            VP8FrameSlice_t * pSlicesArray,
+                                            size_t slicesArrayLength,
+                                            size_t * pSlicesCount );
+
+/* Reads the payload descriptor and, for the first packet of a frame, the
+ * payload header. Key frame dimensions are read from the key frame header. */
+VP8Result_t VP8Depacketizer_GetPacketInfo( const uint8_t * pPacketData,
+                                           const size_t packetDataLength,
+                                           VP8PacketInfo_t * pPacketInfo );
+
 VP8Result_t VP8Depacketizer_GetPacketProperties( const uint8_t * pPacketData,
                                                  const size_t packetDataLength,
                                                  uint32_t * pProperties );
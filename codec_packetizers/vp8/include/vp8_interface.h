@@ -0,0 +1,29 @@
+#ifndef VP8_INTERFACE_H
+#define VP8_INTERFACE_H
+
+/* API includes. */
+#include "codec_interface.h"
+#include "vp8_packetizer.h"
+#include "vp8_depacketizer.h"
+
+/* Packetizer state used through the common interface. */
+typedef struct VP8InterfacePacketizerContext
+{
+    VP8PacketizerContext_t packetizerCtx;
+    VP8StreamContext_t streamCtx;
+} VP8InterfacePacketizerContext_t;
+
+/* Binds a VP8 packetizer context to the common packetizer interface.
+ * pCtx->streamCtx must be initialized with VP8Packetizer_InitStream. Each
+ * frame is added with VP8Packetizer_InitWithStream, so the picture ID and
+ * TL0PICIDX are generated. All frames are in temporal layer 0. */
+CodecResult_t VP8Interface_InitPacketizer( CodecPacketizer_t * pPacketizer,
+                                           VP8InterfacePacketizerContext_t * pCtx );
+
+/* Binds a VP8 depacketizer context to the common depacketizer interface.
+ * pCtx must be initialized with VP8Depacketizer_Init. The packets are
+ * dropped from pCtx once CodecDepacketizer_GetFrame returns the frame. */
+CodecResult_t VP8Interface_InitDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                             VP8DepacketizerContext_t * pCtx );
+
+#endif /* VP8_INTERFACE_H */
@@ -0,0 +1,37 @@
+#ifndef VP8_LAYER_FILTER_H
+#define VP8_LAYER_FILTER_H
+
+/* Data types includes. */
+#include "vp8_data_types.h"
+
+typedef struct VP8LayerFilterContext
+{
+    uint8_t targetTid;
+    uint8_t currentTid;             /* Highest temporal layer being forwarded. */
+    uint8_t isForwardingFrame;      /* Decision for the packets of the current frame. */
+    uint16_t droppedPictureCount;   /* Used to keep the forwarded picture IDs continuous. */
+} VP8LayerFilterContext_t;
+
+/* Forwards temporal layers up to targetTid of one VP8 stream to a receiver.
+ * Switching up to a higher layer happens at a key frame or at a frame with
+ * the Y bit set. Switching down happens at the next frame. */
+VP8Result_t VP8LayerFilter_Init( VP8LayerFilterContext_t * pCtx,
+                                 uint8_t targetTid );
+
+VP8Result_t VP8LayerFilter_SetTargetTid( VP8LayerFilterContext_t * pCtx,
+                                         uint8_t targetTid );
+
+/* Packets must be passed in order. The packet is not modified, so that one
+ * packet can be passed to the filters of several receivers. The payload
+ * descriptor, with the picture ID rewritten for a forwarded packet, is
+ * written to pDescriptor which must be VP8_PAYLOAD_DESC_MAX_LENGTH bytes. The
+ * packet to forward is the *pDescriptorLength bytes of pDescriptor followed by
+ * the rest of pPacketData from offset *pDescriptorLength. */
+VP8Result_t VP8LayerFilter_FilterPacket( VP8LayerFilterContext_t * pCtx,
+                                         const uint8_t * pPacketData,
+                                         size_t packetDataLength,
+                                         uint8_t * pDescriptor,
+                                         size_t * pDescriptorLength,
+                                         uint8_t * pForwardPacket );
+
+#endif /* VP8_LAYER_FILTER_H */
@@ -11,11 +11,65 @@ typedef struct VP8PacketizerContext
     uint8_t * pFrameData;
     size_t frameDataLength;
     size_t curFrameDataIndex;
+    const size_t * pPartitionLengths;
+    size_t partitionCount;
+    size_t curPartitionIndex;
+    size_t curPartitionStartIndex;
+    size_t curPartitionEndIndex;
 } VP8PacketizerContext_t;
 
+/* State kept across the frames of a stream. The payload descriptor layout is
+ * fixed for the stream and only the changing fields are updated per frame. */
+typedef struct VP8StreamContext
+{
+    uint8_t payloadDesc[ VP8_PAYLOAD_DESC_MAX_LENGTH ];
+    size_t payloadDescLength;
+    size_t pictureIdIndex;      /* 0 if picture ID is not present. */
+    size_t tl0PicIndexIndex;    /* 0 if TL0PICIDX is not present. */
+    size_t tidKeyIndexIndex;    /* 0 if TID and KEYIDX are not present. */
+    uint16_t pictureId;         /* Picture ID of the next frame. */
+    uint8_t tl0PicIndex;        /* TL0PICIDX of the last frame. */
+    uint8_t isFirstFrame;
+} VP8StreamContext_t;
+
 VP8Result_t VP8Packetizer_Init( VP8PacketizerContext_t * pCtx,
                                 VP8Frame_t * pFrame );
 
+/* Packet boundaries are aligned to the partition boundaries where possible.
+ * A partition is fragmented only when it does not fit in a packet and
+ * complete partitions are aggregated in a packet. pPartitionLengths must stay
+ * valid till all packets are retrieved. */
+VP8Result_t VP8Packetizer_InitWithPartitions( VP8PacketizerContext_t * pCtx,
+                                              VP8Frame_t * pFrame,
+                                              const size_t * pPartitionLengths,
+                                              size_t partitionCount );
+
+/* streamProperties selects the payload descriptor extensions present in all
+ * frames of the stream - VP8_FRAME_PROP_PICTURE_ID_PRESENT,
+ * VP8_FRAME_PROP_TL0PICIDX_PRESENT, VP8_FRAME_PROP_TID_PRESENT and
+ * VP8_FRAME_PROP_KEYIDX_PRESENT. Picture IDs are always sent in 15 bits. */
+VP8Result_t VP8Packetizer_InitStream( VP8StreamContext_t * pStreamCtx,
+                                      uint32_t streamProperties,
+                                      uint16_t firstPictureId,
+                                      uint8_t firstTl0PicIndex );
+
+/* Picture ID and TL0PICIDX are generated from the stream context and written
+ * to pFrame. Picture ID is incremented for every frame and TL0PICIDX for every
+ * frame with TID 0. tid, keyIndex and the N and Y properties are taken from
+ * pFrame. */
+VP8Result_t VP8Packetizer_InitWithStream( VP8PacketizerContext_t * pCtx,
+                                          VP8StreamContext_t * pStreamCtx,
+                                          VP8Frame_t * pFrame );
+
+/* Same as VP8Packetizer_InitWithStream, with the packets aligned to the
+ * partition boundaries as in VP8Packetizer_InitWithPartitions. The stream
+ * context is not advanced if the partition lengths are invalid. */
+VP8Result_t VP8Packetizer_InitWithStreamAndPartitions( VP8PacketizerContext_t * pCtx,
+                                                      VP8StreamContext_t * pStreamCtx,
+                                                      VP8Frame_t * pFrame,
+                                                      const size_t * pPartitionLengths,
+                                                      size_t partitionCount );
+
 VP8Result_t VP8Packetizer_GetPacket( VP8PacketizerContext_t * pCtx,
                                      VP8Packet_t * pPacket );
 
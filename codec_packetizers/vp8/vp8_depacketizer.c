@@ -4,11 +4,66 @@
 /* API includes. */
 #include "vp8_depacketizer.h"
 
+static size_t GetPayloadDescriptorLength( const uint8_t * pPacketData,
+                                         size_t packetDataLength );
+
 static size_t ReadPayloadDescriptor( const VP8Packet_t * pPacket,
                                      VP8Frame_t * pFrame );
 
 /*-----------------------------------------------------------*/
 
+/* Returns 0 if the packet is too short to contain the payload descriptor. */
+static size_t GetPayloadDescriptorLength( const uint8_t * pPacketData,
+                                         size_t packetDataLength )
+{
+    size_t payloadDescLength = 1;
+    uint8_t extensions;
+
+    if( ( pPacketData[ VP8_PAYLOAD_DESC_HEADER_OFFSET ] & VP8_PAYLOAD_DESC_X_BITMASK ) != 0 )
+    {
+        payloadDescLength += 1;
+
+        if( packetDataLength > VP8_PAYLOAD_DESC_EXT_OFFSET )
+        {
+            extensions = pPacketData[ VP8_PAYLOAD_DESC_EXT_OFFSET ];
+
+            if( ( extensions & VP8_PAYLOAD_DESC_EXT_I_BITMASK ) != 0 )
+            {
+                /* M bit indicates a 15 bit picture ID. */
+                if( ( packetDataLength > payloadDescLength ) &&
+                    ( ( pPacketData[ payloadDescLength ] & VP8_PAYLOAD_DESC_EXT_M_BITMASK ) != 0 ) )
+                {
+                    payloadDescLength += 2;
+                }
+                else
+                {
+                    payloadDescLength += 1;
+                }
+            }
+
+            if( ( extensions & VP8_PAYLOAD_DESC_EXT_L_BITMASK ) != 0 )
+            {
+                payloadDescLength += 1;
+            }
+
+            if( ( ( extensions & VP8_PAYLOAD_DESC_EXT_T_BITMASK ) != 0 ) ||
+                ( ( extensions & VP8_PAYLOAD_DESC_EXT_K_BITMASK ) != 0 ) )
+            {
+                payloadDescLength += 1;
+            }
+        }
+    }
+
+    if( payloadDescLength > packetDataLength )
+    {
+        payloadDescLength = 0;
+    }
+
+    return payloadDescLength;
+}
+
+/*-----------------------------------------------------------*/
+
 static size_t ReadPayloadDescriptor( const VP8Packet_t * pPacket,
                                      VP8Frame_t * pFrame )
 {
@@ -168,10 +223,18 @@ VP8Result_t VP8Depacketizer_GetFrame( VP8DepacketizerContext_t * pCtx,
     {
         pPacket = &( pCtx->pPacketsArray[ i ] );
 
-        payloadDescLength = ReadPayloadDescriptor( pPacket,
-                                                   pFrame );
+        /* Check that the payload descriptor is complete before reading it. */
+        payloadDescLength = GetPayloadDescriptorLength( pPacket->pPacketData,
+                                                        pPacket->packetDataLength );
+
+        if( payloadDescLength != 0 )
+        {
+            payloadDescLength = ReadPayloadDescriptor( pPacket,
+                                                       pFrame );
+        }
 
-        if( pPacket->packetDataLength > payloadDescLength )
+        if( ( payloadDescLength != 0 ) &&
+            ( pPacket->packetDataLength > payloadDescLength ) )
         {
             if( ( pFrame->frameDataLength - curFrameDataIndex ) >= ( pPacket->packetDataLength - payloadDescLength ) )
             {
@@ -195,6 +258,173 @@ VP8Result_t VP8Depacketizer_GetFrame( VP8DepacketizerContext_t * pCtx,
     if( result == VP8_RESULT_OK )
     {
         pFrame->frameDataLength = curFrameDataIndex;
+
+        /* Release the packets so that the next frame can be added. */
+        pCtx->packetCount = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+VP8Result_t VP8Depacketizer_GetFrameSlices( VP8DepacketizerContext_t * pCtx,
+                                            VP8Frame_t * pFrame,
+                                            VP8FrameSlice_t * pSlicesArray,
+                                            size_t slicesArrayLength,
+                                            size_t * pSlicesCount )
+{
+    VP8Result_t result = VP8_RESULT_OK;
+    VP8Packet_t * pPacket;
+    size_t i, payloadDescLength, frameDataLength = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pSlicesArray == NULL ) ||
+        ( pSlicesCount == NULL ) ||
+        ( pCtx->packetCount == 0 ) )
+    {
+        result = VP8_RESULT_BAD_PARAM;
+    }
+
+    if( result == VP8_RESULT_OK )
+    {
+        if( pCtx->packetCount > slicesArrayLength )
+        {
+            result = VP8_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    for( i = 0; ( result == VP8_RESULT_OK ) && ( i < pCtx->packetCount ); i++ )
+    {
+        pPacket = &( pCtx->pPacketsArray[ i ] );
+
+        payloadDescLength = GetPayloadDescriptorLength( pPacket->pPacketData,
+                                                        pPacket->packetDataLength );
+
+        /* Only the first packet's descriptor is read, the rest are skipped. */
+        if( ( payloadDescLength != 0 ) &&
+            ( i == 0 ) )
+        {
+            payloadDescLength = ReadPayloadDescriptor( pPacket,
+                                                       pFrame );
+        }
+
+        if( ( payloadDescLength != 0 ) &&
+            ( pPacket->packetDataLength > payloadDescLength ) )
+        {
+            pSlicesArray[ i ].pSliceData = &( pPacket->pPacketData[ payloadDescLength ] );
+            pSlicesArray[ i ].sliceDataLength = pPacket->packetDataLength - payloadDescLength;
+            frameDataLength += pSlicesArray[ i ].sliceDataLength;
+        }
+        else
+        {
+            result = VP8_MALFORMED_PACKET;
+        }
+    }
+
+    if( result == VP8_RESULT_OK )
+    {
+        *pSlicesCount = pCtx->packetCount;
+        pFrame->frameDataLength = frameDataLength;
+
+        if( pCtx->packetCount == 1 )
+        {
+            pFrame->pFrameData = pSlicesArray[ 0 ].pSliceData;
+        }
+        else
+        {
+            pFrame->pFrameData = NULL;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+VP8Result_t VP8Depacketizer_GetPacketInfo( const uint8_t * pPacketData,
+                                           const size_t packetDataLength,
+                                           VP8PacketInfo_t * pPacketInfo )
+{
+    VP8Result_t result = VP8_RESULT_OK;
+    size_t payloadDescLength = 0;
+    const uint8_t * pPayload;
+    uint8_t partitionIndex;
+
+    if( ( pPacketData == NULL ) ||
+        ( packetDataLength == 0 ) ||
+        ( pPacketInfo == NULL ) )
+    {
+        result = VP8_RESULT_BAD_PARAM;
+    }
+
+    if( result == VP8_RESULT_OK )
+    {
+        payloadDescLength = GetPayloadDescriptorLength( pPacketData,
+                                                        packetDataLength );
+
+        if( payloadDescLength == 0 )
+        {
+            result = VP8_MALFORMED_PACKET;
+        }
+    }
+
+    if( result == VP8_RESULT_OK )
+    {
+        memset( ( void * ) pPacketInfo,
+                0,
+                sizeof( VP8PacketInfo_t ) );
+
+        partitionIndex = ( pPacketData[ VP8_PAYLOAD_DESC_HEADER_OFFSET ] & VP8_PAYLOAD_DESC_PID_BITMASK ) >>
+                         VP8_PAYLOAD_DESC_PID_LOCATION;
+        pPacketInfo->packetProperties |= ( ( uint32_t ) partitionIndex ) << VP8_PACKET_PROP_PID_LOCATION;
+
+        if( ( pPacketData[ VP8_PAYLOAD_DESC_HEADER_OFFSET ] & VP8_PAYLOAD_DESC_S_BITMASK ) != 0 )
+        {
+            pPacketInfo->packetProperties |= VP8_PACKET_PROP_PARTITION_START;
+
+            if( partitionIndex == 0 )
+            {
+                pPacketInfo->packetProperties |= VP8_PACKET_PROP_START_PACKET;
+            }
+        }
+    }
+
+    /* The payload header is present only at the start of a frame. */
+    if( ( result == VP8_RESULT_OK ) &&
+        ( ( pPacketInfo->packetProperties & VP8_PACKET_PROP_START_PACKET ) != 0 ) &&
+        ( ( packetDataLength - payloadDescLength ) >= VP8_PAYLOAD_HEADER_LENGTH ) )
+    {
+        pPayload = &( pPacketData[ payloadDescLength ] );
+
+        pPacketInfo->firstPartitionSize = ( ( uint32_t ) ( pPayload[ 0 ] & VP8_PAYLOAD_HEADER_SIZE0_BITMASK ) >> VP8_PAYLOAD_HEADER_SIZE0_LOCATION ) |
+                                          ( ( uint32_t ) pPayload[ 1 ] << 3 ) |
+                                          ( ( uint32_t ) pPayload[ 2 ] << 11 );
+
+        if( ( pPayload[ 0 ] & VP8_PAYLOAD_HEADER_H_BITMASK ) != 0 )
+        {
+            pPacketInfo->packetProperties |= VP8_PACKET_PROP_SHOW_FRAME;
+        }
+
+        if( ( ( pPayload[ 0 ] & VP8_PAYLOAD_HEADER_P_BITMASK ) == 0 ) &&
+            ( ( packetDataLength - payloadDescLength ) >= VP8_KEYFRAME_HEADER_LENGTH ) &&
+            ( pPayload[ VP8_KEYFRAME_START_CODE_OFFSET ] == VP8_KEYFRAME_START_CODE_0 ) &&
+            ( pPayload[ VP8_KEYFRAME_START_CODE_OFFSET + 1 ] == VP8_KEYFRAME_START_CODE_1 ) &&
+            ( pPayload[ VP8_KEYFRAME_START_CODE_OFFSET + 2 ] == VP8_KEYFRAME_START_CODE_2 ) )
+        {
+            pPacketInfo->packetProperties |= VP8_PACKET_PROP_KEYFRAME;
+
+            pPacketInfo->width = ( uint16_t ) ( pPayload[ VP8_KEYFRAME_WIDTH_OFFSET ] |
+                                                 ( pPayload[ VP8_KEYFRAME_WIDTH_OFFSET + 1 ] << 8 ) );
+            pPacketInfo->horizontalScale = ( uint8_t ) ( pPacketInfo->width >> VP8_KEYFRAME_SCALE_LOCATION );
+            pPacketInfo->width &= VP8_KEYFRAME_DIMENSION_BITMASK;
+
+            pPacketInfo->height = ( uint16_t ) ( pPayload[ VP8_KEYFRAME_HEIGHT_OFFSET ] |
+                                                  ( pPayload[ VP8_KEYFRAME_HEIGHT_OFFSET + 1 ] << 8 ) );
+            pPacketInfo->verticalScale = ( uint8_t ) ( pPacketInfo->height >> VP8_KEYFRAME_SCALE_LOCATION );
+            pPacketInfo->height &= VP8_KEYFRAME_DIMENSION_BITMASK;
+        }
     }
 
     return result;
@@ -207,17 +437,23 @@ VP8Result_t VP8Depacketizer_GetPacketProperties( const uint8_t * pPacketData,
                                                  uint32_t * pProperties )
 {
     VP8Result_t result = VP8_RESULT_OK;
+    VP8PacketInfo_t packetInfo;
 
-    if( ( pPacketData == NULL ) ||
-        ( packetDataLength == 0 ) ||
-        ( pProperties == NULL ) )
+    if( pProperties == NULL )
     {
         result = VP8_RESULT_BAD_PARAM;
     }
 
     if( result == VP8_RESULT_OK )
     {
-        *pProperties = VP8_PACKET_PROP_START_PACKET;
+        result = VP8Depacketizer_GetPacketInfo( pPacketData,
+                                                packetDataLength,
+                                                &( packetInfo ) );
+    }
+
+    if( result == VP8_RESULT_OK )
+    {
+        *pProperties = packetInfo.packetProperties;
     }
 
     return result;
@@ -0,0 +1,98 @@
+/* API includes. */
+#include "vp8_interface.h"
+#include "codec_interface_adapter.h"
+
+static VP8Result_t AddStreamFrame( VP8InterfacePacketizerContext_t * pCtx,
+                                   VP8Frame_t * pFrame );
+
+static VP8Result_t GetStreamPacket( VP8InterfacePacketizerContext_t * pCtx,
+                                    VP8Packet_t * pPacket );
+
+/*-----------------------------------------------------------*/
+
+/* In the order of VP8Result_t. */
+static const CodecResult_t resultMap[] =
+{
+    CODEC_RESULT_OK,
+    CODEC_RESULT_BAD_PARAM,
+    CODEC_RESULT_OUT_OF_MEMORY,
+    CODEC_RESULT_NO_MORE_PACKETS,
+    CODEC_RESULT_MALFORMED_PACKET
+};
+
+/*-----------------------------------------------------------*/
+
+static VP8Result_t AddStreamFrame( VP8InterfacePacketizerContext_t * pCtx,
+                                   VP8Frame_t * pFrame )
+{
+    return VP8Packetizer_InitWithStream( &( pCtx->packetizerCtx ),
+                                         &( pCtx->streamCtx ),
+                                         pFrame );
+}
+
+/*-----------------------------------------------------------*/
+
+static VP8Result_t GetStreamPacket( VP8InterfacePacketizerContext_t * pCtx,
+                                    VP8Packet_t * pPacket )
+{
+    return VP8Packetizer_GetPacket( &( pCtx->packetizerCtx ),
+                                    pPacket );
+}
+
+/*-----------------------------------------------------------*/
+
+CODEC_INTERFACE_DEFINE_ADD_FRAME( AddFrame,
+                                  VP8InterfacePacketizerContext_t,
+                                  VP8Frame_t,
+                                  AddStreamFrame,
+                                  resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_PACKET( GetPacket,
+                                   VP8InterfacePacketizerContext_t,
+                                   VP8Packet_t,
+                                   GetStreamPacket,
+                                   resultMap )
+
+CODEC_INTERFACE_DEFINE_ADD_PACKET( AddPacket,
+                                   VP8DepacketizerContext_t,
+                                   VP8Packet_t,
+                                   VP8Depacketizer_AddPacket,
+                                   resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_FRAME( GetFrame,
+                                  VP8DepacketizerContext_t,
+                                  VP8Frame_t,
+                                  VP8Depacketizer_GetFrame,
+                                  resultMap )
+
+/* The start of partition 0 begins a frame. */
+CODEC_INTERFACE_DEFINE_GET_PACKET_PROPERTIES_WITH_FRAME_START( GetPacketProperties,
+                                                               VP8Depacketizer_GetPacketProperties,
+                                                               resultMap,
+                                                               VP8_PACKET_PROP_START_PACKET,
+                                                               VP8_PACKET_PROP_START_PACKET )
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t VP8Interface_InitPacketizer( CodecPacketizer_t * pPacketizer,
+                                           VP8InterfacePacketizerContext_t * pCtx )
+{
+    return CodecInterface_BindPacketizer( pPacketizer,
+                                          ( void * ) pCtx,
+                                          AddFrame,
+                                          GetPacket );
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t VP8Interface_InitDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                             VP8DepacketizerContext_t * pCtx )
+{
+    return CodecInterface_BindDepacketizer( pDepacketizer,
+                                            ( void * ) pCtx,
+                                            AddPacket,
+                                            GetFrame,
+                                            GetPacketProperties );
+}
+
+/*-----------------------------------------------------------*/
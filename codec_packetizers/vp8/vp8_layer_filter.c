@@ -0,0 +1,190 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "vp8_layer_filter.h"
+#include "vp8_depacketizer.h"
+
+#define VP8_MAX_TID    3
+
+/*-----------------------------------------------------------*/
+
+VP8Result_t VP8LayerFilter_Init( VP8LayerFilterContext_t * pCtx,
+                                 uint8_t targetTid )
+{
+    VP8Result_t result = VP8_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( targetTid > VP8_MAX_TID ) )
+    {
+        result = VP8_RESULT_BAD_PARAM;
+    }
+
+    if( result == VP8_RESULT_OK )
+    {
+        pCtx->targetTid = targetTid;
+        pCtx->currentTid = 0;
+        pCtx->isForwardingFrame = 0;
+        pCtx->droppedPictureCount = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+VP8Result_t VP8LayerFilter_SetTargetTid( VP8LayerFilterContext_t * pCtx,
+                                         uint8_t targetTid )
+{
+    VP8Result_t result = VP8_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( targetTid > VP8_MAX_TID ) )
+    {
+        result = VP8_RESULT_BAD_PARAM;
+    }
+
+    if( result == VP8_RESULT_OK )
+    {
+        pCtx->targetTid = targetTid;
+        pCtx->currentTid = VP8_MIN( pCtx->currentTid,
+                                    targetTid );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+VP8Result_t VP8LayerFilter_FilterPacket( VP8LayerFilterContext_t * pCtx,
+                                         const uint8_t * pPacketData,
+                                         size_t packetDataLength,
+                                         uint8_t * pDescriptor,
+                                         size_t * pDescriptorLength,
+                                         uint8_t * pForwardPacket )
+{
+    VP8Result_t result = VP8_RESULT_OK;
+    VP8PacketInfo_t packetInfo;
+    size_t curIndex = VP8_PAYLOAD_DESC_EXT_OFFSET, pictureIdIndex = 0;
+    uint8_t extensions = 0, tid = 0, isTidPresent = 0, isLayerSync = 0;
+    uint16_t pictureId;
+
+    if( ( pCtx == NULL ) ||
+        ( pDescriptor == NULL ) ||
+        ( pDescriptorLength == NULL ) ||
+        ( pForwardPacket == NULL ) )
+    {
+        result = VP8_RESULT_BAD_PARAM;
+    }
+
+    if( result == VP8_RESULT_OK )
+    {
+        /* Also validates that the payload descriptor is complete. */
+        result = VP8Depacketizer_GetPacketInfo( pPacketData,
+                                                packetDataLength,
+                                                &( packetInfo ) );
+    }
+
+    if( result == VP8_RESULT_OK )
+    {
+        if( ( pPacketData[ VP8_PAYLOAD_DESC_HEADER_OFFSET ] & VP8_PAYLOAD_DESC_X_BITMASK ) != 0 )
+        {
+            extensions = pPacketData[ VP8_PAYLOAD_DESC_EXT_OFFSET ];
+            curIndex += 1;
+        }
+
+        if( ( extensions & VP8_PAYLOAD_DESC_EXT_I_BITMASK ) != 0 )
+        {
+            pictureIdIndex = curIndex;
+
+            if( ( pPacketData[ curIndex ] & VP8_PAYLOAD_DESC_EXT_M_BITMASK ) != 0 )
+            {
+                curIndex += 2;
+            }
+            else
+            {
+                curIndex += 1;
+            }
+        }
+
+        if( ( extensions & VP8_PAYLOAD_DESC_EXT_L_BITMASK ) != 0 )
+        {
+            curIndex += 1;
+        }
+
+        if( ( extensions & VP8_PAYLOAD_DESC_EXT_T_BITMASK ) != 0 )
+        {
+            isTidPresent = 1;
+            tid = ( pPacketData[ curIndex ] & VP8_PAYLOAD_DESC_EXT_TID_BITMASK ) >>
+                  VP8_PAYLOAD_DESC_EXT_TID_LOCATION;
+            isLayerSync = ( pPacketData[ curIndex ] & VP8_PAYLOAD_DESC_EXT_Y_BITMASK ) >>
+                          VP8_PAYLOAD_DESC_EXT_Y_LOCATION;
+        }
+
+        if( ( extensions & ( VP8_PAYLOAD_DESC_EXT_T_BITMASK | VP8_PAYLOAD_DESC_EXT_K_BITMASK ) ) != 0 )
+        {
+            curIndex += 1;
+        }
+
+        /* curIndex is now the length of the payload descriptor. */
+        memcpy( ( void * ) &( pDescriptor[ 0 ] ),
+                ( const void * ) &( pPacketData[ 0 ] ),
+                curIndex );
+        *pDescriptorLength = curIndex;
+
+        /* The decision is taken at the start of a frame and applies to all
+         * its packets. */
+        if( ( packetInfo.packetProperties & VP8_PACKET_PROP_START_PACKET ) != 0 )
+        {
+            if( ( packetInfo.packetProperties & VP8_PACKET_PROP_KEYFRAME ) != 0 )
+            {
+                pCtx->currentTid = pCtx->targetTid;
+            }
+            else if( ( isTidPresent != 0 ) &&
+                     ( isLayerSync != 0 ) &&
+                     ( tid > pCtx->currentTid ) &&
+                     ( tid <= pCtx->targetTid ) )
+            {
+                pCtx->currentTid = tid;
+            }
+
+            if( ( isTidPresent == 0 ) ||
+                ( tid <= pCtx->currentTid ) )
+            {
+                pCtx->isForwardingFrame = 1;
+            }
+            else
+            {
+                pCtx->isForwardingFrame = 0;
+                pCtx->droppedPictureCount += 1;
+            }
+        }
+
+        *pForwardPacket = pCtx->isForwardingFrame;
+
+        /* TL0PICIDX only changes on TID 0 frames which are always forwarded
+         * and so stays continuous. Picture ID skips the dropped frames. */
+        if( ( pCtx->isForwardingFrame != 0 ) &&
+            ( pictureIdIndex != 0 ) )
+        {
+            if( ( pDescriptor[ pictureIdIndex ] & VP8_PAYLOAD_DESC_EXT_M_BITMASK ) != 0 )
+            {
+                pictureId = ( uint16_t ) ( ( ( pDescriptor[ pictureIdIndex ] & ~VP8_PAYLOAD_DESC_EXT_M_BITMASK ) << 8 ) |
+                                           pDescriptor[ pictureIdIndex + 1 ] );
+                pictureId = ( uint16_t ) ( ( pictureId - pCtx->droppedPictureCount ) & 0x7FFF );
+
+                pDescriptor[ pictureIdIndex ] = ( uint8_t ) ( ( pictureId >> 8 ) | VP8_PAYLOAD_DESC_EXT_M_BITMASK );
+                pDescriptor[ pictureIdIndex + 1 ] = ( uint8_t ) ( pictureId & 0x00FF );
+            }
+            else
+            {
+                pictureId = ( uint16_t ) ( ( pDescriptor[ pictureIdIndex ] - pCtx->droppedPictureCount ) & 0x7F );
+                pDescriptor[ pictureIdIndex ] = ( uint8_t ) pictureId;
+            }
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
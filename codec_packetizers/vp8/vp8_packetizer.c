@@ -7,6 +7,17 @@
 static size_t GeneratePayloadDescriptor( VP8Frame_t * pFrame,
                                          uint8_t * pBuffer );
 
+static void SetFrame( VP8PacketizerContext_t * pCtx,
+                      const VP8Frame_t * pFrame );
+
+static VP8Result_t ValidatePartitions( const VP8Frame_t * pFrame,
+                                       const size_t * pPartitionLengths,
+                                       size_t partitionCount );
+
+static void SetPartitions( VP8PacketizerContext_t * pCtx,
+                           const size_t * pPartitionLengths,
+                           size_t partitionCount );
+
 /*-----------------------------------------------------------*/
 
 static size_t GeneratePayloadDescriptor( VP8Frame_t * pFrame,
@@ -95,6 +106,23 @@ static size_t GeneratePayloadDescriptor( VP8Frame_t * pFrame,
 
 /*-----------------------------------------------------------*/
 
+static void SetFrame( VP8PacketizerContext_t * pCtx,
+                      const VP8Frame_t * pFrame )
+{
+    pCtx->pFrameData = pFrame->pFrameData;
+    pCtx->frameDataLength = pFrame->frameDataLength;
+    pCtx->curFrameDataIndex = 0;
+
+    /* The whole frame is sent as one partition. */
+    pCtx->pPartitionLengths = NULL;
+    pCtx->partitionCount = 0;
+    pCtx->curPartitionIndex = 0;
+    pCtx->curPartitionStartIndex = 0;
+    pCtx->curPartitionEndIndex = pFrame->frameDataLength;
+}
+
+/*-----------------------------------------------------------*/
+
 VP8Result_t VP8Packetizer_Init( VP8PacketizerContext_t * pCtx,
                                 VP8Frame_t * pFrame )
 {
@@ -112,9 +140,266 @@ VP8Result_t VP8Packetizer_Init( VP8PacketizerContext_t * pCtx,
     {
         pCtx->payloadDescLength = GeneratePayloadDescriptor( pFrame,
                                                              &( pCtx->payloadDesc[ 0 ] ) );
-        pCtx->pFrameData = pFrame->pFrameData;
-        pCtx->frameDataLength = pFrame->frameDataLength;
-        pCtx->curFrameDataIndex = 0;
+        SetFrame( pCtx,
+                  pFrame );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static VP8Result_t ValidatePartitions( const VP8Frame_t * pFrame,
+                                       const size_t * pPartitionLengths,
+                                       size_t partitionCount )
+{
+    VP8Result_t result = VP8_RESULT_OK;
+    size_t i, totalPartitionLength = 0;
+
+    if( ( pFrame == NULL ) ||
+        ( pPartitionLengths == NULL ) ||
+        ( partitionCount == 0 ) )
+    {
+        result = VP8_RESULT_BAD_PARAM;
+    }
+
+    if( result == VP8_RESULT_OK )
+    {
+        for( i = 0; ( result == VP8_RESULT_OK ) && ( i < partitionCount ); i++ )
+        {
+            if( pPartitionLengths[ i ] == 0 )
+            {
+                result = VP8_RESULT_BAD_PARAM;
+            }
+
+            totalPartitionLength += pPartitionLengths[ i ];
+        }
+
+        if( totalPartitionLength != pFrame->frameDataLength )
+        {
+            result = VP8_RESULT_BAD_PARAM;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void SetPartitions( VP8PacketizerContext_t * pCtx,
+                           const size_t * pPartitionLengths,
+                           size_t partitionCount )
+{
+    pCtx->pPartitionLengths = pPartitionLengths;
+    pCtx->partitionCount = partitionCount;
+    pCtx->curPartitionEndIndex = pPartitionLengths[ 0 ];
+}
+
+/*-----------------------------------------------------------*/
+
+VP8Result_t VP8Packetizer_InitWithPartitions( VP8PacketizerContext_t * pCtx,
+                                              VP8Frame_t * pFrame,
+                                              const size_t * pPartitionLengths,
+                                              size_t partitionCount )
+{
+    VP8Result_t result;
+
+    result = ValidatePartitions( pFrame,
+                                 pPartitionLengths,
+                                 partitionCount );
+
+    if( result == VP8_RESULT_OK )
+    {
+        result = VP8Packetizer_Init( pCtx,
+                                     pFrame );
+    }
+
+    if( result == VP8_RESULT_OK )
+    {
+        SetPartitions( pCtx,
+                       pPartitionLengths,
+                       partitionCount );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+VP8Result_t VP8Packetizer_InitStream( VP8StreamContext_t * pStreamCtx,
+                                      uint32_t streamProperties,
+                                      uint16_t firstPictureId,
+                                      uint8_t firstTl0PicIndex )
+{
+    VP8Result_t result = VP8_RESULT_OK;
+    VP8Frame_t templateFrame;
+    size_t curIndex = VP8_PAYLOAD_DESC_EXT_OFFSET + 1;
+
+    if( ( pStreamCtx == NULL ) ||
+        ( firstPictureId > 0x7FFF ) )
+    {
+        result = VP8_RESULT_BAD_PARAM;
+    }
+
+    if( result == VP8_RESULT_OK )
+    {
+        memset( ( void * ) &( templateFrame ),
+                0,
+                sizeof( VP8Frame_t ) );
+
+        /* Generate the layout once, with a 15 bit picture ID. */
+        templateFrame.frameProperties = streamProperties & ( VP8_FRAME_PROP_PICTURE_ID_PRESENT |
+                                                             VP8_FRAME_PROP_TL0PICIDX_PRESENT |
+                                                             VP8_FRAME_PROP_TID_PRESENT |
+                                                             VP8_FRAME_PROP_KEYIDX_PRESENT );
+        templateFrame.pictureId = VP8_PAYLOAD_DESC_EXT_M_BITMASK;
+
+        pStreamCtx->payloadDescLength = GeneratePayloadDescriptor( &( templateFrame ),
+                                                                   &( pStreamCtx->payloadDesc[ 0 ] ) );
+        pStreamCtx->pictureIdIndex = 0;
+        pStreamCtx->tl0PicIndexIndex = 0;
+        pStreamCtx->tidKeyIndexIndex = 0;
+
+        if( ( templateFrame.frameProperties & VP8_FRAME_PROP_PICTURE_ID_PRESENT ) != 0 )
+        {
+            pStreamCtx->pictureIdIndex = curIndex;
+            curIndex += 2;
+        }
+
+        if( ( templateFrame.frameProperties & VP8_FRAME_PROP_TL0PICIDX_PRESENT ) != 0 )
+        {
+            pStreamCtx->tl0PicIndexIndex = curIndex;
+            curIndex += 1;
+        }
+
+        if( ( ( templateFrame.frameProperties & VP8_FRAME_PROP_TID_PRESENT ) != 0 ) ||
+            ( ( templateFrame.frameProperties & VP8_FRAME_PROP_KEYIDX_PRESENT ) != 0 ) )
+        {
+            pStreamCtx->tidKeyIndexIndex = curIndex;
+        }
+
+        pStreamCtx->pictureId = firstPictureId;
+        pStreamCtx->tl0PicIndex = firstTl0PicIndex;
+        pStreamCtx->isFirstFrame = 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+VP8Result_t VP8Packetizer_InitWithStream( VP8PacketizerContext_t * pCtx,
+                                          VP8StreamContext_t * pStreamCtx,
+                                          VP8Frame_t * pFrame )
+{
+    VP8Result_t result = VP8_RESULT_OK;
+    uint8_t * pDesc;
+    uint8_t isTidPresent;
+
+    if( ( pCtx == NULL ) ||
+        ( pStreamCtx == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pFrame->pFrameData == NULL ) ||
+        ( pFrame->frameDataLength == 0 ) )
+    {
+        result = VP8_RESULT_BAD_PARAM;
+    }
+
+    if( result == VP8_RESULT_OK )
+    {
+        pDesc = &( pCtx->payloadDesc[ 0 ] );
+        memcpy( ( void * ) pDesc,
+                ( const void * ) &( pStreamCtx->payloadDesc[ 0 ] ),
+                pStreamCtx->payloadDescLength );
+        pCtx->payloadDescLength = pStreamCtx->payloadDescLength;
+
+        isTidPresent = ( ( pStreamCtx->tidKeyIndexIndex != 0 ) &&
+                         ( ( pDesc[ VP8_PAYLOAD_DESC_EXT_OFFSET ] & VP8_PAYLOAD_DESC_EXT_T_BITMASK ) != 0 ) ) ? 1 : 0;
+
+        /* Without TID, every frame is in the base layer. */
+        if( ( pStreamCtx->isFirstFrame == 0 ) &&
+            ( ( isTidPresent == 0 ) || ( pFrame->tid == 0 ) ) )
+        {
+            pStreamCtx->tl0PicIndex += 1;
+        }
+
+        pFrame->pictureId = pStreamCtx->pictureId;
+        pFrame->tl0PicIndex = pStreamCtx->tl0PicIndex;
+
+        if( ( pFrame->frameProperties & VP8_FRAME_PROP_NON_REF_FRAME ) != 0 )
+        {
+            pDesc[ VP8_PAYLOAD_DESC_HEADER_OFFSET ] |= VP8_PAYLOAD_DESC_N_BITMASK;
+        }
+
+        if( pStreamCtx->pictureIdIndex != 0 )
+        {
+            pDesc[ pStreamCtx->pictureIdIndex ] = ( uint8_t )( ( pFrame->pictureId >> 8 ) | VP8_PAYLOAD_DESC_EXT_M_BITMASK );
+            pDesc[ pStreamCtx->pictureIdIndex + 1 ] = ( uint8_t )( pFrame->pictureId & 0x00FF );
+        }
+
+        if( pStreamCtx->tl0PicIndexIndex != 0 )
+        {
+            pDesc[ pStreamCtx->tl0PicIndexIndex ] = pFrame->tl0PicIndex;
+        }
+
+        if( pStreamCtx->tidKeyIndexIndex != 0 )
+        {
+            if( isTidPresent != 0 )
+            {
+                pDesc[ pStreamCtx->tidKeyIndexIndex ] |= ( ( pFrame->tid << VP8_PAYLOAD_DESC_EXT_TID_LOCATION ) &
+                                                           VP8_PAYLOAD_DESC_EXT_TID_BITMASK );
+
+                if( ( pFrame->frameProperties & VP8_FRAME_PROP_DEPENDS_ON_BASE_ONLY ) != 0 )
+                {
+                    pDesc[ pStreamCtx->tidKeyIndexIndex ] |= VP8_PAYLOAD_DESC_EXT_Y_BITMASK;
+                }
+            }
+
+            if( ( pDesc[ VP8_PAYLOAD_DESC_EXT_OFFSET ] & VP8_PAYLOAD_DESC_EXT_K_BITMASK ) != 0 )
+            {
+                pDesc[ pStreamCtx->tidKeyIndexIndex ] |= ( ( pFrame->keyIndex << VP8_PAYLOAD_DESC_EXT_KEYIDX_LOCATION ) &
+                                                           VP8_PAYLOAD_DESC_EXT_KEYIDX_BITMASK );
+            }
+        }
+
+        SetFrame( pCtx,
+                  pFrame );
+
+        pStreamCtx->pictureId = ( pStreamCtx->pictureId + 1 ) & 0x7FFF;
+        pStreamCtx->isFirstFrame = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+VP8Result_t VP8Packetizer_InitWithStreamAndPartitions( VP8PacketizerContext_t * pCtx,
+                                                      VP8StreamContext_t * pStreamCtx,
+                                                      VP8Frame_t * pFrame,
+                                                      const size_t * pPartitionLengths,
+                                                      size_t partitionCount )
+{
+    VP8Result_t result;
+
+    /* Validate first so that the stream context is not advanced for a frame
+     * that is rejected. */
+    result = ValidatePartitions( pFrame,
+                                 pPartitionLengths,
+                                 partitionCount );
+
+    if( result == VP8_RESULT_OK )
+    {
+        result = VP8Packetizer_InitWithStream( pCtx,
+                                               pStreamCtx,
+                                               pFrame );
+    }
+
+    if( result == VP8_RESULT_OK )
+    {
+        SetPartitions( pCtx,
+                       pPartitionLengths,
+                       partitionCount );
     }
 
     return result;
@@ -126,7 +411,7 @@ VP8Result_t VP8Packetizer_GetPacket( VP8PacketizerContext_t * pCtx,
                                      VP8Packet_t * pPacket )
 {
     VP8Result_t result = VP8_RESULT_OK;
-    size_t frameDataLengthToSend;
+    size_t frameDataLengthToSend, remainingPacketLength;
 
     if( ( pCtx == NULL ) ||
         ( pPacket == NULL ) )
@@ -150,8 +435,12 @@ VP8Result_t VP8Packetizer_GetPacket( VP8PacketizerContext_t * pCtx,
                     ( const void * ) &( pCtx->payloadDesc[ 0 ] ),
                     pCtx->payloadDescLength );
 
-            /* Mark Start flag for the first packet of the frame. */
-            if( pCtx->curFrameDataIndex == 0 )
+            /* Partitions after the 8th share the last partition index. */
+            pPacket->pPacketData[ VP8_PAYLOAD_DESC_HEADER_OFFSET ] |= ( uint8_t ) VP8_MIN( pCtx->curPartitionIndex,
+                                                                                            VP8_PAYLOAD_DESC_PID_BITMASK );
+
+            /* Mark Start flag for the first packet of a partition. */
+            if( pCtx->curFrameDataIndex == pCtx->curPartitionStartIndex )
             {
                 pPacket->pPacketData[ VP8_PAYLOAD_DESC_HEADER_OFFSET ] |= VP8_PAYLOAD_DESC_S_BITMASK;
             }
@@ -164,8 +453,29 @@ VP8Result_t VP8Packetizer_GetPacket( VP8PacketizerContext_t * pCtx,
 
     if( result == VP8_RESULT_OK )
     {
-        frameDataLengthToSend = VP8_MIN( pPacket->packetDataLength - pCtx->payloadDescLength,
-                                         pCtx->frameDataLength - pCtx->curFrameDataIndex );
+        remainingPacketLength = pPacket->packetDataLength - pCtx->payloadDescLength;
+        frameDataLengthToSend = VP8_MIN( remainingPacketLength,
+                                         pCtx->curPartitionEndIndex - pCtx->curFrameDataIndex );
+
+        /* Add the following partitions only if they fit completely. */
+        while( ( pCtx->curFrameDataIndex + frameDataLengthToSend ) == pCtx->curPartitionEndIndex )
+        {
+            if( ( pCtx->curPartitionIndex + 1 ) >= pCtx->partitionCount )
+            {
+                break;
+            }
+
+            pCtx->curPartitionIndex += 1;
+            pCtx->curPartitionStartIndex = pCtx->curPartitionEndIndex;
+            pCtx->curPartitionEndIndex += pCtx->pPartitionLengths[ pCtx->curPartitionIndex ];
+
+            if( ( frameDataLengthToSend + pCtx->pPartitionLengths[ pCtx->curPartitionIndex ] ) > remainingPacketLength )
+            {
+                break;
+            }
+
+            frameDataLengthToSend += pCtx->pPartitionLengths[ pCtx->curPartitionIndex ];
+        }
 
         memcpy( ( void * ) &( pPacket->pPacketData[ pCtx->payloadDescLength ] ),
                 ( const void * ) &( pCtx->pFrameData[ pCtx->curFrameDataIndex ] ),
@@ -0,0 +1,211 @@
+#ifndef VP9_DATA_TYPES_H
+#define VP9_DATA_TYPES_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * VP9 Payload Descriptor:
+ *
+ *       Flexible mode (F = 1)                Non-flexible mode (F = 0)
+ *        0 1 2 3 4 5 6 7                      0 1 2 3 4 5 6 7
+ *       +-+-+-+-+-+-+-+-+                   +-+-+-+-+-+-+-+-+
+ *       |I|P|L|F|B|E|V|Z| (REQUIRED)        |I|P|L|F|B|E|V|Z| (REQUIRED)
+ *       +-+-+-+-+-+-+-+-+                   +-+-+-+-+-+-+-+-+
+ *  I:   |M| PICTURE ID  | (REQUIRED)   I:   |M| PICTURE ID  | (RECOMMENDED)
+ *       +-+-+-+-+-+-+-+-+                   +-+-+-+-+-+-+-+-+
+ *  M:   | EXTENDED PID  | (RECOMMENDED)M:   | EXTENDED PID  | (RECOMMENDED)
+ *       +-+-+-+-+-+-+-+-+                   +-+-+-+-+-+-+-+-+
+ *  L:   | TID |U| SID |D| (CONDITIONALLY L:   | TID |U| SID |D| (CONDITIONALLY
+ *       +-+-+-+-+-+-+-+-+  RECOMMENDED)     +-+-+-+-+-+-+-+-+  RECOMMENDED)
+ *       |   P_DIFF    |N| (CONDITIONALLY    |   TL0PICIDX   | (CONDITIONALLY
+ *       +-+-+-+-+-+-+-+-+  REQUIRED)        +-+-+-+-+-+-+-+-+  REQUIRED)
+ *                      - up to 3 times
+ *  V:   | SS            | (OPTIONAL)   V:   | SS            | (OPTIONAL)
+ *       | ..            |                   | ..            |
+ *       +-+-+-+-+-+-+-+-+                   +-+-+-+-+-+-+-+-+
+ *
+ * Scalability Structure (SS):
+ *
+ *       +-+-+-+-+-+-+-+-+
+ *  V:   | N_S |Y|G|-|-|-|
+ *       +-+-+-+-+-+-+-+-+              -|
+ *  Y:   |     WIDTH     | (OPTIONAL)    .
+ *       +               +               .
+ *       |               | (OPTIONAL)    .
+ *       +-+-+-+-+-+-+-+-+               . - N_S + 1 times
+ *       |     HEIGHT    | (OPTIONAL)    .
+ *       +               +               .
+ *       |               | (OPTIONAL)    .
+ *       +-+-+-+-+-+-+-+-+              -|
+ *  G:   |      N_G      | (OPTIONAL)
+ *       +-+-+-+-+-+-+-+-+                           -|
+ *  N_G: | TID |U| R |-|-| (OPTIONAL)                 .
+ *       +-+-+-+-+-+-+-+-+              -|            . - N_G times
+ *       |    P_DIFF     | (OPTIONAL)    . - R times  .
+ *       +-+-+-+-+-+-+-+-+              -|           -|
+ */
+#define VP9_PAYLOAD_DESC_HEADER_OFFSET          0
+
+#define VP9_PAYLOAD_DESC_I_BITMASK              0x80
+#define VP9_PAYLOAD_DESC_I_LOCATION             7
+
+#define VP9_PAYLOAD_DESC_P_BITMASK              0x40
+#define VP9_PAYLOAD_DESC_P_LOCATION             6
+
+#define VP9_PAYLOAD_DESC_L_BITMASK              0x20
+#define VP9_PAYLOAD_DESC_L_LOCATION             5
+
+#define VP9_PAYLOAD_DESC_F_BITMASK              0x10
+#define VP9_PAYLOAD_DESC_F_LOCATION             4
+
+#define VP9_PAYLOAD_DESC_B_BITMASK              0x08
+#define VP9_PAYLOAD_DESC_B_LOCATION             3
+
+#define VP9_PAYLOAD_DESC_E_BITMASK              0x04
+#define VP9_PAYLOAD_DESC_E_LOCATION             2
+
+#define VP9_PAYLOAD_DESC_V_BITMASK              0x02
+#define VP9_PAYLOAD_DESC_V_LOCATION             1
+
+#define VP9_PAYLOAD_DESC_Z_BITMASK              0x01
+#define VP9_PAYLOAD_DESC_Z_LOCATION             0
+
+#define VP9_PAYLOAD_DESC_M_BITMASK              0x80
+#define VP9_PAYLOAD_DESC_M_LOCATION             7
+
+#define VP9_PAYLOAD_DESC_TID_BITMASK            0xE0
+#define VP9_PAYLOAD_DESC_TID_LOCATION           5
+
+#define VP9_PAYLOAD_DESC_U_BITMASK              0x10
+#define VP9_PAYLOAD_DESC_U_LOCATION             4
+
+#define VP9_PAYLOAD_DESC_SID_BITMASK            0x0E
+#define VP9_PAYLOAD_DESC_SID_LOCATION           1
+
+#define VP9_PAYLOAD_DESC_D_BITMASK              0x01
+#define VP9_PAYLOAD_DESC_D_LOCATION             0
+
+#define VP9_PAYLOAD_DESC_P_DIFF_BITMASK         0xFE
+#define VP9_PAYLOAD_DESC_P_DIFF_LOCATION        1
+
+#define VP9_PAYLOAD_DESC_N_BITMASK              0x01
+#define VP9_PAYLOAD_DESC_N_LOCATION             0
+
+#define VP9_SS_N_S_BITMASK                      0xE0
+#define VP9_SS_N_S_LOCATION                     5
+
+#define VP9_SS_Y_BITMASK                        0x10
+#define VP9_SS_Y_LOCATION                       4
+
+#define VP9_SS_G_BITMASK                        0x08
+#define VP9_SS_G_LOCATION                       3
+
+#define VP9_SS_TID_BITMASK                      0xE0
+#define VP9_SS_TID_LOCATION                     5
+
+#define VP9_SS_U_BITMASK                        0x10
+#define VP9_SS_U_LOCATION                       4
+
+#define VP9_SS_R_BITMASK                        0x0C
+#define VP9_SS_R_LOCATION                       2
+
+#define VP9_MAX_P_DIFFS                         3
+#define VP9_MAX_SPATIAL_LAYERS                  8
+#define VP9_MAX_PICTURE_GROUP_LENGTH            16
+#define VP9_MAX_LAYER_ID                        7
+
+/* Required byte, picture ID, layer indices and TL0PICIDX or P_DIFFs. */
+#define VP9_PAYLOAD_DESC_MAX_LENGTH             ( 4 + VP9_MAX_P_DIFFS )
+#define VP9_SS_MAX_LENGTH                       ( 2 + ( VP9_MAX_SPATIAL_LAYERS * 4 ) + \
+                                                  ( VP9_MAX_PICTURE_GROUP_LENGTH * ( 1 + VP9_MAX_P_DIFFS ) ) )
+
+/* Frame Properties. */
+#define VP9_FRAME_PROP_PICTURE_ID_PRESENT           ( 1 << 0 )
+#define VP9_FRAME_PROP_INTER_PICTURE_PREDICTED      ( 1 << 1 ) /* P bit. */
+#define VP9_FRAME_PROP_LAYER_INDICES_PRESENT        ( 1 << 2 ) /* L bit. */
+#define VP9_FRAME_PROP_FLEXIBLE_MODE                ( 1 << 3 ) /* F bit. */
+#define VP9_FRAME_PROP_SS_PRESENT                   ( 1 << 4 ) /* V bit. */
+#define VP9_FRAME_PROP_NOT_REF_FOR_UPPER_SPATIAL    ( 1 << 5 ) /* Z bit. */
+#define VP9_FRAME_PROP_SWITCHING_UP_POINT           ( 1 << 6 ) /* U bit. */
+#define VP9_FRAME_PROP_INTER_LAYER_DEPENDENCY       ( 1 << 7 ) /* D bit. */
+#define VP9_FRAME_PROP_SS_RESOLUTION_PRESENT        ( 1 << 8 ) /* Y bit in SS. */
+#define VP9_FRAME_PROP_SS_PICTURE_GROUP_PRESENT     ( 1 << 9 ) /* G bit in SS. */
+
+/* Packet properties, used in VP9Depacketizer_GetPacketProperties. */
+#define VP9_PACKET_PROP_START_PACKET                ( 1 << 0 ) /* B bit. */
+#define VP9_PACKET_PROP_END_PACKET                  ( 1 << 1 ) /* E bit. */
+#define VP9_PACKET_PROP_KEYFRAME                    ( 1 << 2 ) /* Start of a non inter-picture predicted base spatial layer frame. */
+#define VP9_PACKET_PROP_LAYER_INDICES_PRESENT       ( 1 << 3 )
+#define VP9_PACKET_PROP_SWITCHING_UP_POINT          ( 1 << 4 )
+#define VP9_PACKET_PROP_INTER_LAYER_DEPENDENCY      ( 1 << 5 )
+#define VP9_PACKET_PROP_NOT_REF_FOR_UPPER_SPATIAL   ( 1 << 6 )
+
+/* Layer IDs, valid when VP9_PACKET_PROP_LAYER_INDICES_PRESENT is set. */
+#define VP9_PACKET_PROP_TID_BITMASK                 0x0700
+#define VP9_PACKET_PROP_TID_LOCATION                8
+#define VP9_PACKET_PROP_SID_BITMASK                 0x3800
+#define VP9_PACKET_PROP_SID_LOCATION                11
+
+#define VP9_PACKET_PROP_GET_TID( properties )   ( ( uint8_t ) ( ( ( properties ) & VP9_PACKET_PROP_TID_BITMASK ) >> VP9_PACKET_PROP_TID_LOCATION ) )
+#define VP9_PACKET_PROP_GET_SID( properties )   ( ( uint8_t ) ( ( ( properties ) & VP9_PACKET_PROP_SID_BITMASK ) >> VP9_PACKET_PROP_SID_LOCATION ) )
+
+/*-----------------------------------------------------------*/
+
+#define VP9_MIN( a, b ) ( ( a ) < ( b ) ? ( a ) : ( b ) )
+#define VP9_MAX( a, b ) ( ( a ) > ( b ) ? ( a ) : ( b ) )
+
+/*-----------------------------------------------------------*/
+
+typedef enum VP9Result
+{
+    VP9_RESULT_OK,
+    VP9_RESULT_BAD_PARAM,
+    VP9_RESULT_OUT_OF_MEMORY,
+    VP9_RESULT_NO_MORE_PACKETS,
+    VP9_RESULT_MALFORMED_PACKET
+} VP9Result_t;
+
+/*-----------------------------------------------------------*/
+
+typedef struct VP9Packet
+{
+    uint8_t * pPacketData;
+    size_t packetDataLength;
+} VP9Packet_t;
+
+typedef struct VP9PictureGroupEntry
+{
+    uint8_t tid;
+    uint8_t switchingUpPoint;
+    uint8_t numPDiffs;
+    uint8_t pDiffs[ VP9_MAX_P_DIFFS ];
+} VP9PictureGroupEntry_t;
+
+typedef struct VP9ScalabilityStructure
+{
+    uint8_t numSpatialLayers;
+    uint16_t width[ VP9_MAX_SPATIAL_LAYERS ];
+    uint16_t height[ VP9_MAX_SPATIAL_LAYERS ];
+    uint8_t pictureGroupLength;
+    VP9PictureGroupEntry_t pictureGroup[ VP9_MAX_PICTURE_GROUP_LENGTH ];
+} VP9ScalabilityStructure_t;
+
+typedef struct VP9Frame
+{
+    uint32_t frameProperties;
+    uint16_t pictureId;
+    uint8_t tid;
+    uint8_t sid;
+    uint8_t tl0PicIndex;                /* Non-flexible mode only. */
+    uint8_t numPDiffs;                  /* Flexible mode only. */
+    uint8_t pDiffs[ VP9_MAX_P_DIFFS ];  /* Flexible mode only. */
+    VP9ScalabilityStructure_t scalabilityStructure;
+    uint8_t * pFrameData;
+    size_t frameDataLength;
+} VP9Frame_t;
+
+/*-----------------------------------------------------------*/
+
+#endif /* VP9_DATA_TYPES_H */
@@ -0,0 +1,33 @@
+#ifndef VP9_DEPACKETIZER_H
+#define VP9_DEPACKETIZER_H
+
+/* Data types includes. */
+#include "vp9_data_types.h"
+
+typedef struct VP9DePacketizerContext
+{
+    VP9Packet_t * pPacketsArray;
+    size_t packetsArrayLength;
+    size_t packetCount;
+} VP9DepacketizerContext_t;
+
+VP9Result_t VP9Depacketizer_Init( VP9DepacketizerContext_t * pCtx,
+                                  VP9Packet_t * pPacketsArray,
+                                  size_t packetsArrayLength );
+
+VP9Result_t VP9Depacketizer_AddPacket( VP9DepacketizerContext_t * pCtx,
+                                       const VP9Packet_t * pPacket );
+
+/* Returns one layer frame. The payload descriptor fields are read from the
+ * first packet. The packets are released once the frame is returned, so that
+ * the packets of the next frame can be added. */
+VP9Result_t VP9Depacketizer_GetFrame( VP9DepacketizerContext_t * pCtx,
+                                      VP9Frame_t * pFrame );
+
+/* Spatial and temporal layer IDs can be read from the returned properties
+ * using VP9_PACKET_PROP_GET_SID and VP9_PACKET_PROP_GET_TID. */
+VP9Result_t VP9Depacketizer_GetPacketProperties( const uint8_t * pPacketData,
+                                                 const size_t packetDataLength,
+                                                 uint32_t * pProperties );
+
+#endif /* VP9_DEPACKETIZER_H */
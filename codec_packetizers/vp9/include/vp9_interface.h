@@ -0,0 +1,22 @@
+#ifndef VP9_INTERFACE_H
+#define VP9_INTERFACE_H
+
+/* API includes. */
+#include "codec_interface.h"
+#include "vp9_packetizer.h"
+#include "vp9_depacketizer.h"
+
+/* Binds a VP9 packetizer context to the common packetizer interface.
+ * Each frame is added with VP9Packetizer_Init, without any optional
+ * payload descriptor fields. The P bit is set unless the uncompressed header
+ * of the frame shows a key frame. */
+CodecResult_t VP9Interface_InitPacketizer( CodecPacketizer_t * pPacketizer,
+                                           VP9PacketizerContext_t * pCtx );
+
+/* Binds a VP9 depacketizer context to the common depacketizer interface.
+ * pCtx must be initialized with VP9Depacketizer_Init. The packets are
+ * dropped from pCtx once CodecDepacketizer_GetFrame returns the frame. */
+CodecResult_t VP9Interface_InitDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                             VP9DepacketizerContext_t * pCtx );
+
+#endif /* VP9_INTERFACE_H */
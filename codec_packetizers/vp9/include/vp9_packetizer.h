@@ -0,0 +1,26 @@
+#ifndef VP9_PACKETIZER_H
+#define VP9_PACKETIZER_H
+
+/* Data types includes. */
+#include "vp9_data_types.h"
+
+typedef struct VP9PacketizerContext
+{
+    uint8_t payloadDesc[ VP9_PAYLOAD_DESC_MAX_LENGTH ];
+    size_t payloadDescLength;
+    uint8_t scalabilityStructure[ VP9_SS_MAX_LENGTH ];
+    size_t scalabilityStructureLength; /* Sent in the first packet only. */
+    uint8_t * pFrameData;
+    size_t frameDataLength;
+    size_t curFrameDataIndex;
+} VP9PacketizerContext_t;
+
+/* pFrame is one layer frame. Each spatial layer of a picture is packetized
+ * separately. */
+VP9Result_t VP9Packetizer_Init( VP9PacketizerContext_t * pCtx,
+                                VP9Frame_t * pFrame );
+
+VP9Result_t VP9Packetizer_GetPacket( VP9PacketizerContext_t * pCtx,
+                                     VP9Packet_t * pPacket );
+
+#endif /* VP9_PACKETIZER_H */
@@ -0,0 +1,479 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "vp9_depacketizer.h"
+
+static VP9Result_t ReadScalabilityStructure( const uint8_t * pBuffer,
+                                             size_t bufferLength,
+                                             VP9Frame_t * pFrame,
+                                             size_t * pReadLength );
+
+static VP9Result_t ReadPayloadDescriptor( const uint8_t * pPacketData,
+                                          size_t packetDataLength,
+                                          VP9Frame_t * pFrame,
+                                          size_t * pPayloadDescLength );
+
+/*-----------------------------------------------------------*/
+
+static VP9Result_t ReadScalabilityStructure( const uint8_t * pBuffer,
+                                             size_t bufferLength,
+                                             VP9Frame_t * pFrame,
+                                             size_t * pReadLength )
+{
+    VP9Result_t result = VP9_RESULT_OK;
+    VP9ScalabilityStructure_t * pSs = &( pFrame->scalabilityStructure );
+    size_t curIndex = 1, i, j;
+
+    if( bufferLength < 1 )
+    {
+        result = VP9_RESULT_MALFORMED_PACKET;
+    }
+
+    if( result == VP9_RESULT_OK )
+    {
+        pSs->numSpatialLayers = ( ( pBuffer[ 0 ] & VP9_SS_N_S_BITMASK ) >> VP9_SS_N_S_LOCATION ) + 1;
+        pSs->pictureGroupLength = 0;
+
+        if( ( pBuffer[ 0 ] & VP9_SS_Y_BITMASK ) != 0 )
+        {
+            pFrame->frameProperties |= VP9_FRAME_PROP_SS_RESOLUTION_PRESENT;
+
+            if( ( bufferLength - curIndex ) < ( ( size_t ) pSs->numSpatialLayers * 4 ) )
+            {
+                result = VP9_RESULT_MALFORMED_PACKET;
+            }
+
+            for( i = 0; ( result == VP9_RESULT_OK ) && ( i < pSs->numSpatialLayers ); i++ )
+            {
+                pSs->width[ i ] = ( uint16_t )( ( pBuffer[ curIndex ] << 8 ) | pBuffer[ curIndex + 1 ] );
+                pSs->height[ i ] = ( uint16_t )( ( pBuffer[ curIndex + 2 ] << 8 ) | pBuffer[ curIndex + 3 ] );
+                curIndex += 4;
+            }
+        }
+    }
+
+    if( ( result == VP9_RESULT_OK ) &&
+        ( ( pBuffer[ 0 ] & VP9_SS_G_BITMASK ) != 0 ) )
+    {
+        pFrame->frameProperties |= VP9_FRAME_PROP_SS_PICTURE_GROUP_PRESENT;
+
+        if( curIndex >= bufferLength )
+        {
+            result = VP9_RESULT_MALFORMED_PACKET;
+        }
+        else if( pBuffer[ curIndex ] > VP9_MAX_PICTURE_GROUP_LENGTH )
+        {
+            result = VP9_RESULT_OUT_OF_MEMORY;
+        }
+        else
+        {
+            pSs->pictureGroupLength = pBuffer[ curIndex ];
+            curIndex += 1;
+        }
+
+        for( i = 0; ( result == VP9_RESULT_OK ) && ( i < pSs->pictureGroupLength ); i++ )
+        {
+            if( curIndex >= bufferLength )
+            {
+                result = VP9_RESULT_MALFORMED_PACKET;
+                break;
+            }
+
+            pSs->pictureGroup[ i ].tid = ( pBuffer[ curIndex ] & VP9_SS_TID_BITMASK ) >> VP9_SS_TID_LOCATION;
+            pSs->pictureGroup[ i ].switchingUpPoint = ( pBuffer[ curIndex ] & VP9_SS_U_BITMASK ) >> VP9_SS_U_LOCATION;
+            pSs->pictureGroup[ i ].numPDiffs = ( pBuffer[ curIndex ] & VP9_SS_R_BITMASK ) >> VP9_SS_R_LOCATION;
+            curIndex += 1;
+
+            if( ( bufferLength - curIndex ) < pSs->pictureGroup[ i ].numPDiffs )
+            {
+                result = VP9_RESULT_MALFORMED_PACKET;
+                break;
+            }
+
+            for( j = 0; j < pSs->pictureGroup[ i ].numPDiffs; j++ )
+            {
+                pSs->pictureGroup[ i ].pDiffs[ j ] = pBuffer[ curIndex ];
+                curIndex += 1;
+            }
+        }
+    }
+
+    if( result == VP9_RESULT_OK )
+    {
+        *pReadLength = curIndex;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static VP9Result_t ReadPayloadDescriptor( const uint8_t * pPacketData,
+                                          size_t packetDataLength,
+                                          VP9Frame_t * pFrame,
+                                          size_t * pPayloadDescLength )
+{
+    VP9Result_t result = VP9_RESULT_OK;
+    uint8_t header = pPacketData[ VP9_PAYLOAD_DESC_HEADER_OFFSET ];
+    size_t curIndex = 1, ssLength = 0;
+
+    pFrame->frameProperties = 0;
+    pFrame->numPDiffs = 0;
+
+    if( ( header & VP9_PAYLOAD_DESC_P_BITMASK ) != 0 )
+    {
+        pFrame->frameProperties |= VP9_FRAME_PROP_INTER_PICTURE_PREDICTED;
+    }
+
+    if( ( header & VP9_PAYLOAD_DESC_F_BITMASK ) != 0 )
+    {
+        pFrame->frameProperties |= VP9_FRAME_PROP_FLEXIBLE_MODE;
+    }
+
+    if( ( header & VP9_PAYLOAD_DESC_Z_BITMASK ) != 0 )
+    {
+        pFrame->frameProperties |= VP9_FRAME_PROP_NOT_REF_FOR_UPPER_SPATIAL;
+    }
+
+    if( ( header & VP9_PAYLOAD_DESC_I_BITMASK ) != 0 )
+    {
+        pFrame->frameProperties |= VP9_FRAME_PROP_PICTURE_ID_PRESENT;
+
+        if( curIndex >= packetDataLength )
+        {
+            result = VP9_RESULT_MALFORMED_PACKET;
+        }
+        else if( ( pPacketData[ curIndex ] & VP9_PAYLOAD_DESC_M_BITMASK ) != 0 )
+        {
+            if( ( curIndex + 1 ) >= packetDataLength )
+            {
+                result = VP9_RESULT_MALFORMED_PACKET;
+            }
+            else
+            {
+                pFrame->pictureId = ( uint16_t )( ( pPacketData[ curIndex ] & ~VP9_PAYLOAD_DESC_M_BITMASK ) << 8 );
+                pFrame->pictureId |= pPacketData[ curIndex + 1 ];
+                curIndex += 2;
+            }
+        }
+        else
+        {
+            pFrame->pictureId = pPacketData[ curIndex ];
+            curIndex += 1;
+        }
+    }
+
+    if( ( result == VP9_RESULT_OK ) &&
+        ( ( header & VP9_PAYLOAD_DESC_L_BITMASK ) != 0 ) )
+    {
+        pFrame->frameProperties |= VP9_FRAME_PROP_LAYER_INDICES_PRESENT;
+
+        if( curIndex >= packetDataLength )
+        {
+            result = VP9_RESULT_MALFORMED_PACKET;
+        }
+        else
+        {
+            pFrame->tid = ( pPacketData[ curIndex ] & VP9_PAYLOAD_DESC_TID_BITMASK ) >> VP9_PAYLOAD_DESC_TID_LOCATION;
+            pFrame->sid = ( pPacketData[ curIndex ] & VP9_PAYLOAD_DESC_SID_BITMASK ) >> VP9_PAYLOAD_DESC_SID_LOCATION;
+
+            if( ( pPacketData[ curIndex ] & VP9_PAYLOAD_DESC_U_BITMASK ) != 0 )
+            {
+                pFrame->frameProperties |= VP9_FRAME_PROP_SWITCHING_UP_POINT;
+            }
+
+            if( ( pPacketData[ curIndex ] & VP9_PAYLOAD_DESC_D_BITMASK ) != 0 )
+            {
+                pFrame->frameProperties |= VP9_FRAME_PROP_INTER_LAYER_DEPENDENCY;
+            }
+
+            curIndex += 1;
+        }
+
+        if( ( result == VP9_RESULT_OK ) &&
+            ( ( header & VP9_PAYLOAD_DESC_F_BITMASK ) == 0 ) )
+        {
+            if( curIndex >= packetDataLength )
+            {
+                result = VP9_RESULT_MALFORMED_PACKET;
+            }
+            else
+            {
+                pFrame->tl0PicIndex = pPacketData[ curIndex ];
+                curIndex += 1;
+            }
+        }
+    }
+
+    if( ( result == VP9_RESULT_OK ) &&
+        ( ( header & VP9_PAYLOAD_DESC_F_BITMASK ) != 0 ) &&
+        ( ( header & VP9_PAYLOAD_DESC_P_BITMASK ) != 0 ) )
+    {
+        /* N bit indicates that another P_DIFF follows. */
+        do
+        {
+            if( ( curIndex >= packetDataLength ) ||
+                ( pFrame->numPDiffs == VP9_MAX_P_DIFFS ) )
+            {
+                result = VP9_RESULT_MALFORMED_PACKET;
+                break;
+            }
+
+            pFrame->pDiffs[ pFrame->numPDiffs ] = ( pPacketData[ curIndex ] & VP9_PAYLOAD_DESC_P_DIFF_BITMASK ) >> VP9_PAYLOAD_DESC_P_DIFF_LOCATION;
+            pFrame->numPDiffs += 1;
+            curIndex += 1;
+        } while( ( pPacketData[ curIndex - 1 ] & VP9_PAYLOAD_DESC_N_BITMASK ) != 0 );
+    }
+
+    if( ( result == VP9_RESULT_OK ) &&
+        ( ( header & VP9_PAYLOAD_DESC_V_BITMASK ) != 0 ) )
+    {
+        pFrame->frameProperties |= VP9_FRAME_PROP_SS_PRESENT;
+
+        result = ReadScalabilityStructure( &( pPacketData[ curIndex ] ),
+                                           packetDataLength - curIndex,
+                                           pFrame,
+                                           &( ssLength ) );
+        curIndex += ssLength;
+    }
+
+    if( result == VP9_RESULT_OK )
+    {
+        *pPayloadDescLength = curIndex;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+VP9Result_t VP9Depacketizer_Init( VP9DepacketizerContext_t * pCtx,
+                                  VP9Packet_t * pPacketsArray,
+                                  size_t packetsArrayLength )
+{
+    VP9Result_t result = VP9_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pPacketsArray == NULL ) ||
+        ( packetsArrayLength == 0 ) )
+    {
+        result = VP9_RESULT_BAD_PARAM;
+    }
+
+    if( result == VP9_RESULT_OK )
+    {
+        pCtx->pPacketsArray = pPacketsArray;
+        pCtx->packetsArrayLength = packetsArrayLength;
+        pCtx->packetCount = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+VP9Result_t VP9Depacketizer_AddPacket( VP9DepacketizerContext_t * pCtx,
+                                       const VP9Packet_t * pPacket )
+{
+    VP9Result_t result = VP9_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pPacket == NULL ) ||
+        ( pPacket->pPacketData == NULL ) ||
+        ( pPacket->packetDataLength == 0 ) )
+    {
+        result = VP9_RESULT_BAD_PARAM;
+    }
+
+    if( result == VP9_RESULT_OK )
+    {
+        if( pCtx->packetCount >= pCtx->packetsArrayLength )
+        {
+            result = VP9_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == VP9_RESULT_OK )
+    {
+        pCtx->pPacketsArray[ pCtx->packetCount ].pPacketData = pPacket->pPacketData;
+        pCtx->pPacketsArray[ pCtx->packetCount ].packetDataLength = pPacket->packetDataLength;
+        pCtx->packetCount += 1;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+VP9Result_t VP9Depacketizer_GetFrame( VP9DepacketizerContext_t * pCtx,
+                                      VP9Frame_t * pFrame )
+{
+    VP9Result_t result = VP9_RESULT_OK;
+    VP9Packet_t * pPacket;
+    VP9Frame_t packetInfo;
+    size_t i, payloadDescLength = 0, curFrameDataIndex = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pFrame->pFrameData == NULL ) ||
+        ( pFrame->frameDataLength == 0 ) )
+    {
+        result = VP9_RESULT_BAD_PARAM;
+    }
+
+    for( i = 0; ( result == VP9_RESULT_OK ) && ( i < pCtx->packetCount ); i++ )
+    {
+        pPacket = &( pCtx->pPacketsArray[ i ] );
+
+        /* Frame information is taken from the first packet which also carries
+         * the scalability structure. */
+        if( i == 0 )
+        {
+            if( ( pPacket->pPacketData[ VP9_PAYLOAD_DESC_HEADER_OFFSET ] & VP9_PAYLOAD_DESC_B_BITMASK ) == 0 )
+            {
+                result = VP9_RESULT_MALFORMED_PACKET;
+            }
+            else
+            {
+                result = ReadPayloadDescriptor( pPacket->pPacketData,
+                                                pPacket->packetDataLength,
+                                                pFrame,
+                                                &( payloadDescLength ) );
+            }
+        }
+        else
+        {
+            result = ReadPayloadDescriptor( pPacket->pPacketData,
+                                            pPacket->packetDataLength,
+                                            &( packetInfo ),
+                                            &( payloadDescLength ) );
+        }
+
+        if( result == VP9_RESULT_OK )
+        {
+            if( pPacket->packetDataLength > payloadDescLength )
+            {
+                if( ( pFrame->frameDataLength - curFrameDataIndex ) >= ( pPacket->packetDataLength - payloadDescLength ) )
+                {
+                    memcpy( ( void * ) &( pFrame->pFrameData[ curFrameDataIndex ] ),
+                            ( const void * ) &( pPacket->pPacketData[ payloadDescLength ] ),
+                            pPacket->packetDataLength - payloadDescLength );
+
+                    curFrameDataIndex += ( pPacket->packetDataLength - payloadDescLength );
+                }
+                else
+                {
+                    result = VP9_RESULT_OUT_OF_MEMORY;
+                }
+            }
+            else
+            {
+                result = VP9_RESULT_MALFORMED_PACKET;
+            }
+        }
+    }
+
+    if( result == VP9_RESULT_OK )
+    {
+        pFrame->frameDataLength = curFrameDataIndex;
+
+        /* Release the packets so that the next frame can be added. */
+        pCtx->packetCount = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+VP9Result_t VP9Depacketizer_GetPacketProperties( const uint8_t * pPacketData,
+                                                 const size_t packetDataLength,
+                                                 uint32_t * pProperties )
+{
+    VP9Result_t result = VP9_RESULT_OK;
+    uint8_t header = 0;
+    size_t layerIndicesIndex = 1;
+
+    if( ( pPacketData == NULL ) ||
+        ( packetDataLength == 0 ) ||
+        ( pProperties == NULL ) )
+    {
+        result = VP9_RESULT_BAD_PARAM;
+    }
+
+    if( result == VP9_RESULT_OK )
+    {
+        header = pPacketData[ VP9_PAYLOAD_DESC_HEADER_OFFSET ];
+        *pProperties = 0;
+
+        if( ( header & VP9_PAYLOAD_DESC_B_BITMASK ) != 0 )
+        {
+            *pProperties |= VP9_PACKET_PROP_START_PACKET;
+        }
+
+        if( ( header & VP9_PAYLOAD_DESC_E_BITMASK ) != 0 )
+        {
+            *pProperties |= VP9_PACKET_PROP_END_PACKET;
+        }
+
+        if( ( header & VP9_PAYLOAD_DESC_Z_BITMASK ) != 0 )
+        {
+            *pProperties |= VP9_PACKET_PROP_NOT_REF_FOR_UPPER_SPATIAL;
+        }
+
+        /* Only the layer indices are needed, skip the picture ID. */
+        if( ( header & VP9_PAYLOAD_DESC_I_BITMASK ) != 0 )
+        {
+            if( ( packetDataLength > layerIndicesIndex ) &&
+                ( ( pPacketData[ layerIndicesIndex ] & VP9_PAYLOAD_DESC_M_BITMASK ) != 0 ) )
+            {
+                layerIndicesIndex += 2;
+            }
+            else
+            {
+                layerIndicesIndex += 1;
+            }
+        }
+
+        if( ( header & VP9_PAYLOAD_DESC_L_BITMASK ) != 0 )
+        {
+            if( layerIndicesIndex >= packetDataLength )
+            {
+                result = VP9_RESULT_MALFORMED_PACKET;
+            }
+            else
+            {
+                *pProperties |= VP9_PACKET_PROP_LAYER_INDICES_PRESENT;
+                *pProperties |= ( ( uint32_t ) ( ( pPacketData[ layerIndicesIndex ] & VP9_PAYLOAD_DESC_TID_BITMASK ) >> VP9_PAYLOAD_DESC_TID_LOCATION ) ) << VP9_PACKET_PROP_TID_LOCATION;
+                *pProperties |= ( ( uint32_t ) ( ( pPacketData[ layerIndicesIndex ] & VP9_PAYLOAD_DESC_SID_BITMASK ) >> VP9_PAYLOAD_DESC_SID_LOCATION ) ) << VP9_PACKET_PROP_SID_LOCATION;
+
+                if( ( pPacketData[ layerIndicesIndex ] & VP9_PAYLOAD_DESC_U_BITMASK ) != 0 )
+                {
+                    *pProperties |= VP9_PACKET_PROP_SWITCHING_UP_POINT;
+                }
+
+                if( ( pPacketData[ layerIndicesIndex ] & VP9_PAYLOAD_DESC_D_BITMASK ) != 0 )
+                {
+                    *pProperties |= VP9_PACKET_PROP_INTER_LAYER_DEPENDENCY;
+                }
+            }
+        }
+    }
+
+    if( result == VP9_RESULT_OK )
+    {
+        /* Start of a frame which is not inter-picture predicted in the base
+         * spatial layer. */
+        if( ( ( header & VP9_PAYLOAD_DESC_B_BITMASK ) != 0 ) &&
+            ( ( header & VP9_PAYLOAD_DESC_P_BITMASK ) == 0 ) &&
+            ( VP9_PACKET_PROP_GET_SID( *pProperties ) == 0 ) )
+        {
+            *pProperties |= VP9_PACKET_PROP_KEYFRAME;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
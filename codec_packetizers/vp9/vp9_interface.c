@@ -0,0 +1,122 @@
+/* API includes. */
+#include "vp9_interface.h"
+#include "codec_interface_adapter.h"
+
+/* First byte of the VP9 uncompressed header - frame_marker (2 bits),
+ * profile_low_bit, profile_high_bit, reserved_zero for profile 3 only,
+ * show_existing_frame and frame_type (0 for a key frame). */
+#define VP9_FRAME_MARKER_BITMASK            0xC0
+#define VP9_FRAME_MARKER                    0x80
+#define VP9_PROFILE_LOW_BIT_BITMASK         0x20
+#define VP9_PROFILE_HIGH_BIT_BITMASK        0x10
+#define VP9_SHOW_EXISTING_FRAME_BITMASK     0x08
+#define VP9_PROFILE_3_SHOW_EXISTING_BITMASK 0x04
+
+static VP9Result_t AddFrameWithPrediction( VP9PacketizerContext_t * pCtx,
+                                           VP9Frame_t * pFrame );
+
+/*-----------------------------------------------------------*/
+
+/* In the order of VP9Result_t. */
+static const CodecResult_t resultMap[] =
+{
+    CODEC_RESULT_OK,
+    CODEC_RESULT_BAD_PARAM,
+    CODEC_RESULT_OUT_OF_MEMORY,
+    CODEC_RESULT_NO_MORE_PACKETS,
+    CODEC_RESULT_MALFORMED_PACKET
+};
+
+/*-----------------------------------------------------------*/
+
+/* The common interface carries no frame flags, so the P bit is set unless
+ * the uncompressed header shows a key frame. */
+static VP9Result_t AddFrameWithPrediction( VP9PacketizerContext_t * pCtx,
+                                           VP9Frame_t * pFrame )
+{
+    uint8_t header, showExistingFrameBitmask = VP9_SHOW_EXISTING_FRAME_BITMASK;
+
+    pFrame->frameProperties |= VP9_FRAME_PROP_INTER_PICTURE_PREDICTED;
+
+    if( ( pFrame->pFrameData != NULL ) &&
+        ( pFrame->frameDataLength > 0 ) &&
+        ( ( pFrame->pFrameData[ 0 ] & VP9_FRAME_MARKER_BITMASK ) == VP9_FRAME_MARKER ) )
+    {
+        header = pFrame->pFrameData[ 0 ];
+
+        /* Profile 3 has a reserved bit before show_existing_frame. */
+        if( ( ( header & VP9_PROFILE_LOW_BIT_BITMASK ) != 0 ) &&
+            ( ( header & VP9_PROFILE_HIGH_BIT_BITMASK ) != 0 ) )
+        {
+            showExistingFrameBitmask = VP9_PROFILE_3_SHOW_EXISTING_BITMASK;
+        }
+
+        /* frame_type follows show_existing_frame. */
+        if( ( ( header & showExistingFrameBitmask ) == 0 ) &&
+            ( ( header & ( showExistingFrameBitmask >> 1 ) ) == 0 ) )
+        {
+            pFrame->frameProperties &= ~( ( uint32_t ) VP9_FRAME_PROP_INTER_PICTURE_PREDICTED );
+        }
+    }
+
+    return VP9Packetizer_Init( pCtx,
+                               pFrame );
+}
+
+/*-----------------------------------------------------------*/
+
+CODEC_INTERFACE_DEFINE_ADD_FRAME( AddFrame,
+                                  VP9PacketizerContext_t,
+                                  VP9Frame_t,
+                                  AddFrameWithPrediction,
+                                  resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_PACKET( GetPacket,
+                                   VP9PacketizerContext_t,
+                                   VP9Packet_t,
+                                   VP9Packetizer_GetPacket,
+                                   resultMap )
+
+CODEC_INTERFACE_DEFINE_ADD_PACKET( AddPacket,
+                                   VP9DepacketizerContext_t,
+                                   VP9Packet_t,
+                                   VP9Depacketizer_AddPacket,
+                                   resultMap )
+
+CODEC_INTERFACE_DEFINE_GET_FRAME( GetFrame,
+                                  VP9DepacketizerContext_t,
+                                  VP9Frame_t,
+                                  VP9Depacketizer_GetFrame,
+                                  resultMap )
+
+/* The start of the base spatial layer begins a frame. */
+CODEC_INTERFACE_DEFINE_GET_PACKET_PROPERTIES_WITH_FRAME_START( GetPacketProperties,
+                                                               VP9Depacketizer_GetPacketProperties,
+                                                               resultMap,
+                                                               VP9_PACKET_PROP_START_PACKET | VP9_PACKET_PROP_SID_BITMASK,
+                                                               VP9_PACKET_PROP_START_PACKET )
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t VP9Interface_InitPacketizer( CodecPacketizer_t * pPacketizer,
+                                           VP9PacketizerContext_t * pCtx )
+{
+    return CodecInterface_BindPacketizer( pPacketizer,
+                                          ( void * ) pCtx,
+                                          AddFrame,
+                                          GetPacket );
+}
+
+/*-----------------------------------------------------------*/
+
+CodecResult_t VP9Interface_InitDepacketizer( CodecDepacketizer_t * pDepacketizer,
+                                             VP9DepacketizerContext_t * pCtx )
+{
+    return CodecInterface_BindDepacketizer( pDepacketizer,
+                                            ( void * ) pCtx,
+                                            AddPacket,
+                                            GetFrame,
+                                            GetPacketProperties );
+}
+
+/*-----------------------------------------------------------*/
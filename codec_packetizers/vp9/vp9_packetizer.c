@@ -0,0 +1,336 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "vp9_packetizer.h"
+
+static VP9Result_t ValidateFrame( const VP9Frame_t * pFrame );
+
+static size_t GeneratePayloadDescriptor( const VP9Frame_t * pFrame,
+                                         uint8_t * pBuffer );
+
+static size_t GenerateScalabilityStructure( const VP9Frame_t * pFrame,
+                                            uint8_t * pBuffer );
+
+/*-----------------------------------------------------------*/
+
+static VP9Result_t ValidateFrame( const VP9Frame_t * pFrame )
+{
+    VP9Result_t result = VP9_RESULT_OK;
+    const VP9ScalabilityStructure_t * pSs = &( pFrame->scalabilityStructure );
+    size_t i;
+
+    if( ( pFrame->tid > VP9_MAX_LAYER_ID ) ||
+        ( pFrame->sid > VP9_MAX_LAYER_ID ) )
+    {
+        result = VP9_RESULT_BAD_PARAM;
+    }
+
+    /* Picture ID is required in flexible mode and reference indices are
+     * required for inter-picture predicted frames in flexible mode. */
+    if( ( result == VP9_RESULT_OK ) &&
+        ( ( pFrame->frameProperties & VP9_FRAME_PROP_FLEXIBLE_MODE ) != 0 ) )
+    {
+        if( ( pFrame->frameProperties & VP9_FRAME_PROP_PICTURE_ID_PRESENT ) == 0 )
+        {
+            result = VP9_RESULT_BAD_PARAM;
+        }
+        else if( ( ( pFrame->frameProperties & VP9_FRAME_PROP_INTER_PICTURE_PREDICTED ) != 0 ) &&
+                 ( ( pFrame->numPDiffs == 0 ) || ( pFrame->numPDiffs > VP9_MAX_P_DIFFS ) ) )
+        {
+            result = VP9_RESULT_BAD_PARAM;
+        }
+    }
+
+    if( ( result == VP9_RESULT_OK ) &&
+        ( ( pFrame->frameProperties & VP9_FRAME_PROP_SS_PRESENT ) != 0 ) )
+    {
+        if( ( pSs->numSpatialLayers == 0 ) ||
+            ( pSs->numSpatialLayers > VP9_MAX_SPATIAL_LAYERS ) ||
+            ( pSs->pictureGroupLength > VP9_MAX_PICTURE_GROUP_LENGTH ) )
+        {
+            result = VP9_RESULT_BAD_PARAM;
+        }
+
+        for( i = 0; ( result == VP9_RESULT_OK ) && ( i < pSs->pictureGroupLength ); i++ )
+        {
+            if( ( pSs->pictureGroup[ i ].tid > VP9_MAX_LAYER_ID ) ||
+                ( pSs->pictureGroup[ i ].numPDiffs > VP9_MAX_P_DIFFS ) )
+            {
+                result = VP9_RESULT_BAD_PARAM;
+            }
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t GeneratePayloadDescriptor( const VP9Frame_t * pFrame,
+                                         uint8_t * pBuffer )
+{
+    size_t curIndex = 1, i;
+
+    /* First required byte. B, E and V are set per packet. */
+    pBuffer[ VP9_PAYLOAD_DESC_HEADER_OFFSET ] = 0;
+
+    if( ( pFrame->frameProperties & VP9_FRAME_PROP_INTER_PICTURE_PREDICTED ) != 0 )
+    {
+        pBuffer[ VP9_PAYLOAD_DESC_HEADER_OFFSET ] |= VP9_PAYLOAD_DESC_P_BITMASK;
+    }
+
+    if( ( pFrame->frameProperties & VP9_FRAME_PROP_FLEXIBLE_MODE ) != 0 )
+    {
+        pBuffer[ VP9_PAYLOAD_DESC_HEADER_OFFSET ] |= VP9_PAYLOAD_DESC_F_BITMASK;
+    }
+
+    if( ( pFrame->frameProperties & VP9_FRAME_PROP_NOT_REF_FOR_UPPER_SPATIAL ) != 0 )
+    {
+        pBuffer[ VP9_PAYLOAD_DESC_HEADER_OFFSET ] |= VP9_PAYLOAD_DESC_Z_BITMASK;
+    }
+
+    if( ( pFrame->frameProperties & VP9_FRAME_PROP_PICTURE_ID_PRESENT ) != 0 )
+    {
+        pBuffer[ VP9_PAYLOAD_DESC_HEADER_OFFSET ] |= VP9_PAYLOAD_DESC_I_BITMASK;
+
+        if( pFrame->pictureId >= VP9_PAYLOAD_DESC_M_BITMASK )
+        {
+            pBuffer[ curIndex ] = ( uint8_t )( ( pFrame->pictureId & 0x7F00 ) >> 8 );
+            pBuffer[ curIndex ] |= VP9_PAYLOAD_DESC_M_BITMASK;
+            pBuffer[ curIndex + 1 ] = ( uint8_t )( pFrame->pictureId & 0x00FF );
+            curIndex += 2;
+        }
+        else
+        {
+            pBuffer[ curIndex ] = ( uint8_t )( pFrame->pictureId & ~VP9_PAYLOAD_DESC_M_BITMASK );
+            curIndex += 1;
+        }
+    }
+
+    if( ( pFrame->frameProperties & VP9_FRAME_PROP_LAYER_INDICES_PRESENT ) != 0 )
+    {
+        pBuffer[ VP9_PAYLOAD_DESC_HEADER_OFFSET ] |= VP9_PAYLOAD_DESC_L_BITMASK;
+
+        pBuffer[ curIndex ] = ( uint8_t )( ( pFrame->tid << VP9_PAYLOAD_DESC_TID_LOCATION ) &
+                                           VP9_PAYLOAD_DESC_TID_BITMASK );
+        pBuffer[ curIndex ] |= ( uint8_t )( ( pFrame->sid << VP9_PAYLOAD_DESC_SID_LOCATION ) &
+                                            VP9_PAYLOAD_DESC_SID_BITMASK );
+
+        if( ( pFrame->frameProperties & VP9_FRAME_PROP_SWITCHING_UP_POINT ) != 0 )
+        {
+            pBuffer[ curIndex ] |= VP9_PAYLOAD_DESC_U_BITMASK;
+        }
+
+        if( ( pFrame->frameProperties & VP9_FRAME_PROP_INTER_LAYER_DEPENDENCY ) != 0 )
+        {
+            pBuffer[ curIndex ] |= VP9_PAYLOAD_DESC_D_BITMASK;
+        }
+
+        curIndex += 1;
+
+        if( ( pFrame->frameProperties & VP9_FRAME_PROP_FLEXIBLE_MODE ) == 0 )
+        {
+            pBuffer[ curIndex ] = pFrame->tl0PicIndex;
+            curIndex += 1;
+        }
+    }
+
+    if( ( ( pFrame->frameProperties & VP9_FRAME_PROP_FLEXIBLE_MODE ) != 0 ) &&
+        ( ( pFrame->frameProperties & VP9_FRAME_PROP_INTER_PICTURE_PREDICTED ) != 0 ) )
+    {
+        for( i = 0; i < pFrame->numPDiffs; i++ )
+        {
+            pBuffer[ curIndex ] = ( uint8_t )( pFrame->pDiffs[ i ] << VP9_PAYLOAD_DESC_P_DIFF_LOCATION );
+
+            /* N bit indicates that another P_DIFF follows. */
+            if( i < ( size_t ) ( pFrame->numPDiffs - 1 ) )
+            {
+                pBuffer[ curIndex ] |= VP9_PAYLOAD_DESC_N_BITMASK;
+            }
+
+            curIndex += 1;
+        }
+    }
+
+    return curIndex;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t GenerateScalabilityStructure( const VP9Frame_t * pFrame,
+                                            uint8_t * pBuffer )
+{
+    const VP9ScalabilityStructure_t * pSs = &( pFrame->scalabilityStructure );
+    size_t curIndex = 1, i, j;
+
+    pBuffer[ 0 ] = ( uint8_t )( ( ( pSs->numSpatialLayers - 1 ) << VP9_SS_N_S_LOCATION ) &
+                                VP9_SS_N_S_BITMASK );
+
+    if( ( pFrame->frameProperties & VP9_FRAME_PROP_SS_RESOLUTION_PRESENT ) != 0 )
+    {
+        pBuffer[ 0 ] |= VP9_SS_Y_BITMASK;
+
+        for( i = 0; i < pSs->numSpatialLayers; i++ )
+        {
+            pBuffer[ curIndex ] = ( uint8_t )( pSs->width[ i ] >> 8 );
+            pBuffer[ curIndex + 1 ] = ( uint8_t )( pSs->width[ i ] & 0x00FF );
+            pBuffer[ curIndex + 2 ] = ( uint8_t )( pSs->height[ i ] >> 8 );
+            pBuffer[ curIndex + 3 ] = ( uint8_t )( pSs->height[ i ] & 0x00FF );
+            curIndex += 4;
+        }
+    }
+
+    if( ( pFrame->frameProperties & VP9_FRAME_PROP_SS_PICTURE_GROUP_PRESENT ) != 0 )
+    {
+        pBuffer[ 0 ] |= VP9_SS_G_BITMASK;
+        pBuffer[ curIndex ] = pSs->pictureGroupLength;
+        curIndex += 1;
+
+        for( i = 0; i < pSs->pictureGroupLength; i++ )
+        {
+            pBuffer[ curIndex ] = ( uint8_t )( ( pSs->pictureGroup[ i ].tid << VP9_SS_TID_LOCATION ) &
+                                               VP9_SS_TID_BITMASK );
+            pBuffer[ curIndex ] |= ( uint8_t )( ( pSs->pictureGroup[ i ].numPDiffs << VP9_SS_R_LOCATION ) &
+                                                VP9_SS_R_BITMASK );
+
+            if( pSs->pictureGroup[ i ].switchingUpPoint != 0 )
+            {
+                pBuffer[ curIndex ] |= VP9_SS_U_BITMASK;
+            }
+
+            curIndex += 1;
+
+            for( j = 0; j < pSs->pictureGroup[ i ].numPDiffs; j++ )
+            {
+                pBuffer[ curIndex ] = pSs->pictureGroup[ i ].pDiffs[ j ];
+                curIndex += 1;
+            }
+        }
+    }
+
+    return curIndex;
+}
+
+/*-----------------------------------------------------------*/
+
+VP9Result_t VP9Packetizer_Init( VP9PacketizerContext_t * pCtx,
+                                VP9Frame_t * pFrame )
+{
+    VP9Result_t result = VP9_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pFrame == NULL ) ||
+        ( pFrame->pFrameData == NULL ) ||
+        ( pFrame->frameDataLength == 0 ) )
+    {
+        result = VP9_RESULT_BAD_PARAM;
+    }
+
+    if( result == VP9_RESULT_OK )
+    {
+        result = ValidateFrame( pFrame );
+    }
+
+    if( result == VP9_RESULT_OK )
+    {
+        pCtx->payloadDescLength = GeneratePayloadDescriptor( pFrame,
+                                                             &( pCtx->payloadDesc[ 0 ] ) );
+        pCtx->scalabilityStructureLength = 0;
+
+        if( ( pFrame->frameProperties & VP9_FRAME_PROP_SS_PRESENT ) != 0 )
+        {
+            pCtx->scalabilityStructureLength = GenerateScalabilityStructure( pFrame,
+                                                                             &( pCtx->scalabilityStructure[ 0 ] ) );
+        }
+
+        pCtx->pFrameData = pFrame->pFrameData;
+        pCtx->frameDataLength = pFrame->frameDataLength;
+        pCtx->curFrameDataIndex = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+VP9Result_t VP9Packetizer_GetPacket( VP9PacketizerContext_t * pCtx,
+                                     VP9Packet_t * pPacket )
+{
+    VP9Result_t result = VP9_RESULT_OK;
+    size_t headerLength = 0, frameDataLengthToSend;
+
+    if( ( pCtx == NULL ) ||
+        ( pPacket == NULL ) ||
+        ( pPacket->pPacketData == NULL ) )
+    {
+        result = VP9_RESULT_BAD_PARAM;
+    }
+
+    if( result == VP9_RESULT_OK )
+    {
+        if( pCtx->curFrameDataIndex == pCtx->frameDataLength )
+        {
+            result = VP9_RESULT_NO_MORE_PACKETS;
+        }
+    }
+
+    if( result == VP9_RESULT_OK )
+    {
+        headerLength = pCtx->payloadDescLength;
+
+        /* Scalability structure is sent in the first packet only. */
+        if( pCtx->curFrameDataIndex == 0 )
+        {
+            headerLength += pCtx->scalabilityStructureLength;
+        }
+
+        if( pPacket->packetDataLength > headerLength )
+        {
+            memcpy( ( void * ) &( pPacket->pPacketData[ 0 ] ),
+                    ( const void * ) &( pCtx->payloadDesc[ 0 ] ),
+                    pCtx->payloadDescLength );
+
+            if( pCtx->curFrameDataIndex == 0 )
+            {
+                pPacket->pPacketData[ VP9_PAYLOAD_DESC_HEADER_OFFSET ] |= VP9_PAYLOAD_DESC_B_BITMASK;
+
+                if( pCtx->scalabilityStructureLength > 0 )
+                {
+                    pPacket->pPacketData[ VP9_PAYLOAD_DESC_HEADER_OFFSET ] |= VP9_PAYLOAD_DESC_V_BITMASK;
+
+                    memcpy( ( void * ) &( pPacket->pPacketData[ pCtx->payloadDescLength ] ),
+                            ( const void * ) &( pCtx->scalabilityStructure[ 0 ] ),
+                            pCtx->scalabilityStructureLength );
+                }
+            }
+        }
+        else
+        {
+            result = VP9_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == VP9_RESULT_OK )
+    {
+        frameDataLengthToSend = VP9_MIN( pPacket->packetDataLength - headerLength,
+                                         pCtx->frameDataLength - pCtx->curFrameDataIndex );
+
+        memcpy( ( void * ) &( pPacket->pPacketData[ headerLength ] ),
+                ( const void * ) &( pCtx->pFrameData[ pCtx->curFrameDataIndex ] ),
+                frameDataLengthToSend );
+        pCtx->curFrameDataIndex += frameDataLengthToSend;
+
+        /* Mark End flag for the last packet of the frame. */
+        if( pCtx->curFrameDataIndex == pCtx->frameDataLength )
+        {
+            pPacket->pPacketData[ VP9_PAYLOAD_DESC_HEADER_OFFSET ] |= VP9_PAYLOAD_DESC_E_BITMASK;
+        }
+
+        pPacket->packetDataLength = headerLength + frameDataLengthToSend;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -5,23 +5,38 @@
 # RTP library source files.
 file( GLOB RTP_SOURCES
      "${CMAKE_CURRENT_LIST_DIR}/source/*.c"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/av1/*.c"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/common/*.c"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/g711/*.c"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/h264/*.c"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/h265/*.c"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/opus/*.c"
-     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/vp8/*.c" )
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/red/*.c"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/vp8/*.c"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/vp9/*.c" )
 
 # RTP library Public Include directories.
 set( RTP_INCLUDE_PUBLIC_DIRS
      "${CMAKE_CURRENT_LIST_DIR}/source/include"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/av1/include"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/common/include"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/g711/include"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/h264/include"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/h265/include"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/opus/include"
-     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/vp8/include" )
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/red/include"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/vp8/include"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/vp9/include" )
 
 # RTP library public include header files.
 file( GLOB RTP_INCLUDE_PUBLIC_FILES
      "${CMAKE_CURRENT_LIST_DIR}/source/include/*.h"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/av1/include/*.h"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/common/include/*.h"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/g711/include/*.h"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/h264/include/*.h"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/h265/include/*.h"
      "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/opus/include/*.h"
-     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/vp8/include/*.h" )
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/red/include/*.h"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/vp8/include/*.h"
+     "${CMAKE_CURRENT_LIST_DIR}/codec_packetizers/vp9/include/*.h" )
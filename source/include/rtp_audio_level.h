@@ -0,0 +1,39 @@
+#ifndef RTP_AUDIO_LEVEL_H
+#define RTP_AUDIO_LEVEL_H
+
+/* Data types includes. */
+#include "rtp_data_types.h"
+
+/*----------------------------------------------------------------------------*/
+
+/* Accumulates the energy of the PCM samples of a packet to compute the RFC 6464
+ * audio level. G.711 samples can be decoded to PCM with G711Codec_*Decode. */
+typedef struct RtpAudioLevelContext
+{
+    uint64_t sumOfSquares;
+    size_t sampleCount;
+} RtpAudioLevelContext_t;
+
+/*----------------------------------------------------------------------------*/
+
+RtpResult_t RtpAudioLevel_Init( RtpAudioLevelContext_t * pCtx );
+
+RtpResult_t RtpAudioLevel_AddPcmSamples( RtpAudioLevelContext_t * pCtx,
+                                         const int16_t * pPcmSamples,
+                                         size_t sampleCount );
+
+/* Returns the RMS level of the added samples in -dBov, rounded to the nearest
+ * integer (0 to RTP_EXTENSION_AUDIO_LEVEL_SILENCE) and resets the context. */
+RtpResult_t RtpAudioLevel_GetLevel( RtpAudioLevelContext_t * pCtx,
+                                    uint8_t * pLevel );
+
+/* Computes the level and writes the audio level extension element with the
+ * given ID and voice activity flag to the one word extension payload. */
+RtpResult_t RtpAudioLevel_CreateExtensionPayload( RtpAudioLevelContext_t * pCtx,
+                                                  uint8_t id,
+                                                  uint8_t isVoiceActive,
+                                                  uint32_t * pExtensionPayload );
+
+/*----------------------------------------------------------------------------*/
+
+#endif /* RTP_AUDIO_LEVEL_H */
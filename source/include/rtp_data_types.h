@@ -43,6 +43,46 @@
 #define RTP_EXTENSION_TWCC_GET_SEQUENCE_NUMBER_FROM_PAYLOAD( payload )   \
     ( ( ( payload ) & RTP_EXTENSION_TWCC_SEQUENCE_NUMBER_MASK ) >> RTP_EXTENSION_TWCC_SEQUENCE_NUMBER_LOCATION )
 
+/*
+ * Client-to-Mixer audio level extension, one-byte header format:
+ *
+ * 0                   1                   2                   3
+ * 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |       0xBE    |    0xDE       |           Length=1            |
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |  ID   | L=0   |V|   level     |        Zero Padding           |
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *
+ * The level is in -dBov, from 0 (loudest) to 127 (silence). V is set when the
+ * packet contains voice activity.
+ *
+ * RFC - https://datatracker.ietf.org/doc/html/rfc6464
+ */
+#define RTP_EXTENSION_AUDIO_LEVEL_PROFILE           0xBEDE
+#define RTP_EXTENSION_AUDIO_LEVEL_LENGTH            1
+#define RTP_EXTENSION_AUDIO_LEVEL_ID_MASK           0xF0000000
+#define RTP_EXTENSION_AUDIO_LEVEL_ID_LOCATION       28
+#define RTP_EXTENSION_AUDIO_LEVEL_VOICE_MASK        0x00800000
+#define RTP_EXTENSION_AUDIO_LEVEL_VOICE_LOCATION    23
+#define RTP_EXTENSION_AUDIO_LEVEL_LEVEL_MASK        0x007F0000
+#define RTP_EXTENSION_AUDIO_LEVEL_LEVEL_LOCATION    16
+#define RTP_EXTENSION_AUDIO_LEVEL_SILENCE           127
+
+#define RTP_EXTENSION_AUDIO_LEVEL_CREATE_PAYLOAD( id, voice, level )   \
+    ( ( ( id ) << RTP_EXTENSION_AUDIO_LEVEL_ID_LOCATION ) & RTP_EXTENSION_AUDIO_LEVEL_ID_MASK ) | \
+    ( ( ( voice ) << RTP_EXTENSION_AUDIO_LEVEL_VOICE_LOCATION ) & RTP_EXTENSION_AUDIO_LEVEL_VOICE_MASK ) | \
+    ( ( ( level ) << RTP_EXTENSION_AUDIO_LEVEL_LEVEL_LOCATION ) & RTP_EXTENSION_AUDIO_LEVEL_LEVEL_MASK )
+
+#define RTP_EXTENSION_AUDIO_LEVEL_GET_ID_FROM_PAYLOAD( payload )   \
+    ( ( ( payload ) & RTP_EXTENSION_AUDIO_LEVEL_ID_MASK ) >> RTP_EXTENSION_AUDIO_LEVEL_ID_LOCATION )
+
+#define RTP_EXTENSION_AUDIO_LEVEL_GET_VOICE_FROM_PAYLOAD( payload )   \
+    ( ( ( payload ) & RTP_EXTENSION_AUDIO_LEVEL_VOICE_MASK ) >> RTP_EXTENSION_AUDIO_LEVEL_VOICE_LOCATION )
+
+#define RTP_EXTENSION_AUDIO_LEVEL_GET_LEVEL_FROM_PAYLOAD( payload )   \
+    ( ( ( payload ) & RTP_EXTENSION_AUDIO_LEVEL_LEVEL_MASK ) >> RTP_EXTENSION_AUDIO_LEVEL_LEVEL_LOCATION )
+
 /*-----------------------------------------------------------*/
 
 typedef enum RtpResult
@@ -0,0 +1,115 @@
+#ifndef RTP_JITTER_BUFFER_H
+#define RTP_JITTER_BUFFER_H
+
+/* Data types includes. */
+#include "rtp_data_types.h"
+
+/* API includes. */
+#include "codec_interface.h"
+
+/*----------------------------------------------------------------------------*/
+
+#define RTP_JITTER_BUFFER_DEFAULT_MIN_DELAY_MS  20
+#define RTP_JITTER_BUFFER_DEFAULT_MAX_DELAY_MS  1000
+
+/* Target delay as a multiple of the interarrival jitter. */
+#define RTP_JITTER_BUFFER_JITTER_MULTIPLIER     3
+
+/*----------------------------------------------------------------------------*/
+
+typedef enum RtpJitterBufferResult
+{
+    RTP_JITTER_BUFFER_RESULT_OK,
+    RTP_JITTER_BUFFER_RESULT_BAD_PARAM,
+    RTP_JITTER_BUFFER_RESULT_OUT_OF_MEMORY,
+    RTP_JITTER_BUFFER_RESULT_MALFORMED_PACKET,
+    RTP_JITTER_BUFFER_RESULT_DUPLICATE_PACKET,
+    RTP_JITTER_BUFFER_RESULT_LATE_PACKET,
+    RTP_JITTER_BUFFER_RESULT_NO_FRAME,
+    RTP_JITTER_BUFFER_RESULT_FRAME_DROPPED,
+    RTP_JITTER_BUFFER_RESULT_DEPACKETIZER_ERROR
+} RtpJitterBufferResult_t;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct RtpJitterBufferPacket
+{
+    uint8_t * pPayload; /* NULL if the entry is empty. */
+    size_t payloadLength;
+    uint32_t rtpTimestamp;
+    uint32_t arrivalTimeMs;
+    uint8_t isStartPacket;
+    uint8_t isFrameStartPacket;
+    uint8_t isMarkerSet;
+} RtpJitterBufferPacket_t;
+
+/* Packets are stored at their extended sequence number modulo the length of
+ * the packets array, so the array bounds the sequence number range held. */
+typedef struct RtpJitterBuffer
+{
+    RtpJitterBufferPacket_t * pPacketsArray;
+    size_t packetsArrayLength;
+    size_t packetCount;
+    CodecDepacketizer_t * pDepacketizer;
+    uint32_t clockRate;
+    uint32_t nextSeqNum;    /* Extended sequence number of the next packet to release. */
+    uint32_t highestSeqNum; /* Highest extended sequence number added. */
+    uint8_t isStarted;
+    uint8_t isFrameReleased;
+    uint8_t isPrevPacketHeld;   /* Packet nextSeqNum - 1 was held when released or dropped. */
+    uint8_t isPrevMarkerSet;
+    uint32_t prevRtpTimestamp;
+    uint32_t lastTransit;
+    uint32_t jitter;        /* RFC 3550 interarrival jitter in timestamp units, scaled by 16. */
+    uint32_t minDelayMs;
+    uint32_t maxDelayMs;
+    uint32_t targetDelayMs;
+} RtpJitterBuffer_t;
+
+/*----------------------------------------------------------------------------*/
+
+/* pDepacketizer is used to find the start packets of frames and receives the
+ * packets of released frames. clockRate is the RTP timestamp rate in Hz. */
+RtpJitterBufferResult_t RtpJitterBuffer_Init( RtpJitterBuffer_t * pJitterBuffer,
+                                              RtpJitterBufferPacket_t * pPacketsArray,
+                                              size_t packetsArrayLength,
+                                              CodecDepacketizer_t * pDepacketizer,
+                                              uint32_t clockRate );
+
+/* Bounds the adaptive target delay. */
+RtpJitterBufferResult_t RtpJitterBuffer_SetDelayRange( RtpJitterBuffer_t * pJitterBuffer,
+                                                       uint32_t minDelayMs,
+                                                       uint32_t maxDelayMs );
+
+/* Adds a deserialized RTP packet in any order. The payload must remain valid
+ * until the frame is released or dropped. arrivalTimeMs is the time the packet
+ * was received, in milliseconds from any fixed point. A packet too far ahead
+ * of the oldest one held to fit in the packets array is taken as a sequence
+ * number jump - the packets held are dropped and the jitter buffer restarts
+ * from it. */
+RtpJitterBufferResult_t RtpJitterBuffer_AddPacket( RtpJitterBuffer_t * pJitterBuffer,
+                                                   const RtpPacket_t * pRtpPacket,
+                                                   uint32_t arrivalTimeMs );
+
+/* Releases the next frame to the depacketizer once the target delay has passed
+ * since its first packet arrived. A frame is complete when it begins with a
+ * start packet and all its packets are present up to a packet with the marker
+ * bit, or up to a packet followed by one with a different timestamp. A packet
+ * with CODEC_PACKET_PROPERTY_FRAME_START always begins a frame. As the start
+ * packet property only marks a possible frame start for some codecs (e.g.
+ * every NALU for H.264), after the first frame another start packet begins a
+ * frame only if it directly follows a packet with the marker bit or with a
+ * different timestamp, so for those codecs a frame after a lost packet is
+ * dropped. A frame whose end is not known yet (e.g. the latest audio packet
+ * without the marker bit) is held until the next packet arrives. A frame
+ * followed by lost packets and then a packet with a different timestamp is
+ * held until that packet is due, then released. An incomplete frame is
+ * dropped when due and RTP_JITTER_BUFFER_RESULT_FRAME_DROPPED is returned.
+ * pRtpTimestamp is set to the timestamp of the released or dropped frame. */
+RtpJitterBufferResult_t RtpJitterBuffer_PopFrame( RtpJitterBuffer_t * pJitterBuffer,
+                                                  uint32_t currentTimeMs,
+                                                  uint32_t * pRtpTimestamp );
+
+/*----------------------------------------------------------------------------*/
+
+#endif /* RTP_JITTER_BUFFER_H */
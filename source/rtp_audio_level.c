@@ -0,0 +1,146 @@
+/* API includes. */
+#include "rtp_audio_level.h"
+
+/*----------------------------------------------------------------------------*/
+
+/* Square of the full scale (overload point) of 16-bit samples. */
+#define FULL_SCALE_SQUARE               1073741824.0
+
+/* 10 ^ ( -0.1 ) - power ratio of 1 dB. */
+#define ONE_DB_POWER_RATIO              0.7943282347242815
+
+/* 10 ^ ( -0.05 ) - power ratio of 0.5 dB, used for rounding. */
+#define HALF_DB_POWER_RATIO             0.8912509381337456
+
+/*----------------------------------------------------------------------------*/
+
+RtpResult_t RtpAudioLevel_Init( RtpAudioLevelContext_t * pCtx )
+{
+    RtpResult_t result = RTP_RESULT_OK;
+
+    if( pCtx == NULL )
+    {
+        result = RTP_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        pCtx->sumOfSquares = 0;
+        pCtx->sampleCount = 0;
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+RtpResult_t RtpAudioLevel_AddPcmSamples( RtpAudioLevelContext_t * pCtx,
+                                         const int16_t * pPcmSamples,
+                                         size_t sampleCount )
+{
+    RtpResult_t result = RTP_RESULT_OK;
+    size_t i;
+    uint64_t sumOfSquares = 0;
+    int32_t sample;
+
+    if( ( pCtx == NULL ) ||
+        ( pPcmSamples == NULL ) )
+    {
+        result = RTP_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        /* Kept simple so that the compiler vectorizes it. */
+        for( i = 0; i < sampleCount; i++ )
+        {
+            sample = pPcmSamples[ i ];
+            sumOfSquares += ( uint64_t ) ( uint32_t ) ( sample * sample );
+        }
+
+        pCtx->sumOfSquares += sumOfSquares;
+        pCtx->sampleCount += sampleCount;
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+RtpResult_t RtpAudioLevel_GetLevel( RtpAudioLevelContext_t * pCtx,
+                                    uint8_t * pLevel )
+{
+    RtpResult_t result = RTP_RESULT_OK;
+    double meanSquare, threshold;
+    uint8_t level = 0;
+
+    if( ( pCtx == NULL ) ||
+        ( pLevel == NULL ) )
+    {
+        result = RTP_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        if( pCtx->sampleCount == 0 )
+        {
+            level = RTP_EXTENSION_AUDIO_LEVEL_SILENCE;
+        }
+        else
+        {
+            /* Find the level as -10 * log10( meanSquare / fullScaleSquare ),
+             * rounded to nearest, without a math library: step down 1 dB at a
+             * time from 0.5 dB below full scale until the threshold is met. */
+            meanSquare = ( double ) pCtx->sumOfSquares / ( double ) pCtx->sampleCount;
+            threshold = FULL_SCALE_SQUARE * HALF_DB_POWER_RATIO;
+
+            while( ( level < RTP_EXTENSION_AUDIO_LEVEL_SILENCE ) &&
+                   ( meanSquare < threshold ) )
+            {
+                threshold *= ONE_DB_POWER_RATIO;
+                level += 1;
+            }
+        }
+
+        *pLevel = level;
+        pCtx->sumOfSquares = 0;
+        pCtx->sampleCount = 0;
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+RtpResult_t RtpAudioLevel_CreateExtensionPayload( RtpAudioLevelContext_t * pCtx,
+                                                  uint8_t id,
+                                                  uint8_t isVoiceActive,
+                                                  uint32_t * pExtensionPayload )
+{
+    RtpResult_t result = RTP_RESULT_OK;
+    uint8_t level;
+
+    if( ( pExtensionPayload == NULL ) ||
+        ( id == 0 ) ||
+        ( id > 14 ) )
+    {
+        result = RTP_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        result = RtpAudioLevel_GetLevel( pCtx,
+                                         &( level ) );
+    }
+
+    if( result == RTP_RESULT_OK )
+    {
+        *pExtensionPayload = RTP_EXTENSION_AUDIO_LEVEL_CREATE_PAYLOAD( ( uint32_t ) id,
+                                                                       ( uint32_t ) ( ( isVoiceActive != 0 ) ? 1 : 0 ),
+                                                                       ( uint32_t ) level );
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
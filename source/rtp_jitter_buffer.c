@@ -0,0 +1,576 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "rtp_jitter_buffer.h"
+
+/*----------------------------------------------------------------------------*/
+
+#define GET_PACKET( pJitterBuffer, seqNum ) \
+    ( &( ( pJitterBuffer )->pPacketsArray[ ( seqNum ) % ( pJitterBuffer )->packetsArrayLength ] ) )
+
+/* Start extended sequence numbers one cycle in, so that packets reordered
+ * before the first one do not wrap below zero. */
+#define INITIAL_SEQ_NUM_CYCLE   0x10000
+
+/* States returned by FindFrameEnd. */
+#define FRAME_STATE_COMPLETE        0
+#define FRAME_STATE_INCOMPLETE      1
+#define FRAME_STATE_END_UNKNOWN     2
+
+/*----------------------------------------------------------------------------*/
+
+static void UpdateTargetDelay( RtpJitterBuffer_t * pJitterBuffer,
+                               uint32_t rtpTimestamp,
+                               uint32_t arrivalTimeMs,
+                               uint8_t isFirstPacket );
+
+static uint32_t FindHeldPacket( const RtpJitterBuffer_t * pJitterBuffer,
+                                uint32_t seqNum );
+
+static uint8_t IsFrameStart( const RtpJitterBuffer_t * pJitterBuffer,
+                             uint32_t seqNum );
+
+static uint8_t FindFrameEnd( const RtpJitterBuffer_t * pJitterBuffer,
+                             uint32_t firstSeqNum,
+                             uint32_t * pLastSeqNum );
+
+static RtpJitterBufferResult_t ReleasePackets( RtpJitterBuffer_t * pJitterBuffer,
+                                               uint32_t lastSeqNum,
+                                               uint8_t isReleaseToDepacketizer );
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Update the RFC 3550 interarrival jitter and the target delay.
+ */
+static void UpdateTargetDelay( RtpJitterBuffer_t * pJitterBuffer,
+                               uint32_t rtpTimestamp,
+                               uint32_t arrivalTimeMs,
+                               uint8_t isFirstPacket )
+{
+    uint32_t arrivalTime, transit, transitDelta, jitterMs, targetDelayMs;
+    int32_t delta;
+
+    arrivalTime = ( uint32_t ) ( ( ( uint64_t ) arrivalTimeMs * pJitterBuffer->clockRate ) / 1000 );
+    transit = arrivalTime - rtpTimestamp;
+
+    if( isFirstPacket == 0 )
+    {
+        delta = ( int32_t ) ( transit - pJitterBuffer->lastTransit );
+        transitDelta = ( delta < 0 ) ? ( uint32_t ) -delta : ( uint32_t ) delta;
+
+        /* J = J + ( |D| - J ) / 16, with J scaled by 16. */
+        pJitterBuffer->jitter += transitDelta - ( ( pJitterBuffer->jitter + 8 ) >> 4 );
+
+        jitterMs = ( uint32_t ) ( ( ( uint64_t ) pJitterBuffer->jitter * 1000 ) /
+                                  ( ( uint64_t ) pJitterBuffer->clockRate * 16 ) );
+        targetDelayMs = RTP_JITTER_BUFFER_JITTER_MULTIPLIER * jitterMs;
+
+        if( targetDelayMs < pJitterBuffer->minDelayMs )
+        {
+            targetDelayMs = pJitterBuffer->minDelayMs;
+        }
+        else if( targetDelayMs > pJitterBuffer->maxDelayMs )
+        {
+            targetDelayMs = pJitterBuffer->maxDelayMs;
+        }
+
+        pJitterBuffer->targetDelayMs = targetDelayMs;
+    }
+
+    pJitterBuffer->lastTransit = transit;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Find the first packet held from seqNum, which must not be past the
+ * highest packet held.
+ */
+static uint32_t FindHeldPacket( const RtpJitterBuffer_t * pJitterBuffer,
+                                uint32_t seqNum )
+{
+    while( ( GET_PACKET( pJitterBuffer, seqNum )->pPayload == NULL ) &&
+           ( seqNum != pJitterBuffer->highestSeqNum ) )
+    {
+        seqNum += 1;
+    }
+
+    return seqNum;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Check whether the packet at seqNum, the oldest one held, starts a
+ * frame.
+ *
+ * A frame start packet always does. Other start packets may also begin a NALU,
+ * OBU or layer inside a frame, so after the first frame they must directly
+ * follow a packet ending a frame - one with the marker bit or a different
+ * timestamp. If the previous packet was lost, the start of the frame may have
+ * been lost with it.
+ */
+static uint8_t IsFrameStart( const RtpJitterBuffer_t * pJitterBuffer,
+                             uint32_t seqNum )
+{
+    const RtpJitterBufferPacket_t * pPacket = GET_PACKET( pJitterBuffer, seqNum );
+    uint8_t isFrameStart = pPacket->isStartPacket;
+
+    if( ( isFrameStart == 1 ) &&
+        ( pPacket->isFrameStartPacket == 0 ) &&
+        ( pJitterBuffer->isFrameReleased == 1 ) )
+    {
+        if( ( seqNum != pJitterBuffer->nextSeqNum ) ||
+            ( pJitterBuffer->isPrevPacketHeld == 0 ) ||
+            ( ( pJitterBuffer->isPrevMarkerSet == 0 ) &&
+              ( pJitterBuffer->prevRtpTimestamp == pPacket->rtpTimestamp ) ) )
+        {
+            isFrameStart = 0;
+        }
+    }
+
+    return isFrameStart;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Find the last packet of the frame starting at firstSeqNum.
+ *
+ * The frame is complete if it begins with a frame start and all its packets
+ * are present. Its end is unknown if all the packets up to the highest one are
+ * present but none ends the frame, or if the packets lost after its last one
+ * are followed by a packet with a different timestamp, as they may either end
+ * the frame or begin the next one.
+ */
+static uint8_t FindFrameEnd( const RtpJitterBuffer_t * pJitterBuffer,
+                             uint32_t firstSeqNum,
+                             uint32_t * pLastSeqNum )
+{
+    const RtpJitterBufferPacket_t * pPacket, * pNextPacket;
+    uint32_t seqNum = firstSeqNum, nextSeqNum, rtpTimestamp;
+    uint8_t frameState = FRAME_STATE_INCOMPLETE, isSearching;
+
+    pPacket = GET_PACKET( pJitterBuffer, firstSeqNum );
+    rtpTimestamp = pPacket->rtpTimestamp;
+    isSearching = IsFrameStart( pJitterBuffer,
+                                firstSeqNum );
+
+    while( isSearching == 1 )
+    {
+        pPacket = GET_PACKET( pJitterBuffer, seqNum );
+
+        if( pPacket->isMarkerSet == 1 )
+        {
+            frameState = FRAME_STATE_COMPLETE;
+            isSearching = 0;
+        }
+        else if( seqNum == pJitterBuffer->highestSeqNum )
+        {
+            frameState = FRAME_STATE_END_UNKNOWN;
+            isSearching = 0;
+        }
+        else
+        {
+            nextSeqNum = FindHeldPacket( pJitterBuffer,
+                                         seqNum + 1 );
+            pNextPacket = GET_PACKET( pJitterBuffer, nextSeqNum );
+
+            if( nextSeqNum != ( seqNum + 1 ) )
+            {
+                /* The lost packets may end this frame or begin the next. */
+                if( pNextPacket->rtpTimestamp != rtpTimestamp )
+                {
+                    frameState = FRAME_STATE_END_UNKNOWN;
+                }
+
+                isSearching = 0;
+            }
+            else if( pNextPacket->rtpTimestamp != rtpTimestamp )
+            {
+                frameState = FRAME_STATE_COMPLETE;
+                isSearching = 0;
+            }
+            else
+            {
+                seqNum += 1;
+            }
+        }
+    }
+
+    *pLastSeqNum = seqNum;
+
+    return frameState;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief Remove the packets up to lastSeqNum, optionally adding them to the
+ * depacketizer.
+ */
+static RtpJitterBufferResult_t ReleasePackets( RtpJitterBuffer_t * pJitterBuffer,
+                                               uint32_t lastSeqNum,
+                                               uint8_t isReleaseToDepacketizer )
+{
+    RtpJitterBufferResult_t result = RTP_JITTER_BUFFER_RESULT_OK;
+    RtpJitterBufferPacket_t * pPacket;
+    CodecPacket_t codecPacket;
+    uint32_t seqNum;
+
+    for( seqNum = pJitterBuffer->nextSeqNum; seqNum != lastSeqNum + 1; seqNum++ )
+    {
+        pPacket = GET_PACKET( pJitterBuffer, seqNum );
+
+        if( pPacket->pPayload != NULL )
+        {
+            if( isReleaseToDepacketizer == 1 )
+            {
+                codecPacket.pPacketData = pPacket->pPayload;
+                codecPacket.packetDataLength = pPacket->payloadLength;
+
+                if( CodecDepacketizer_AddPacket( pJitterBuffer->pDepacketizer,
+                                                 &( codecPacket ) ) != CODEC_RESULT_OK )
+                {
+                    result = RTP_JITTER_BUFFER_RESULT_DEPACKETIZER_ERROR;
+                }
+            }
+
+            pJitterBuffer->prevRtpTimestamp = pPacket->rtpTimestamp;
+            pJitterBuffer->isPrevMarkerSet = pPacket->isMarkerSet;
+            pJitterBuffer->isPrevPacketHeld = 1;
+
+            pPacket->pPayload = NULL;
+            pJitterBuffer->packetCount -= 1;
+        }
+        else
+        {
+            pJitterBuffer->isPrevPacketHeld = 0;
+        }
+    }
+
+    pJitterBuffer->nextSeqNum = lastSeqNum + 1;
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+RtpJitterBufferResult_t RtpJitterBuffer_Init( RtpJitterBuffer_t * pJitterBuffer,
+                                              RtpJitterBufferPacket_t * pPacketsArray,
+                                              size_t packetsArrayLength,
+                                              CodecDepacketizer_t * pDepacketizer,
+                                              uint32_t clockRate )
+{
+    RtpJitterBufferResult_t result = RTP_JITTER_BUFFER_RESULT_OK;
+
+    if( ( pJitterBuffer == NULL ) ||
+        ( pPacketsArray == NULL ) ||
+        ( packetsArrayLength < 2 ) ||
+        ( packetsArrayLength > INITIAL_SEQ_NUM_CYCLE ) ||
+        ( pDepacketizer == NULL ) ||
+        ( clockRate == 0 ) )
+    {
+        result = RTP_JITTER_BUFFER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        pJitterBuffer->pPacketsArray = pPacketsArray;
+        pJitterBuffer->packetsArrayLength = packetsArrayLength;
+
+        memset( pJitterBuffer->pPacketsArray,
+                0,
+                sizeof( RtpJitterBufferPacket_t ) * pJitterBuffer->packetsArrayLength );
+
+        pJitterBuffer->packetCount = 0;
+        pJitterBuffer->pDepacketizer = pDepacketizer;
+        pJitterBuffer->clockRate = clockRate;
+        pJitterBuffer->nextSeqNum = 0;
+        pJitterBuffer->highestSeqNum = 0;
+        pJitterBuffer->isStarted = 0;
+        pJitterBuffer->isFrameReleased = 0;
+        pJitterBuffer->isPrevPacketHeld = 0;
+        pJitterBuffer->isPrevMarkerSet = 0;
+        pJitterBuffer->prevRtpTimestamp = 0;
+        pJitterBuffer->lastTransit = 0;
+        pJitterBuffer->jitter = 0;
+        pJitterBuffer->minDelayMs = RTP_JITTER_BUFFER_DEFAULT_MIN_DELAY_MS;
+        pJitterBuffer->maxDelayMs = RTP_JITTER_BUFFER_DEFAULT_MAX_DELAY_MS;
+        pJitterBuffer->targetDelayMs = RTP_JITTER_BUFFER_DEFAULT_MIN_DELAY_MS;
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+RtpJitterBufferResult_t RtpJitterBuffer_SetDelayRange( RtpJitterBuffer_t * pJitterBuffer,
+                                                       uint32_t minDelayMs,
+                                                       uint32_t maxDelayMs )
+{
+    RtpJitterBufferResult_t result = RTP_JITTER_BUFFER_RESULT_OK;
+
+    if( ( pJitterBuffer == NULL ) ||
+        ( minDelayMs > maxDelayMs ) )
+    {
+        result = RTP_JITTER_BUFFER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        pJitterBuffer->minDelayMs = minDelayMs;
+        pJitterBuffer->maxDelayMs = maxDelayMs;
+
+        if( pJitterBuffer->targetDelayMs < minDelayMs )
+        {
+            pJitterBuffer->targetDelayMs = minDelayMs;
+        }
+        else if( pJitterBuffer->targetDelayMs > maxDelayMs )
+        {
+            pJitterBuffer->targetDelayMs = maxDelayMs;
+        }
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+RtpJitterBufferResult_t RtpJitterBuffer_AddPacket( RtpJitterBuffer_t * pJitterBuffer,
+                                                   const RtpPacket_t * pRtpPacket,
+                                                   uint32_t arrivalTimeMs )
+{
+    RtpJitterBufferResult_t result = RTP_JITTER_BUFFER_RESULT_OK;
+    RtpJitterBufferPacket_t * pPacket = NULL;
+    uint32_t seqNum = 0, properties = 0;
+    int16_t seqNumDelta;
+    uint8_t isFirstPacket = 0;
+
+    if( ( pJitterBuffer == NULL ) ||
+        ( pRtpPacket == NULL ) ||
+        ( pRtpPacket->pPayload == NULL ) ||
+        ( pRtpPacket->payloadLength == 0 ) )
+    {
+        result = RTP_JITTER_BUFFER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        if( CodecDepacketizer_GetPacketProperties( pJitterBuffer->pDepacketizer,
+                                                   pRtpPacket->pPayload,
+                                                   pRtpPacket->payloadLength,
+                                                   &( properties ) ) != CODEC_RESULT_OK )
+        {
+            result = RTP_JITTER_BUFFER_RESULT_MALFORMED_PACKET;
+        }
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        if( pJitterBuffer->isStarted == 0 )
+        {
+            seqNum = INITIAL_SEQ_NUM_CYCLE + pRtpPacket->header.sequenceNumber;
+
+            pJitterBuffer->nextSeqNum = seqNum;
+            pJitterBuffer->highestSeqNum = seqNum;
+            pJitterBuffer->isStarted = 1;
+            isFirstPacket = 1;
+        }
+        else
+        {
+            /* Extend the sequence number using the closest cycle to the
+             * highest one. */
+            seqNumDelta = ( int16_t ) ( uint16_t ) ( pRtpPacket->header.sequenceNumber -
+                                                     ( uint16_t ) pJitterBuffer->highestSeqNum );
+            seqNum = ( uint32_t ) ( ( int32_t ) pJitterBuffer->highestSeqNum + seqNumDelta );
+        }
+
+        if( seqNum < pJitterBuffer->nextSeqNum )
+        {
+            /* Packets reordered before the first one are accepted until a
+             * frame is released. */
+            if( ( pJitterBuffer->isFrameReleased == 0 ) &&
+                ( ( pJitterBuffer->highestSeqNum - seqNum ) < pJitterBuffer->packetsArrayLength ) )
+            {
+                pJitterBuffer->nextSeqNum = seqNum;
+            }
+            else
+            {
+                result = RTP_JITTER_BUFFER_RESULT_LATE_PACKET;
+            }
+        }
+        else if( ( seqNum - pJitterBuffer->nextSeqNum ) >= pJitterBuffer->packetsArrayLength )
+        {
+            /* A sequence number jump past the packets array. Drop the packets
+             * held and restart from this one, as for the first packet. */
+            if( pJitterBuffer->packetCount > 0 )
+            {
+                ( void ) ReleasePackets( pJitterBuffer,
+                                         pJitterBuffer->highestSeqNum,
+                                         0 );
+            }
+
+            pJitterBuffer->nextSeqNum = seqNum;
+            pJitterBuffer->isFrameReleased = 0;
+            pJitterBuffer->isPrevPacketHeld = 0;
+        }
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        pPacket = GET_PACKET( pJitterBuffer, seqNum );
+
+        if( pPacket->pPayload != NULL )
+        {
+            result = RTP_JITTER_BUFFER_RESULT_DUPLICATE_PACKET;
+        }
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        pPacket->pPayload = pRtpPacket->pPayload;
+        pPacket->payloadLength = pRtpPacket->payloadLength;
+        pPacket->rtpTimestamp = pRtpPacket->header.timestamp;
+        pPacket->arrivalTimeMs = arrivalTimeMs;
+        pPacket->isStartPacket = ( ( properties & CODEC_PACKET_PROPERTY_START_PACKET ) != 0 ) ? 1 : 0;
+        pPacket->isFrameStartPacket = ( ( properties & CODEC_PACKET_PROPERTY_FRAME_START ) != 0 ) ? 1 : 0;
+        pPacket->isMarkerSet = ( ( pRtpPacket->header.flags & RTP_HEADER_FLAG_MARKER ) != 0 ) ? 1 : 0;
+
+        pJitterBuffer->packetCount += 1;
+
+        if( seqNum > pJitterBuffer->highestSeqNum )
+        {
+            pJitterBuffer->highestSeqNum = seqNum;
+        }
+
+        UpdateTargetDelay( pJitterBuffer,
+                           pRtpPacket->header.timestamp,
+                           arrivalTimeMs,
+                           isFirstPacket );
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+RtpJitterBufferResult_t RtpJitterBuffer_PopFrame( RtpJitterBuffer_t * pJitterBuffer,
+                                                  uint32_t currentTimeMs,
+                                                  uint32_t * pRtpTimestamp )
+{
+    RtpJitterBufferResult_t result = RTP_JITTER_BUFFER_RESULT_OK;
+    const RtpJitterBufferPacket_t * pFirstPacket = NULL, * pPacket, * pNextPacket;
+    uint32_t firstSeqNum = 0, lastSeqNum = 0;
+    uint8_t frameState = FRAME_STATE_INCOMPLETE, isDropping;
+
+    if( ( pJitterBuffer == NULL ) ||
+        ( pRtpTimestamp == NULL ) )
+    {
+        result = RTP_JITTER_BUFFER_RESULT_BAD_PARAM;
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        if( pJitterBuffer->packetCount == 0 )
+        {
+            result = RTP_JITTER_BUFFER_RESULT_NO_FRAME;
+        }
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        firstSeqNum = FindHeldPacket( pJitterBuffer,
+                                      pJitterBuffer->nextSeqNum );
+        pFirstPacket = GET_PACKET( pJitterBuffer, firstSeqNum );
+
+        if( ( currentTimeMs - pFirstPacket->arrivalTimeMs ) < pJitterBuffer->targetDelayMs )
+        {
+            result = RTP_JITTER_BUFFER_RESULT_NO_FRAME;
+        }
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        frameState = FindFrameEnd( pJitterBuffer,
+                                   firstSeqNum,
+                                   &( lastSeqNum ) );
+
+        /* Wait for the packet which ends the frame. If packets were lost
+         * after the frame, wait until the packet following them is due, then
+         * take the lost packets as the start of the next frame. */
+        if( frameState == FRAME_STATE_END_UNKNOWN )
+        {
+            if( lastSeqNum == pJitterBuffer->highestSeqNum )
+            {
+                result = RTP_JITTER_BUFFER_RESULT_NO_FRAME;
+            }
+            else
+            {
+                pNextPacket = GET_PACKET( pJitterBuffer,
+                                          FindHeldPacket( pJitterBuffer,
+                                                          lastSeqNum + 1 ) );
+
+                if( ( currentTimeMs - pNextPacket->arrivalTimeMs ) < pJitterBuffer->targetDelayMs )
+                {
+                    result = RTP_JITTER_BUFFER_RESULT_NO_FRAME;
+                }
+                else
+                {
+                    frameState = FRAME_STATE_COMPLETE;
+                }
+            }
+        }
+    }
+
+    if( result == RTP_JITTER_BUFFER_RESULT_OK )
+    {
+        *pRtpTimestamp = pFirstPacket->rtpTimestamp;
+        pJitterBuffer->isFrameReleased = 1;
+
+        if( frameState == FRAME_STATE_COMPLETE )
+        {
+            result = ReleasePackets( pJitterBuffer,
+                                     lastSeqNum,
+                                     1 );
+        }
+        else
+        {
+            /* Drop the packets up to a frame boundary - a packet with the
+             * marker bit or one followed by a packet with a different
+             * timestamp. */
+            lastSeqNum = firstSeqNum;
+            isDropping = 1;
+
+            while( ( isDropping == 1 ) &&
+                   ( lastSeqNum != pJitterBuffer->highestSeqNum ) )
+            {
+                pPacket = GET_PACKET( pJitterBuffer, lastSeqNum );
+                pNextPacket = GET_PACKET( pJitterBuffer, lastSeqNum + 1 );
+
+                if( ( ( pPacket->pPayload != NULL ) &&
+                      ( pPacket->isMarkerSet == 1 ) ) ||
+                    ( ( pNextPacket->pPayload != NULL ) &&
+                      ( pNextPacket->rtpTimestamp != pFirstPacket->rtpTimestamp ) ) )
+                {
+                    isDropping = 0;
+                }
+                else
+                {
+                    lastSeqNum += 1;
+                }
+            }
+
+            ( void ) ReleasePackets( pJitterBuffer,
+                                     lastSeqNum,
+                                     0 );
+            result = RTP_JITTER_BUFFER_RESULT_FRAME_DROPPED;
+        }
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
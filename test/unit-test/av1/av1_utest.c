@@ -0,0 +1,368 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "av1_depacketizer.h"
+#include "av1_packetizer.h"
+#include "av1_obu.h"
+
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define MAX_PACKETS_IN_A_FRAME  512
+#define MAX_FRAME_LENGTH        10 * 1024
+#define MAX_AV1_PACKET_LENGTH   8
+
+uint8_t frameBuffer[ MAX_FRAME_LENGTH ];
+
+/* Temporal delimiter, sequence header and frame OBUs. */
+static uint8_t temporalUnit[] = { 0x12, 0x00,
+                                  0x0a, 0x03, 0x00, 0x00, 0x01,
+                                  0x32, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19 };
+
+static uint8_t packet1[] = { 0x48, 0x04, 0x08, 0x00, 0x00, 0x01, 0x01, 0x30 };
+static uint8_t packet2[] = { 0xc0, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15 };
+static uint8_t packet3[] = { 0x80, 0x04, 0x16, 0x17, 0x18, 0x19 };
+
+void setUp( void )
+{
+    memset( &( frameBuffer[ 0 ] ),
+            0,
+            sizeof( frameBuffer ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases for Packetization ============================== */
+
+/**
+ * @brief Validate AV1 packetization happy path with aggregated and fragmented
+ * OBUs.
+ */
+void test_AV1_Packetizer_GetPacket( void )
+{
+    AV1PacketizerContext_t ctx = { 0 };
+    AV1Result_t result;
+    AV1Packet_t pkt;
+    AV1Frame_t frame;
+    uint8_t pktBuffer[ MAX_AV1_PACKET_LENGTH ];
+
+    frame.pFrameData = &( temporalUnit[ 0 ] );
+    frame.frameDataLength = sizeof( temporalUnit );
+    result = AV1Packetizer_Init( &( ctx ),
+                                 &( frame ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = MAX_AV1_PACKET_LENGTH;
+    result = AV1Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( packet1 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( packet1[ 0 ] ),
+                                   &( pktBuffer[ 0 ] ),
+                                   pkt.packetDataLength );
+
+    pkt.packetDataLength = MAX_AV1_PACKET_LENGTH;
+    result = AV1Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( packet2 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( packet2[ 0 ] ),
+                                   &( pktBuffer[ 0 ] ),
+                                   pkt.packetDataLength );
+
+    pkt.packetDataLength = MAX_AV1_PACKET_LENGTH;
+    result = AV1Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( packet3 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( packet3[ 0 ] ),
+                                   &( pktBuffer[ 0 ] ),
+                                   pkt.packetDataLength );
+
+    pkt.packetDataLength = MAX_AV1_PACKET_LENGTH;
+    result = AV1Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_NO_MORE_PACKETS,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate AV1 packetization with invalid parameters and frames.
+ */
+void test_AV1_Packetizer_BadParams( void )
+{
+    AV1PacketizerContext_t ctx = { 0 };
+    AV1Result_t result;
+    AV1Packet_t pkt;
+    AV1Frame_t frame;
+    uint8_t pktBuffer[ MAX_AV1_PACKET_LENGTH ];
+    uint8_t truncatedObu[] = { 0x32, 0x0a, 0x10, 0x11 };
+
+    result = AV1Packetizer_Init( NULL,
+                                 &( frame ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_BAD_PARAM,
+                       result );
+
+    frame.pFrameData = &( truncatedObu[ 0 ] );
+    frame.frameDataLength = sizeof( truncatedObu );
+    result = AV1Packetizer_Init( &( ctx ),
+                                 &( frame ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_MALFORMED_PACKET,
+                       result );
+
+    frame.pFrameData = &( temporalUnit[ 0 ] );
+    frame.frameDataLength = sizeof( temporalUnit );
+    result = AV1Packetizer_Init( &( ctx ),
+                                 &( frame ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+
+    /* No space for any OBU data after the aggregation header and length. */
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = 2;
+    result = AV1Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    result = AV1Packetizer_GetPacket( &( ctx ),
+                                      NULL );
+    TEST_ASSERT_EQUAL( AV1_RESULT_BAD_PARAM,
+                       result );
+}
+
+/* ==============================  Test Cases for Depacketization ============================== */
+
+/**
+ * @brief Validate AV1 depacketization happy path to get a temporal unit.
+ */
+void test_AV1_Depacketizer_GetFrame( void )
+{
+    AV1DepacketizerContext_t ctx = { 0 };
+    AV1Result_t result;
+    AV1Packet_t pkt;
+    AV1Frame_t frame;
+    AV1Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    /* W = 2 - the last OBU element has no length field. The sequence header
+     * keeps its size field. */
+    uint8_t packetWithW[] = { 0x20, 0x05, 0x0a, 0x03, 0x00, 0x00, 0x01, 0x30, 0x10, 0x11 };
+    uint8_t expectedFrame[] = { 0x12, 0x00,
+                                0x0a, 0x03, 0x00, 0x00, 0x01,
+                                0x32, 0x02, 0x10, 0x11 };
+
+    result = AV1Depacketizer_Init( &( ctx ),
+                                   &( packetsArray[ 0 ] ),
+                                   MAX_PACKETS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packet1[ 0 ] );
+    pkt.packetDataLength = sizeof( packet1 );
+    result = AV1Depacketizer_AddPacket( &( ctx ),
+                                        &( pkt ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packet2[ 0 ] );
+    pkt.packetDataLength = sizeof( packet2 );
+    result = AV1Depacketizer_AddPacket( &( ctx ),
+                                        &( pkt ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packet3[ 0 ] );
+    pkt.packetDataLength = sizeof( packet3 );
+    result = AV1Depacketizer_AddPacket( &( ctx ),
+                                        &( pkt ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = AV1Depacketizer_GetFrame( &( ctx ),
+                                       &( frame ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( temporalUnit ),
+                       frame.frameDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( temporalUnit[ 0 ] ),
+                                   &( frameBuffer[ 0 ] ),
+                                   frame.frameDataLength );
+
+    result = AV1Depacketizer_Init( &( ctx ),
+                                   &( packetsArray[ 0 ] ),
+                                   MAX_PACKETS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetWithW[ 0 ] );
+    pkt.packetDataLength = sizeof( packetWithW );
+    result = AV1Depacketizer_AddPacket( &( ctx ),
+                                        &( pkt ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = AV1Depacketizer_GetFrame( &( ctx ),
+                                       &( frame ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedFrame ),
+                       frame.frameDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedFrame[ 0 ] ),
+                                   &( frameBuffer[ 0 ] ),
+                                   frame.frameDataLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate AV1 depacketization of a fragment without its start and of
+ * a fragment which is never completed.
+ */
+void test_AV1_Depacketizer_MalformedPacket( void )
+{
+    AV1DepacketizerContext_t ctx = { 0 };
+    AV1Result_t result;
+    AV1Packet_t pkt;
+    AV1Frame_t frame;
+    AV1Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+
+    result = AV1Depacketizer_Init( &( ctx ),
+                                   &( packetsArray[ 0 ] ),
+                                   MAX_PACKETS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packet2[ 0 ] );
+    pkt.packetDataLength = sizeof( packet2 );
+    result = AV1Depacketizer_AddPacket( &( ctx ),
+                                        &( pkt ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = AV1Depacketizer_GetFrame( &( ctx ),
+                                       &( frame ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_MALFORMED_PACKET,
+                       result );
+
+    result = AV1Depacketizer_Init( &( ctx ),
+                                   &( packetsArray[ 0 ] ),
+                                   MAX_PACKETS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packet1[ 0 ] );
+    pkt.packetDataLength = sizeof( packet1 );
+    result = AV1Depacketizer_AddPacket( &( ctx ),
+                                        &( pkt ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = AV1Depacketizer_GetFrame( &( ctx ),
+                                       &( frame ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_MALFORMED_PACKET,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate AV1 packet properties.
+ */
+void test_AV1_Depacketizer_GetPacketProperties( void )
+{
+    AV1Result_t result;
+    uint32_t properties;
+
+    result = AV1Depacketizer_GetPacketProperties( &( packet1[ 0 ] ),
+                                                  sizeof( packet1 ),
+                                                  &( properties ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( AV1_PACKET_PROP_OBU_START | AV1_PACKET_PROP_NEW_SEQUENCE,
+                       properties );
+
+    result = AV1Depacketizer_GetPacketProperties( &( packet2[ 0 ] ),
+                                                  sizeof( packet2 ),
+                                                  &( properties ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       properties );
+
+    result = AV1Depacketizer_GetPacketProperties( NULL,
+                                                  sizeof( packet2 ),
+                                                  &( properties ) );
+    TEST_ASSERT_EQUAL( AV1_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate leb128 decoding of values wider than 32 bits.
+ */
+void test_AV1_Obu_ReadLeb128( void )
+{
+    uint8_t leb128Max32[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x0F };
+    uint8_t leb128Above32[] = { 0x80, 0x80, 0x80, 0x80, 0x10 };
+    uint8_t leb128Unterminated[] = { 0x80, 0x80 };
+    size_t value = 0, bytesRead;
+
+    bytesRead = AV1Obu_ReadLeb128( &( leb128Max32[ 0 ] ),
+                                   sizeof( leb128Max32 ),
+                                   &( value ) );
+    TEST_ASSERT_EQUAL( 5,
+                       bytesRead );
+    TEST_ASSERT_EQUAL( 0xFFFFFFFFU,
+                       value );
+
+    /* 2^32 is decoded, or rejected if it does not fit in size_t. */
+    value = 0;
+    bytesRead = AV1Obu_ReadLeb128( &( leb128Above32[ 0 ] ),
+                                   sizeof( leb128Above32 ),
+                                   &( value ) );
+
+    if( sizeof( size_t ) > sizeof( uint32_t ) )
+    {
+        TEST_ASSERT_EQUAL( 5,
+                           bytesRead );
+        TEST_ASSERT_EQUAL( 0x100000000ULL,
+                           ( uint64_t ) value );
+    }
+    else
+    {
+        TEST_ASSERT_EQUAL( 0,
+                           bytesRead );
+    }
+
+    bytesRead = AV1Obu_ReadLeb128( &( leb128Unterminated[ 0 ] ),
+                                   sizeof( leb128Unterminated ),
+                                   &( value ) );
+    TEST_ASSERT_EQUAL( 0,
+                       bytesRead );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,701 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "codec_interface.h"
+#include "av1_interface.h"
+#include "g711_interface.h"
+#include "h264_interface.h"
+#include "h265_interface.h"
+#include "opus_interface.h"
+#include "vp8_interface.h"
+#include "vp9_interface.h"
+#include "simple_payload_assembler.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define MAX_FRAME_LENGTH        1024
+#define MAX_PACKETS_IN_A_FRAME  16
+#define PACKET_BUFFER_LENGTH    10
+
+uint8_t packetBuffers[ MAX_PACKETS_IN_A_FRAME ][ PACKET_BUFFER_LENGTH ];
+uint8_t frameBuffer[ MAX_FRAME_LENGTH ];
+
+void setUp( void )
+{
+    memset( &( packetBuffers[ 0 ][ 0 ] ),
+            0,
+            sizeof( packetBuffers ) );
+    memset( &( frameBuffer[ 0 ] ),
+            0,
+            sizeof( frameBuffer ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Helpers ============================== */
+
+/* Codec agnostic send and receive loop. The frame is sent twice to check that
+ * nothing is left over from the first frame. */
+static void PacketizeAndDepacketize( CodecPacketizer_t * pPacketizer,
+                                     CodecDepacketizer_t * pDepacketizer,
+                                     CodecFrame_t * pFrame,
+                                     size_t expectedPacketCount )
+{
+    CodecResult_t result;
+    CodecPacket_t packets[ MAX_PACKETS_IN_A_FRAME ];
+    CodecFrame_t frame;
+    uint32_t properties;
+    size_t i, frameIndex, packetCount;
+
+    for( frameIndex = 0; frameIndex < 2; frameIndex++ )
+    {
+        for( i = 0; i < MAX_PACKETS_IN_A_FRAME; i++ )
+        {
+            packets[ i ].pPacketData = &( packetBuffers[ i ][ 0 ] );
+            packets[ i ].packetDataLength = PACKET_BUFFER_LENGTH;
+        }
+
+        result = CodecPacketizer_AddFrame( pPacketizer,
+                                           pFrame );
+        TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                           result );
+
+        /* Too few packets for the frame. */
+        result = CodecPacketizer_GetPackets( pPacketizer,
+                                             &( packets[ 0 ] ),
+                                             1,
+                                             &( packetCount ) );
+        TEST_ASSERT_EQUAL( CODEC_RESULT_OUT_OF_MEMORY,
+                           result );
+        TEST_ASSERT_EQUAL( 1,
+                           packetCount );
+
+        result = CodecPacketizer_GetPackets( pPacketizer,
+                                             &( packets[ 1 ] ),
+                                             MAX_PACKETS_IN_A_FRAME - 1,
+                                             &( packetCount ) );
+        TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( expectedPacketCount - 1,
+                           packetCount );
+
+        for( i = 0; i < expectedPacketCount; i++ )
+        {
+            result = CodecDepacketizer_GetPacketProperties( pDepacketizer,
+                                                            packets[ i ].pPacketData,
+                                                            packets[ i ].packetDataLength,
+                                                            &( properties ) );
+            TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                               result );
+
+            if( i == 0 )
+            {
+                TEST_ASSERT_EQUAL( CODEC_PACKET_PROPERTY_START_PACKET,
+                                   properties & CODEC_PACKET_PROPERTY_START_PACKET );
+            }
+
+            result = CodecDepacketizer_AddPacket( pDepacketizer,
+                                                  &( packets[ i ] ) );
+            TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                               result );
+        }
+
+        frame.pFrameData = &( frameBuffer[ 0 ] );
+        frame.frameDataLength = sizeof( frameBuffer );
+
+        result = CodecDepacketizer_GetFrame( pDepacketizer,
+                                             &( frame ) );
+        TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( pFrame->frameDataLength,
+                           frame.frameDataLength );
+        TEST_ASSERT_EQUAL_UINT8_ARRAY( &( pFrame->pFrameData[ 0 ] ),
+                                       &( frame.pFrameData[ 0 ] ),
+                                       frame.frameDataLength );
+    }
+}
+
+/* ==============================  Test Cases ============================== */
+
+/**
+ * @brief Validate G.711 packetization and depacketization through the common
+ * interface.
+ */
+void test_Codec_Interface_G711( void )
+{
+    CodecResult_t result;
+    G711PacketizerContext_t packetizerCtx = { 0 };
+    G711DepacketizerContext_t depacketizerCtx = { 0 };
+    G711Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    CodecPacketizer_t packetizer;
+    CodecDepacketizer_t depacketizer;
+    CodecFrame_t frame;
+    uint8_t frameData[ 40 ];
+    uint32_t properties;
+    size_t i;
+
+    for( i = 0; i < sizeof( frameData ); i++ )
+    {
+        frameData[ i ] = ( uint8_t ) i;
+    }
+
+    /* 8 kHz and 1 ms - 8 samples per packet. */
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       G711Packetizer_InitWithPacketTime( &( packetizerCtx ),
+                                                          8000,
+                                                          1,
+                                                          0 ) );
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       G711Depacketizer_Init( &( depacketizerCtx ),
+                                              &( packetsArray[ 0 ] ),
+                                              MAX_PACKETS_IN_A_FRAME ) );
+
+    result = G711Interface_InitPacketizer( &( packetizer ),
+                                           &( packetizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    result = G711Interface_InitDepacketizer( &( depacketizer ),
+                                             &( depacketizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( frameData[ 0 ] );
+    frame.frameDataLength = sizeof( frameData );
+
+    PacketizeAndDepacketize( &( packetizer ),
+                             &( depacketizer ),
+                             &( frame ),
+                             5 );
+
+    /* Every G.711 packet begins a frame. */
+    result = CodecDepacketizer_GetPacketProperties( &( depacketizer ),
+                                                    &( packetBuffers[ 1 ][ 0 ] ),
+                                                    8,
+                                                    &( properties ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( CODEC_PACKET_PROPERTY_FRAME_START,
+                       properties & CODEC_PACKET_PROPERTY_FRAME_START );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H.264 packetization and depacketization through the common
+ * interface.
+ */
+void test_Codec_Interface_H264( void )
+{
+    CodecResult_t result;
+    H264PacketizerContext_t packetizerCtx = { 0 };
+    H264DepacketizerContext_t depacketizerCtx = { 0 };
+    Nalu_t naluArray[ MAX_PACKETS_IN_A_FRAME ];
+    H264Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    CodecPacketizer_t packetizer;
+    CodecDepacketizer_t depacketizer;
+    CodecFrame_t frame;
+    uint32_t properties;
+    uint8_t frameData[] =
+    {
+        0x00, 0x00, 0x00, 0x01, 0x67, 0x42, 0xC0, 0x1F,
+        0x00, 0x00, 0x00, 0x01, 0x68, 0xCE, 0x3C,
+        0x00, 0x00, 0x00, 0x01, 0x65, 0x88, 0x84, 0x21, 0xA0, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60
+    };
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Packetizer_Init( &( packetizerCtx ),
+                                            &( naluArray[ 0 ] ),
+                                            MAX_PACKETS_IN_A_FRAME ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Depacketizer_Init( &( depacketizerCtx ),
+                                              &( packetsArray[ 0 ] ),
+                                              MAX_PACKETS_IN_A_FRAME ) );
+
+    result = H264Interface_InitPacketizer( &( packetizer ),
+                                           &( packetizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    result = H264Interface_InitDepacketizer( &( depacketizer ),
+                                             &( depacketizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( frameData[ 0 ] );
+    frame.frameDataLength = sizeof( frameData );
+
+    /* SPS and PPS in single NALU packets, IDR in two FU-A packets. */
+    PacketizeAndDepacketize( &( packetizer ),
+                             &( depacketizer ),
+                             &( frame ),
+                             4 );
+
+    /* A NAL unit start does not tell that a frame begins. */
+    result = CodecDepacketizer_GetPacketProperties( &( depacketizer ),
+                                                    &( packetBuffers[ 0 ][ 0 ] ),
+                                                    4,
+                                                    &( properties ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( CODEC_PACKET_PROPERTY_START_PACKET,
+                       properties & ( CODEC_PACKET_PROPERTY_START_PACKET | CODEC_PACKET_PROPERTY_FRAME_START ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H.265 packetization and depacketization through the common
+ * interface.
+ */
+void test_Codec_Interface_H265( void )
+{
+    CodecResult_t result;
+    H265PacketizerContext_t packetizerCtx = { 0 };
+    H265DepacketizerContext_t depacketizerCtx = { 0 };
+    H265Nalu_t naluArray[ MAX_PACKETS_IN_A_FRAME ];
+    H265Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    CodecPacketizer_t packetizer;
+    CodecDepacketizer_t depacketizer;
+    CodecFrame_t frame;
+    uint8_t frameData[] =
+    {
+        0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x0C, 0x01,
+        0x00, 0x00, 0x00, 0x01, 0x42, 0x01, 0x01,
+        0x00, 0x00, 0x00, 0x01, 0x26, 0x01, 0xAF, 0x06, 0xB8, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60
+    };
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Packetizer_Init( &( packetizerCtx ),
+                                            &( naluArray[ 0 ] ),
+                                            MAX_PACKETS_IN_A_FRAME ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Depacketizer_Init( &( depacketizerCtx ),
+                                              &( packetsArray[ 0 ] ),
+                                              MAX_PACKETS_IN_A_FRAME ) );
+
+    result = H265Interface_InitPacketizer( &( packetizer ),
+                                           &( packetizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    result = H265Interface_InitDepacketizer( &( depacketizer ),
+                                             &( depacketizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( frameData[ 0 ] );
+    frame.frameDataLength = sizeof( frameData );
+
+    /* VPS and SPS in single NALU packets, IDR in two FU packets. */
+    PacketizeAndDepacketize( &( packetizer ),
+                             &( depacketizer ),
+                             &( frame ),
+                             4 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate AV1 packetization and depacketization through the common
+ * interface.
+ */
+void test_Codec_Interface_AV1( void )
+{
+    CodecResult_t result;
+    AV1PacketizerContext_t packetizerCtx = { 0 };
+    AV1DepacketizerContext_t depacketizerCtx = { 0 };
+    AV1Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    CodecPacketizer_t packetizer;
+    CodecDepacketizer_t depacketizer;
+    CodecFrame_t frame;
+    /* Temporal delimiter, sequence header and frame OBUs. */
+    uint8_t frameData[] =
+    {
+        0x12, 0x00,
+        0x0A, 0x03, 0x00, 0x00, 0x01,
+        0x32, 0x0A, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19
+    };
+
+    TEST_ASSERT_EQUAL( AV1_RESULT_OK,
+                       AV1Depacketizer_Init( &( depacketizerCtx ),
+                                             &( packetsArray[ 0 ] ),
+                                             MAX_PACKETS_IN_A_FRAME ) );
+
+    result = AV1Interface_InitPacketizer( &( packetizer ),
+                                          &( packetizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    result = AV1Interface_InitDepacketizer( &( depacketizer ),
+                                            &( depacketizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( frameData[ 0 ] );
+    frame.frameDataLength = sizeof( frameData );
+
+    PacketizeAndDepacketize( &( packetizer ),
+                             &( depacketizer ),
+                             &( frame ),
+                             2 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate VP8 packetization and depacketization through the common
+ * interface.
+ */
+void test_Codec_Interface_VP8( void )
+{
+    CodecResult_t result;
+    VP8InterfacePacketizerContext_t packetizerCtx = { 0 };
+    VP8DepacketizerContext_t depacketizerCtx = { 0 };
+    VP8Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    CodecPacketizer_t packetizer;
+    CodecDepacketizer_t depacketizer;
+    CodecFrame_t frame;
+    uint8_t frameData[ 15 ];
+    size_t i;
+
+    for( i = 0; i < sizeof( frameData ); i++ )
+    {
+        frameData[ i ] = ( uint8_t ) i;
+    }
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       VP8Packetizer_InitStream( &( packetizerCtx.streamCtx ),
+                                                 VP8_FRAME_PROP_PICTURE_ID_PRESENT,
+                                                 0x7FFF,
+                                                 0 ) );
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       VP8Depacketizer_Init( &( depacketizerCtx ),
+                                             &( packetsArray[ 0 ] ),
+                                             MAX_PACKETS_IN_A_FRAME ) );
+
+    result = VP8Interface_InitPacketizer( &( packetizer ),
+                                          &( packetizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    result = VP8Interface_InitDepacketizer( &( depacketizer ),
+                                            &( depacketizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( frameData[ 0 ] );
+    frame.frameDataLength = sizeof( frameData );
+
+    /* 4 bytes of payload descriptor and 6 bytes of frame data per packet. */
+    PacketizeAndDepacketize( &( packetizer ),
+                             &( depacketizer ),
+                             &( frame ),
+                             3 );
+
+    /* The second frame carries the next picture ID, which wraps to 0. */
+    TEST_ASSERT_EQUAL( 0x80,
+                       packetBuffers[ 0 ][ 2 ] );
+    TEST_ASSERT_EQUAL( 0x00,
+                       packetBuffers[ 0 ][ 3 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate VP9 packetization and depacketization through the common
+ * interface.
+ */
+void test_Codec_Interface_VP9( void )
+{
+    CodecResult_t result;
+    VP9PacketizerContext_t packetizerCtx = { 0 };
+    VP9DepacketizerContext_t depacketizerCtx = { 0 };
+    VP9Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    CodecPacketizer_t packetizer;
+    CodecDepacketizer_t depacketizer;
+    CodecFrame_t frame;
+    uint8_t frameData[ 20 ];
+    uint8_t baseLayerStart[] = { 0x28, 0x00, 0x00, 0xAA }; /* L and B, SID 0. */
+    uint8_t upperLayerStart[] = { 0x28, 0x02, 0x00, 0xAA }; /* L and B, SID 1. */
+    uint32_t properties;
+    size_t i;
+
+    for( i = 0; i < sizeof( frameData ); i++ )
+    {
+        frameData[ i ] = ( uint8_t ) i;
+    }
+
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       VP9Depacketizer_Init( &( depacketizerCtx ),
+                                             &( packetsArray[ 0 ] ),
+                                             MAX_PACKETS_IN_A_FRAME ) );
+
+    result = VP9Interface_InitPacketizer( &( packetizer ),
+                                          &( packetizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    result = VP9Interface_InitDepacketizer( &( depacketizer ),
+                                            &( depacketizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( frameData[ 0 ] );
+    frame.frameDataLength = sizeof( frameData );
+
+    /* Uncompressed header of a profile 0 key frame. */
+    frameData[ 0 ] = 0x82;
+
+    /* 1 byte of payload descriptor and 9 bytes of frame data per packet. */
+    PacketizeAndDepacketize( &( packetizer ),
+                             &( depacketizer ),
+                             &( frame ),
+                             3 );
+    TEST_ASSERT_EQUAL( 0,
+                       packetBuffers[ 0 ][ 0 ] & VP9_PAYLOAD_DESC_P_BITMASK );
+
+    /* Uncompressed header of a profile 0 inter frame. */
+    frameData[ 0 ] = 0x86;
+
+    PacketizeAndDepacketize( &( packetizer ),
+                             &( depacketizer ),
+                             &( frame ),
+                             3 );
+    TEST_ASSERT_EQUAL( VP9_PAYLOAD_DESC_P_BITMASK,
+                       packetBuffers[ 0 ][ 0 ] & VP9_PAYLOAD_DESC_P_BITMASK );
+
+    /* Only the start of the base spatial layer begins a frame. */
+    result = CodecDepacketizer_GetPacketProperties( &( depacketizer ),
+                                                    &( baseLayerStart[ 0 ] ),
+                                                    sizeof( baseLayerStart ),
+                                                    &( properties ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( CODEC_PACKET_PROPERTY_FRAME_START,
+                       properties & CODEC_PACKET_PROPERTY_FRAME_START );
+
+    result = CodecDepacketizer_GetPacketProperties( &( depacketizer ),
+                                                    &( upperLayerStart[ 0 ] ),
+                                                    sizeof( upperLayerStart ),
+                                                    &( properties ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( CODEC_PACKET_PROPERTY_START_PACKET,
+                       properties & ( CODEC_PACKET_PROPERTY_START_PACKET | CODEC_PACKET_PROPERTY_FRAME_START ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Opus packetization and depacketization through the common
+ * interface.
+ */
+void test_Codec_Interface_Opus( void )
+{
+    CodecResult_t result;
+    OpusPacketizerContext_t packetizerCtx = { 0 };
+    OpusDepacketizerContext_t depacketizerCtx = { 0 };
+    OpusPacket_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    CodecPacketizer_t packetizer;
+    CodecDepacketizer_t depacketizer;
+    CodecFrame_t frame;
+    /* TOC for a single 20 ms frame, followed by the frame. */
+    uint8_t frameData[] = { 0x78, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+
+    TEST_ASSERT_EQUAL( OPUS_RESULT_OK,
+                       OpusDepacketizer_Init( &( depacketizerCtx ),
+                                              &( packetsArray[ 0 ] ),
+                                              MAX_PACKETS_IN_A_FRAME ) );
+
+    result = OpusInterface_InitPacketizer( &( packetizer ),
+                                           &( packetizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    result = OpusInterface_InitDepacketizer( &( depacketizer ),
+                                             &( depacketizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( frameData[ 0 ] );
+    frame.frameDataLength = sizeof( frameData );
+
+    PacketizeAndDepacketize( &( packetizer ),
+                             &( depacketizer ),
+                             &( frame ),
+                             1 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the simple payload assembler reuses the packets array
+ * as a ring.
+ */
+void test_Simple_Payload_Assembler( void )
+{
+    CodecResult_t result;
+    SimplePayloadAssembler_t assembler;
+    CodecPacket_t packetsArray[ 2 ], packet;
+    CodecFrame_t frame;
+    uint8_t packetData1[] = { 0x00, 0x01, 0x02 };
+    uint8_t packetData2[] = { 0x10, 0x11 };
+    uint8_t packetData3[] = { 0x20, 0x21, 0x22, 0x23 };
+    uint8_t expectedFrame[] = { 0x10, 0x11, 0x20, 0x21, 0x22, 0x23 };
+
+    result = SimplePayloadAssembler_Init( &( assembler ),
+                                          &( packetsArray[ 0 ] ),
+                                          2 );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    packet.pPacketData = &( packetData1[ 0 ] );
+    packet.packetDataLength = sizeof( packetData1 );
+    result = SimplePayloadAssembler_AddPacket( &( assembler ),
+                                               &( packet ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    packet.pPacketData = &( packetData2[ 0 ] );
+    packet.packetDataLength = sizeof( packetData2 );
+    result = SimplePayloadAssembler_AddPacket( &( assembler ),
+                                               &( packet ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    packet.pPacketData = &( packetData3[ 0 ] );
+    packet.packetDataLength = sizeof( packetData3 );
+    result = SimplePayloadAssembler_AddPacket( &( assembler ),
+                                               &( packet ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    /* The returned packet refers to the packet buffer. */
+    result = SimplePayloadAssembler_GetPacket( &( assembler ),
+                                               &( packet ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_PTR( &( packetData1[ 0 ] ),
+                           packet.pPacketData );
+    TEST_ASSERT_EQUAL( sizeof( packetData1 ),
+                       packet.packetDataLength );
+
+    /* The freed entry is reused. */
+    packet.pPacketData = &( packetData3[ 0 ] );
+    packet.packetDataLength = sizeof( packetData3 );
+    result = SimplePayloadAssembler_AddPacket( &( assembler ),
+                                               &( packet ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    /* Nothing is removed if the frame buffer is too small. */
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = sizeof( expectedFrame ) - 1;
+    result = SimplePayloadAssembler_GetFrame( &( assembler ),
+                                              &( frame ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    frame.frameDataLength = sizeof( frameBuffer );
+    result = SimplePayloadAssembler_GetFrame( &( assembler ),
+                                              &( frame ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedFrame ),
+                       frame.frameDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedFrame[ 0 ] ),
+                                   &( frame.pFrameData[ 0 ] ),
+                                   frame.frameDataLength );
+
+    result = SimplePayloadAssembler_PeekPacket( &( assembler ),
+                                                &( packet ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_NO_MORE_PACKETS,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that results of the simple payload assembler are mapped to
+ * codec results and that unknown results are mapped to an error.
+ */
+void test_Simple_Payload_Assembler_MapResult( void )
+{
+    const uint32_t resultMap[] = { G711_RESULT_OK, G711_RESULT_BAD_PARAM, G711_RESULT_OUT_OF_MEMORY, G711_RESULT_NO_MORE_PACKETS };
+
+    TEST_ASSERT_EQUAL( G711_RESULT_NO_MORE_PACKETS,
+                       SimplePayloadAssembler_MapResult( CODEC_RESULT_NO_MORE_PACKETS,
+                                                         &( resultMap[ 0 ] ),
+                                                         sizeof( resultMap ) / sizeof( resultMap[ 0 ] ),
+                                                         G711_RESULT_BAD_PARAM ) );
+    TEST_ASSERT_EQUAL( G711_RESULT_BAD_PARAM,
+                       SimplePayloadAssembler_MapResult( CODEC_RESULT_INCOMPLETE_FRAME,
+                                                         &( resultMap[ 0 ] ),
+                                                         sizeof( resultMap ) / sizeof( resultMap[ 0 ] ),
+                                                         G711_RESULT_BAD_PARAM ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the common interface in case of bad parameters.
+ */
+void test_Codec_Interface_BadParams( void )
+{
+    CodecResult_t result;
+    G711PacketizerContext_t packetizerCtx = { 0 };
+    CodecPacketizer_t packetizer = { 0 };
+    CodecDepacketizer_t depacketizer = { 0 };
+    CodecPacket_t packet;
+    CodecFrame_t frame;
+    size_t packetCount;
+
+    result = G711Interface_InitPacketizer( NULL,
+                                           &( packetizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_BAD_PARAM,
+                       result );
+
+    result = G711Interface_InitDepacketizer( &( depacketizer ),
+                                             NULL );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_BAD_PARAM,
+                       result );
+
+    /* Interfaces not initialized. */
+    result = CodecPacketizer_GetPacket( &( packetizer ),
+                                        &( packet ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_BAD_PARAM,
+                       result );
+
+    result = CodecDepacketizer_GetFrame( &( depacketizer ),
+                                         &( frame ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_BAD_PARAM,
+                       result );
+
+    result = G711Interface_InitPacketizer( &( packetizer ),
+                                           &( packetizerCtx ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       result );
+
+    result = CodecPacketizer_AddFrame( &( packetizer ),
+                                       NULL );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_BAD_PARAM,
+                       result );
+
+    result = CodecPacketizer_GetPackets( &( packetizer ),
+                                         &( packet ),
+                                         0,
+                                         &( packetCount ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
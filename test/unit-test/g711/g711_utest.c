@@ -9,6 +9,7 @@
 /* API includes. */
 #include "g711_packetizer.h"
 #include "g711_depacketizer.h"
+#include "g711_codec.h"
 
 
 /* ===========================  EXTERN VARIABLES  =========================== */
@@ -88,6 +89,117 @@ void test_G711_Packetizer( void )
 
 /*-----------------------------------------------------------*/
 
+/**
+ * @brief Validate G711 packetization by packet time.
+ */
+void test_G711_Packetizer_PacketTime( void )
+{
+    G711Result_t result;
+    uint8_t frameData[ 480 ], packetBuffer[ 200 ];
+    G711PacketizerContext_t ctx = { 0 };
+    G711Packet_t pkt;
+    G711Frame_t frame;
+    uint32_t timestamp, expectedTimestamp = 0xFFFFFF00;
+    size_t i, packetCount = 0;
+
+    for( i = 0; i < sizeof( frameData ); i++ )
+    {
+        frameData[ i ] = ( uint8_t ) i;
+    }
+
+    /* 44.1 kHz and 15 ms is not a whole number of samples. */
+    result = G711Packetizer_InitWithPacketTime( &( ctx ),
+                                                44100,
+                                                15,
+                                                0 );
+    TEST_ASSERT_EQUAL( G711_RESULT_BAD_PARAM,
+                       result );
+
+    /* 8 kHz and 20 ms - 160 samples per packet. */
+    result = G711Packetizer_InitWithPacketTime( &( ctx ),
+                                                8000,
+                                                20,
+                                                expectedTimestamp );
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( frameData[ 0 ] );
+    frame.frameDataLength = 320;
+
+    result = G711Packetizer_AddFrame( &( ctx ),
+                                      &( frame ) );
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetBuffer[ 0 ] );
+    pkt.packetDataLength = 100;
+    result = G711Packetizer_GetPacketWithTimestamp( &( ctx ),
+                                                    &( pkt ),
+                                                    &( timestamp ) );
+    TEST_ASSERT_EQUAL( G711_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    while( packetCount < 3 )
+    {
+        pkt.pPacketData = &( packetBuffer[ 0 ] );
+        pkt.packetDataLength = sizeof( packetBuffer );
+        result = G711Packetizer_GetPacketWithTimestamp( &( ctx ),
+                                                        &( pkt ),
+                                                        &( timestamp ) );
+
+        if( result == G711_RESULT_NO_MORE_PACKETS )
+        {
+            /* A frame which is not a multiple of the packet time. */
+            frame.pFrameData = &( frameData[ 320 ] );
+            frame.frameDataLength = 80;
+
+            result = G711Packetizer_AddFrame( &( ctx ),
+                                              &( frame ) );
+            TEST_ASSERT_EQUAL( G711_RESULT_BAD_PARAM,
+                               result );
+
+            frame.frameDataLength = 160;
+
+            result = G711Packetizer_AddFrame( &( ctx ),
+                                              &( frame ) );
+            TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                               result );
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                               result );
+            TEST_ASSERT_EQUAL( 160,
+                               pkt.packetDataLength );
+            TEST_ASSERT_EQUAL( expectedTimestamp,
+                               timestamp );
+            TEST_ASSERT_EQUAL_UINT8_ARRAY( &( frameData[ packetCount * 160 ] ),
+                                           &( pkt.pPacketData[ 0 ] ),
+                                           pkt.packetDataLength );
+
+            expectedTimestamp += ( uint32_t ) pkt.packetDataLength;
+            packetCount += 1;
+
+            if( packetCount == 1 )
+            {
+                /* The first frame still has a packet to retrieve. */
+                frame.pFrameData = &( frameData[ 320 ] );
+                frame.frameDataLength = 160;
+
+                result = G711Packetizer_AddFrame( &( ctx ),
+                                                  &( frame ) );
+                TEST_ASSERT_EQUAL( G711_RESULT_OUT_OF_MEMORY,
+                                   result );
+            }
+        }
+    }
+
+    TEST_ASSERT_EQUAL( expectedTimestamp,
+                       ctx.timestamp );
+}
+
+/*-----------------------------------------------------------*/
+
 /**
  * @brief Validate G711_Packetizer_Init in case of bad parameters.
  */
@@ -458,3 +570,129 @@ void test_G711_Depacketizer_GetPacketProperties_BadParams( void )
 }
 
 /*-----------------------------------------------------------*/
+
+/* ==============================  Test Cases for Transcoding ============================== */
+
+/**
+ * @brief Validate G.711 encode and decode against known values and round trip.
+ */
+void test_G711_Codec( void )
+{
+    G711Result_t result;
+    int16_t pcmSamples[] = { 0, 8, -8, 1000, -1000, 32767, -32768 };
+    /* Reference values from the ITU-T G.711 tables. */
+    uint8_t expectedMuLaw[] = { 0xFF, 0xFE, 0x7E, 0xCE, 0x4E, 0x80, 0x00 };
+    uint8_t expectedALaw[] = { 0xD5, 0xD5, 0x55, 0xFA, 0x7A, 0xAA, 0x2A };
+    /* Codes at the ends of the range, at zero and where the tables differ from
+     * converting through linear PCM, with values from the G.711 tables. */
+    uint8_t aLawCodes[] = { 0x00, 0x0F, 0x2A, 0x55, 0x80, 0x8A, 0xAA, 0xD5 };
+    uint8_t expectedALawToMuLaw[] = { 0x2A, 0x25, 0x00, 0x7E, 0xAA, 0xA0, 0x80, 0xFE };
+    uint8_t muLawCodes[] = { 0x00, 0x21, 0x2E, 0x3F, 0x4F, 0x7F, 0xFF, 0xA9 };
+    uint8_t expectedMuLawToALaw[] = { 0x2A, 0x0B, 0x04, 0x6A, 0x78, 0x55, 0xD5, 0x83 };
+    uint8_t encodedSamples[ 256 ], codes[ 256 ], transcodedSamples[ 256 ];
+    int16_t decodedSamples[ 256 ], redecodedSamples[ 256 ];
+    size_t i;
+
+    result = G711Codec_MuLawEncode( &( pcmSamples[ 0 ] ),
+                                    sizeof( pcmSamples ) / sizeof( pcmSamples[ 0 ] ),
+                                    &( encodedSamples[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedMuLaw[ 0 ] ),
+                                   &( encodedSamples[ 0 ] ),
+                                   sizeof( expectedMuLaw ) );
+
+    result = G711Codec_ALawEncode( &( pcmSamples[ 0 ] ),
+                                   sizeof( pcmSamples ) / sizeof( pcmSamples[ 0 ] ),
+                                   &( encodedSamples[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedALaw[ 0 ] ),
+                                   &( encodedSamples[ 0 ] ),
+                                   sizeof( expectedALaw ) );
+
+    for( i = 0; i < 256; i++ )
+    {
+        codes[ i ] = ( uint8_t ) i;
+    }
+
+    /* Decoding and encoding again must give the same level for all codes. */
+    result = G711Codec_MuLawDecode( &( codes[ 0 ] ),
+                                    256,
+                                    &( decodedSamples[ 0 ] ) );
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( -32124,
+                       decodedSamples[ 0x00 ] );
+    TEST_ASSERT_EQUAL( 32124,
+                       decodedSamples[ 0x80 ] );
+
+    result = G711Codec_MuLawEncode( &( decodedSamples[ 0 ] ),
+                                    256,
+                                    &( encodedSamples[ 0 ] ) );
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       result );
+
+    result = G711Codec_MuLawDecode( &( encodedSamples[ 0 ] ),
+                                    256,
+                                    &( redecodedSamples[ 0 ] ) );
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_INT16_ARRAY( &( decodedSamples[ 0 ] ),
+                                   &( redecodedSamples[ 0 ] ),
+                                   256 );
+
+    result = G711Codec_ALawDecode( &( codes[ 0 ] ),
+                                   256,
+                                   &( decodedSamples[ 0 ] ) );
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( -32256,
+                       decodedSamples[ 0x2A ] );
+    TEST_ASSERT_EQUAL( 32256,
+                       decodedSamples[ 0xAA ] );
+
+    result = G711Codec_ALawEncode( &( decodedSamples[ 0 ] ),
+                                   256,
+                                   &( encodedSamples[ 0 ] ) );
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( codes[ 0 ] ),
+                                   &( encodedSamples[ 0 ] ),
+                                   256 );
+
+    /* Direct conversion follows the G.711 conversion tables, which differ
+     * from decoding and encoding for some codes. */
+    result = G711Codec_ALawToMuLaw( &( aLawCodes[ 0 ] ),
+                                    sizeof( aLawCodes ),
+                                    &( transcodedSamples[ 0 ] ) );
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedALawToMuLaw[ 0 ] ),
+                                   &( transcodedSamples[ 0 ] ),
+                                   sizeof( expectedALawToMuLaw ) );
+
+    memcpy( &( transcodedSamples[ 0 ] ),
+            &( muLawCodes[ 0 ] ),
+            sizeof( muLawCodes ) );
+
+    /* In place conversion. */
+    result = G711Codec_MuLawToALaw( &( transcodedSamples[ 0 ] ),
+                                    sizeof( muLawCodes ),
+                                    &( transcodedSamples[ 0 ] ) );
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedMuLawToALaw[ 0 ] ),
+                                   &( transcodedSamples[ 0 ] ),
+                                   sizeof( expectedMuLawToALaw ) );
+
+    result = G711Codec_MuLawToALaw( NULL,
+                                    256,
+                                    &( transcodedSamples[ 0 ] ) );
+    TEST_ASSERT_EQUAL( G711_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
@@ -233,273 +233,1470 @@ void test_H264_Packetizer_AddFrame( void )
     }
 }
 
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264 packetization with a frame added in chunks of every
+ * possible size generates the same packets as adding the whole frame.
+ */
+void test_H264_Packetizer_AddFrameChunk( void )
+{
+    uint8_t pFrame[] = { 0x00, 0x00, 0x00, 0x01, 0x09, 0x10,
+                         0x00, 0x00, 0x00, 0x01, 0x67, 0x42, 0xc0, 0x1f, 0xda,
+                         0x01, 0x40, 0x16, 0xec, 0x05,
+                         0xa8, 0x08,
+                         0x00, 0x00, 0x01, 0x68, 0xce, 0x3c, 0x80,
+                         0x00, 0x00, 0x00, 0x01, 0x06, 0x05, 0xff, 0xff, 0xb7,
+                         0xdc, 0x45, 0xe9, 0xbd, 0xe6,
+                         0xd9, 0x48, 0x00,
+                         0x00, 0x00, 0x00, 0x01, 0x65, 0x88, 0x84, 0x12, 0xff,
+                         0xff, 0xfc, 0x3d, 0x14, 0x00,
+                         0x04, 0xba, 0xeb, 0xae, 0xba,
+                         0xeb, 0xae, 0xba, 0xeb, 0xae,
+                         0xba,
+                         0x00, 0x00, 0x00, 0x01, 0x65, 0x00, 0x6e, 0x22, 0x21,
+                         0x04, 0xbf, 0xff, 0xff, 0x0f,
+                         0x45, 0x00 };
+    size_t frameLength = sizeof( pFrame );
+    size_t chunkLength, curIndex, packetNumber, expectedPacketCount = 0;
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    H264Packet_t pkt;
+    Frame_t frame, chunk;
+    Nalu_t nalusArray[ MAX_NALUS_IN_A_FRAME ];
+    uint8_t carryBuffer[ 32 ];
+    uint8_t expectedPackets[ 32 ][ MAX_H264_PACKET_LENGTH ];
+    size_t expectedPacketLength[ 32 ];
+    uint8_t pktBuffer[ MAX_H264_PACKET_LENGTH ];
+
+    /* Generate the expected packets by adding the whole frame. */
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( pFrame[ 0 ] );
+    frame.frameDataLength = frameLength;
+    result = H264Packetizer_AddFrame( &( ctx ),
+                                      &( frame ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( expectedPackets[ expectedPacketCount ][ 0 ] );
+    pkt.packetDataLength = MAX_H264_PACKET_LENGTH;
+    result = H264Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+
+    while( result != H264_RESULT_NO_MORE_PACKETS )
+    {
+        expectedPacketLength[ expectedPacketCount ] = pkt.packetDataLength;
+        expectedPacketCount += 1;
+
+        pkt.pPacketData = &( expectedPackets[ expectedPacketCount ][ 0 ] );
+        pkt.packetDataLength = MAX_H264_PACKET_LENGTH;
+        result = H264Packetizer_GetPacket( &( ctx ),
+                                           &( pkt ) );
+    }
+
+    /* The same context is used for all the chunk lengths. */
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    result = H264Packetizer_SetCarryBuffer( &( ctx ),
+                                            &( carryBuffer[ 0 ] ),
+                                            sizeof( carryBuffer ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    for( chunkLength = 1; chunkLength <= frameLength; chunkLength++ )
+    {
+        packetNumber = 0;
+
+        for( curIndex = 0; curIndex < frameLength; curIndex += chunkLength )
+        {
+            chunk.pFrameData = &( pFrame[ curIndex ] );
+            chunk.frameDataLength = H264_MIN( chunkLength,
+                                              frameLength - curIndex );
+            result = H264Packetizer_AddFrameChunk( &( ctx ),
+                                                   &( chunk ),
+                                                   ( curIndex + chunkLength ) >= frameLength );
+            TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                               result );
+
+            /* Retrieve the packets of the NALUs completed so far. */
+            pkt.pPacketData = &( pktBuffer[ 0 ] );
+            pkt.packetDataLength = MAX_H264_PACKET_LENGTH;
+            result = H264Packetizer_GetPacket( &( ctx ),
+                                               &( pkt ) );
+
+            while( result != H264_RESULT_NO_MORE_PACKETS )
+            {
+                TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                                   result );
+                TEST_ASSERT_EQUAL( expectedPacketLength[ packetNumber ],
+                                   pkt.packetDataLength );
+                TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPackets[ packetNumber ][ 0 ] ),
+                                               pkt.pPacketData,
+                                               pkt.packetDataLength );
+                packetNumber += 1;
+
+                pkt.pPacketData = &( pktBuffer[ 0 ] );
+                pkt.packetDataLength = MAX_H264_PACKET_LENGTH;
+                result = H264Packetizer_GetPacket( &( ctx ),
+                                                   &( pkt ) );
+            }
+        }
+
+        TEST_ASSERT_EQUAL( expectedPacketCount,
+                           packetNumber );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264 packetization with chunks when a NALU straddling chunks
+ * does not fit in the carry buffer.
+ */
+void test_H264_Packetizer_AddFrameChunk_OutOfMemory( void )
+{
+    uint8_t chunk1Data[] = { 0x00, 0x00, 0x00, 0x01, 0x67, 0x42, 0xc0 };
+    uint8_t chunk2Data[] = { 0x1f, 0xda, 0x01, 0x40, 0x16, 0xec, 0x05 };
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    Frame_t chunk;
+    Nalu_t nalusArray[ MAX_NALUS_IN_A_FRAME ];
+    uint8_t carryBuffer[ 4 ];
+
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    chunk.pFrameData = &( chunk1Data[ 0 ] );
+    chunk.frameDataLength = sizeof( chunk1Data );
+    result = H264Packetizer_AddFrameChunk( &( ctx ),
+                                           &( chunk ),
+                                           0 );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    /* No carry buffer. */
+    chunk.pFrameData = &( chunk2Data[ 0 ] );
+    chunk.frameDataLength = sizeof( chunk2Data );
+    result = H264Packetizer_AddFrameChunk( &( ctx ),
+                                           &( chunk ),
+                                           1 );
+    TEST_ASSERT_EQUAL( H264_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    result = H264Packetizer_SetCarryBuffer( &( ctx ),
+                                            &( carryBuffer[ 0 ] ),
+                                            sizeof( carryBuffer ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    chunk.pFrameData = &( chunk1Data[ 0 ] );
+    chunk.frameDataLength = sizeof( chunk1Data );
+    result = H264Packetizer_AddFrameChunk( &( ctx ),
+                                           &( chunk ),
+                                           0 );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    /* Carry buffer too small for the NALU. */
+    chunk.pFrameData = &( chunk2Data[ 0 ] );
+    chunk.frameDataLength = sizeof( chunk2Data );
+    result = H264Packetizer_AddFrameChunk( &( ctx ),
+                                           &( chunk ),
+                                           1 );
+    TEST_ASSERT_EQUAL( H264_RESULT_OUT_OF_MEMORY,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264 packetization happy path with adding length prefixed
+ * (AVCC) Frame.
+ */
+void test_H264_Packetizer_AddLengthPrefixedFrame( void )
+{
+    uint8_t pFrame[] = { 0x00, 0x02, 0x09, 0x10,
+                         0x00, 0x0C, 0x67, 0x42, 0xc0, 0x1f, 0xda,
+                         0x01, 0x40, 0x16, 0xec, 0x05,
+                         0xa8, 0x08,
+                         0x00, 0x04, 0x68, 0xce, 0x3c, 0x80,
+                         0x00, 0x0C, 0x06, 0x05, 0xff, 0xff, 0xb7,
+                         0xdc, 0x45, 0xe9, 0xbd, 0xe6,
+                         0xd9, 0x48,
+                         0x00, 0x15, 0x65, 0x88, 0x84, 0x12, 0xff,
+                         0xff, 0xfc, 0x3d, 0x14, 0x00,
+                         0x04, 0xba, 0xeb, 0xae, 0xba,
+                         0xeb, 0xae, 0xba, 0xeb, 0xae,
+                         0xba,
+                         0x00, 0x0C, 0x65, 0x00, 0x6e, 0x22, 0x21,
+                         0x04, 0xbf, 0xff, 0xff, 0x0f,
+                         0x45, 0x00 };
+    size_t frameLength = sizeof( pFrame );
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    H264Packet_t pkt;
+    Frame_t frame;
+    Nalu_t nalusArray[ MAX_NALUS_IN_A_FRAME ];
+    uint8_t pktBuffer[ MAX_H264_PACKET_LENGTH ];
+    uint32_t packetNumber = 0;
+    uint32_t expectedPacketLength[] = { 2, 12, 4, 12, 12, 12, 12 };
+
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    frame.pFrameData = pFrame;
+    frame.frameDataLength = frameLength;
+    result = H264Packetizer_AddLengthPrefixedFrame( &( ctx ),
+                                                    &( frame ),
+                                                    2 );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = MAX_H264_PACKET_LENGTH;
+    result = H264Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+
+    while( result != H264_RESULT_NO_MORE_PACKETS )
+    {
+        TEST_ASSERT_EQUAL( expectedPacketLength[ packetNumber ],
+                           pkt.packetDataLength );
+        packetNumber += 1;
+
+        pkt.pPacketData = &( pktBuffer[ 0 ] );
+        pkt.packetDataLength = MAX_H264_PACKET_LENGTH;
+        result = H264Packetizer_GetPacket( &( ctx ),
+                                           &( pkt ) );
+    }
+
+    TEST_ASSERT_EQUAL( 7,
+                       packetNumber );
+
+    /* Truncated NALU. */
+    frame.frameDataLength = frameLength - 1;
+    result = H264Packetizer_AddLengthPrefixedFrame( &( ctx ),
+                                                    &( frame ),
+                                                    2 );
+    TEST_ASSERT_EQUAL( H264_RESULT_MALFORMED_PACKET,
+                       result );
+
+    /* Invalid NALU length size. */
+    result = H264Packetizer_AddLengthPrefixedFrame( &( ctx ),
+                                                    &( frame ),
+                                                    3 );
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that cached SPS/PPS are injected as a STAP-A before an IDR
+ * which is not preceded by parameter sets.
+ */
+void test_H264_Packetizer_ParameterSetInjection( void )
+{
+    uint8_t sps[] = { 0x67, 0x42, 0xc0, 0x1f, 0xda, 0x01, 0x40, 0x16, 0xec, 0x05, 0xa8, 0x08 };
+    uint8_t pps[] = { 0x68, 0xce, 0x3c, 0x80 };
+    uint8_t sei[] = { 0x06, 0x05, 0x01, 0x00, 0x80 };
+    uint8_t idr[] = { 0x65, 0x88, 0x84, 0x12, 0xff };
+    uint8_t expectedStapA[] = { 0x78,
+                                0x00, 0x0C, 0x67, 0x42, 0xc0, 0x1f, 0xda, 0x01, 0x40, 0x16, 0xec, 0x05, 0xa8, 0x08,
+                                0x00, 0x04, 0x68, 0xce, 0x3c, 0x80 };
+    uint8_t cacheBuffer[ 64 ];
+    uint8_t pktBuffer[ 64 ];
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    H264Packet_t pkt;
+    Nalu_t nalu, cachedSps, cachedPps;
+    Nalu_t nalusArray[ MAX_NALUS_IN_A_FRAME ];
+
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    result = H264Packetizer_SetParameterSetCache( &( ctx ),
+                                                  &( cacheBuffer[ 0 ] ),
+                                                  sizeof( cacheBuffer ),
+                                                  1 );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    /* First IDR is preceded by SPS, PPS and SEI - nothing to inject. */
+    nalu.pNaluData = &( sps[ 0 ] );
+    nalu.naluDataLength = sizeof( sps );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+    nalu.pNaluData = &( pps[ 0 ] );
+    nalu.naluDataLength = sizeof( pps );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+    nalu.pNaluData = &( sei[ 0 ] );
+    nalu.naluDataLength = sizeof( sei );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+    nalu.pNaluData = &( idr[ 0 ] );
+    nalu.naluDataLength = sizeof( idr );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+    TEST_ASSERT_EQUAL( 4,
+                       ctx.naluCount );
+
+    result = H264Packetizer_GetParameterSets( &( ctx ),
+                                              &( cachedSps ),
+                                              &( cachedPps ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( sps ),
+                       cachedSps.naluDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( sps[ 0 ] ),
+                                   cachedSps.pNaluData,
+                                   sizeof( sps ) );
+    TEST_ASSERT_EQUAL( sizeof( pps ),
+                       cachedPps.naluDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( pps[ 0 ] ),
+                                   cachedPps.pNaluData,
+                                   sizeof( pps ) );
+
+    do
+    {
+        pkt.pPacketData = &( pktBuffer[ 0 ] );
+        pkt.packetDataLength = sizeof( pktBuffer );
+        result = H264Packetizer_GetPacket( &( ctx ),
+                                           &( pkt ) );
+    } while( result == H264_RESULT_OK );
+
+    /* Second IDR is not preceded by parameter sets - STAP-A is injected. */
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+    TEST_ASSERT_EQUAL( 2,
+                       ctx.naluCount );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = sizeof( pktBuffer );
+    result = H264Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedStapA ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedStapA[ 0 ] ),
+                                   pkt.pPacketData,
+                                   sizeof( expectedStapA ) );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = sizeof( pktBuffer );
+    result = H264Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( idr[ 0 ] ),
+                                   pkt.pPacketData,
+                                   sizeof( idr ) );
+
+    /* SPS and PPS are sent separately if the STAP-A does not fit. */
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = MAX_H264_PACKET_LENGTH;
+    result = H264Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( sps ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( sps[ 0 ] ),
+                                   pkt.pPacketData,
+                                   sizeof( sps ) );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = MAX_H264_PACKET_LENGTH;
+    result = H264Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( pps ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( pps[ 0 ] ),
+                                   pkt.pPacketData,
+                                   sizeof( pps ) );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = MAX_H264_PACKET_LENGTH;
+    result = H264Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( idr ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL( 0,
+                       ctx.parameterSetCache.pendingStapACount );
+    TEST_ASSERT_EQUAL( 0,
+                       ctx.naluCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that SPS/PPS repeated mid-GOP do not suppress the injection
+ * before the next IDR and that the cache is not updated while a STAP-A is
+ * pending.
+ */
+void test_H264_Packetizer_ParameterSetInjection_MidGop( void )
+{
+    uint8_t sps[] = { 0x67, 0x42, 0xc0, 0x1f, 0xda, 0x01, 0x40, 0x16, 0xec, 0x05, 0xa8, 0x08 };
+    uint8_t newSps[] = { 0x67, 0x42, 0xc0, 0x28, 0xda };
+    uint8_t pps[] = { 0x68, 0xce, 0x3c, 0x80 };
+    uint8_t slice[] = { 0x41, 0x9a, 0x02, 0x04 };
+    uint8_t idr[] = { 0x65, 0x88, 0x84, 0x12, 0xff };
+    uint8_t expectedStapA[] = { 0x78,
+                                0x00, 0x0C, 0x67, 0x42, 0xc0, 0x1f, 0xda, 0x01, 0x40, 0x16, 0xec, 0x05, 0xa8, 0x08,
+                                0x00, 0x04, 0x68, 0xce, 0x3c, 0x80 };
+    uint8_t cacheBuffer[ 64 ];
+    uint8_t pktBuffer[ 64 ];
+    H264PacketizerContext_t ctx = { 0 };
+    H264Result_t result;
+    H264Packet_t pkt;
+    Nalu_t nalu, cachedSps, cachedPps;
+    Nalu_t nalusArray[ MAX_NALUS_IN_A_FRAME ];
+    size_t i;
+
+    result = H264Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    result = H264Packetizer_SetParameterSetCache( &( ctx ),
+                                                  &( cacheBuffer[ 0 ] ),
+                                                  sizeof( cacheBuffer ),
+                                                  1 );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    /* SPS and PPS repeated before a non-IDR slice. */
+    nalu.pNaluData = &( sps[ 0 ] );
+    nalu.naluDataLength = sizeof( sps );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+    nalu.pNaluData = &( pps[ 0 ] );
+    nalu.naluDataLength = sizeof( pps );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+    nalu.pNaluData = &( slice[ 0 ] );
+    nalu.naluDataLength = sizeof( slice );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+
+    /* The IDR is not immediately preceded by SPS and PPS - STAP-A is injected. */
+    nalu.pNaluData = &( idr[ 0 ] );
+    nalu.naluDataLength = sizeof( idr );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+    TEST_ASSERT_EQUAL( 5,
+                       ctx.naluCount );
+    TEST_ASSERT_EQUAL( 1,
+                       ctx.parameterSetCache.pendingStapACount );
+
+    /* A new SPS is staged while the injected STAP-A is pending. */
+    nalu.pNaluData = &( newSps[ 0 ] );
+    nalu.naluDataLength = sizeof( newSps );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+
+    result = H264Packetizer_GetParameterSets( &( ctx ),
+                                              &( cachedSps ),
+                                              &( cachedPps ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( sps ),
+                       cachedSps.naluDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( sps[ 0 ] ),
+                                   cachedSps.pNaluData,
+                                   sizeof( sps ) );
+
+    /* SPS, PPS and slice. */
+    for( i = 0; i < 3; i++ )
+    {
+        pkt.pPacketData = &( pktBuffer[ 0 ] );
+        pkt.packetDataLength = sizeof( pktBuffer );
+        result = H264Packetizer_GetPacket( &( ctx ),
+                                           &( pkt ) );
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+    }
+
+    /* The STAP-A carries the parameter sets cached when it was injected. */
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = sizeof( pktBuffer );
+    result = H264Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedStapA ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedStapA[ 0 ] ),
+                                   pkt.pPacketData,
+                                   sizeof( expectedStapA ) );
+    TEST_ASSERT_EQUAL( 0,
+                       ctx.parameterSetCache.pendingStapACount );
+
+    /* The staged SPS is cached once the STAP-A is sent. */
+    result = H264Packetizer_GetParameterSets( &( ctx ),
+                                              &( cachedSps ),
+                                              &( cachedPps ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( newSps ),
+                       cachedSps.naluDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( newSps[ 0 ] ),
+                                   cachedSps.pNaluData,
+                                   sizeof( newSps ) );
+    TEST_ASSERT_EQUAL( sizeof( pps ),
+                       cachedPps.naluDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( pps[ 0 ] ),
+                                   cachedPps.pNaluData,
+                                   sizeof( pps ) );
+}
+
 /* ==============================  Test Cases for Depacketization ============================== */
 
 /**
- * @brief Validate H264 depacketization happy path to get Nalus.
+ * @brief Validate H264 depacketization happy path to get Nalus.
+ */
+void test_H264_Depacketizer_GetNalu( void )
+{
+    H264Result_t result;
+    H264Packet_t pkt;
+    H264DepacketizerContext_t ctx = { 0 };
+    Nalu_t nalu;
+    uint8_t naluBuffer[ MAX_NALU_LENGTH ];
+    H264Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    uint8_t packetData1[] = { 0x09, 0x10 };
+    uint8_t packetData2[] = { 0x67, 0x42, 0xc0, 0x1f, 0xda, 0x01, 0x40, 0x16, 0xec, 0x05, 0xa8, 0x08 };
+    uint8_t packetData3[] = { 0x68, 0xce, 0x3c, 0x80 };
+    uint8_t packetData4[] = { 0x06, 0x05, 0xff, 0xff, 0xb7, 0xdc, 0x45, 0xe9, 0xbd, 0xe6, 0xd9, 0x48 };
+    uint8_t packetData5[] = { 0x7c, 0x85, 0x88, 0x84, 0x12, 0xff, 0xff, 0xfc, 0x3d, 0x14, 0x0, 0x4 };
+    uint8_t packetData6[] = { 0x7c, 0x45, 0xba, 0xeb, 0xae, 0xba, 0xeb, 0xae, 0xba, 0xeb, 0xae, 0xba };
+    uint8_t packetData7[] = { 0x65, 0x00, 0x6e, 0x22, 0x21, 0x04, 0xbf, 0xff, 0xff, 0x0f, 0x45, 0x00 };
+
+    result = H264Depacketizer_Init( &( ctx ),
+                                    &( packetsArray[ 0 ] ),
+                                    MAX_PACKETS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData1[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData1 );
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData2[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData2 );
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData3[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData3 );
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData4[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData4 );
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData5[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData5 );
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData6[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData6 );
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData7[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData7 );
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    nalu.pNaluData = &( naluBuffer[ 0 ] );
+    nalu.naluDataLength = MAX_NALU_LENGTH;
+    result = H264Depacketizer_GetNalu( &( ctx ),
+                                       &( nalu ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    while( result != H264_RESULT_NO_MORE_NALUS )
+    {
+        nalu.pNaluData = &( naluBuffer[ 0 ] );
+        nalu.naluDataLength = MAX_NALU_LENGTH;
+        result = H264Depacketizer_GetNalu( &( ctx ),
+                                           &( nalu ) );
+    }
+    TEST_ASSERT_EQUAL( H264_RESULT_NO_MORE_NALUS,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264 depacketization happy path to get Nalus for STAP-A packet.
+ */
+void test_H264_Depacketizer_StapAGetNalu( void )
+{
+    H264Result_t result;
+    H264Packet_t pkt;
+    H264DepacketizerContext_t ctx = { 0 };
+    Nalu_t nalu;
+    uint8_t naluBuffer[ MAX_NALU_LENGTH ];
+    H264Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    uint8_t packetData[] =
+    {
+        /* STAP-A header. F=0, NRI=0, Type=24. */
+        0x18,
+        /* NALU 1 length. */
+        0x00, 0x05,
+        /* NALU 1 payload. */
+        0xAB, 0xCD, 0xEF, 0x11, 0x22,
+        /* NALU 2 length. */
+        0x00, 0x0A,
+        /* NALU 2 payload. */
+        0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5
+    };
+    uint8_t nalu1Data[] = { 0xAB, 0xCD, 0xEF, 0x11, 0x22 };
+    uint8_t nalu2Data[] = { 0xA1, 0xA2, 0xA3, 0xA4, 0xA5,
+                            0xB1, 0xB2, 0xB3, 0xB4, 0xB5 };
+
+    result = H264Depacketizer_Init( &( ctx ),
+                                    &( packetsArray[ 0 ] ),
+                                    MAX_PACKETS_IN_A_FRAME );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData );
+
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    nalu.pNaluData = &( naluBuffer[ 0 ] );
+    nalu.naluDataLength = MAX_NALU_LENGTH;
+
+    result = H264Depacketizer_GetNalu( &( ctx ),
+                                       &( nalu ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( nalu1Data ),
+                       nalu.naluDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( nalu1Data[ 0 ] ),
+                                   nalu.pNaluData,
+                                   nalu.naluDataLength );
+
+    nalu.pNaluData = &( naluBuffer[ 0 ] );
+    nalu.naluDataLength = MAX_NALU_LENGTH;
+
+    result = H264Depacketizer_GetNalu( &( ctx ),
+                                       &( nalu ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( nalu2Data ),
+                       nalu.naluDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( nalu2Data[ 0 ] ),
+                                   nalu.pNaluData,
+                                   nalu.naluDataLength );
+
+    nalu.pNaluData = &( naluBuffer[ 0 ] );
+    nalu.naluDataLength = MAX_NALU_LENGTH;
+
+    result = H264Depacketizer_GetNalu( &( ctx ),
+                                       &( nalu ) );
+
+    TEST_ASSERT_EQUAL( H264_RESULT_NO_MORE_NALUS,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264 depacketization happy path to get frame.
+ */
+void test_H264_Depacketizer_GetFrame( void )
+{
+    H264Result_t result;
+    H264Packet_t pkt;
+    H264DepacketizerContext_t ctx = { 0 };
+    Frame_t frame;
+    H264Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    uint8_t packetData1[] = { 0x09, 0x10 };
+    uint8_t packetData2[] = { 0x67, 0x42, 0xc0, 0x1f, 0xda, 0x01, 0x40, 0x16, 0xec, 0x05, 0xa8, 0x08 };
+    uint8_t packetData3[] = { 0x68, 0xce, 0x3c, 0x80 };
+    uint8_t packetData4[] = { 0x06, 0x05, 0xff, 0xff, 0xb7, 0xdc, 0x45, 0xe9, 0xbd, 0xe6, 0xd9, 0x48 };
+    uint8_t packetData5[] = { 0x7c, 0x85, 0x88, 0x84, 0x12, 0xff, 0xff, 0xfc, 0x3d, 0x14, 0x0, 0x4 };
+    uint8_t packetData6[] = { 0x7c, 0x45, 0xba, 0xeb, 0xae, 0xba, 0xeb, 0xae, 0xba, 0xeb, 0xae, 0xba };
+    uint8_t packetData7[] = { 0x65, 0x00, 0x6e, 0x22, 0x21, 0x04, 0xbf, 0xff, 0xff, 0x0f, 0x45, 0x00 };
+
+    result = H264Depacketizer_Init( &( ctx ),
+                                    &( packetsArray[ 0 ] ),
+                                    MAX_PACKETS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData1[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData1 );
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData2[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData2 );
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData3[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData3 );
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData4[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData4 );
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData5[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData5 );
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData6[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData6 );
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData7[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData7 );
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = H264Depacketizer_GetFrame( &( ctx ),
+                                        &( frame ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264 depacketization happy path to get frame for STAP-A packet.
  */
-void test_H264_Depacketizer_GetNalu( void )
+void test_H264_Depacketizer_StapAGetFrame( void )
 {
     H264Result_t result;
     H264Packet_t pkt;
     H264DepacketizerContext_t ctx = { 0 };
-    Nalu_t nalu;
-    uint8_t naluBuffer[ MAX_NALU_LENGTH ];
+    Frame_t frame;
     H264Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
-    uint8_t packetData1[] = { 0x09, 0x10 };
-    uint8_t packetData2[] = { 0x67, 0x42, 0xc0, 0x1f, 0xda, 0x01, 0x40, 0x16, 0xec, 0x05, 0xa8, 0x08 };
-    uint8_t packetData3[] = { 0x68, 0xce, 0x3c, 0x80 };
-    uint8_t packetData4[] = { 0x06, 0x05, 0xff, 0xff, 0xb7, 0xdc, 0x45, 0xe9, 0xbd, 0xe6, 0xd9, 0x48 };
-    uint8_t packetData5[] = { 0x7c, 0x85, 0x88, 0x84, 0x12, 0xff, 0xff, 0xfc, 0x3d, 0x14, 0x0, 0x4 };
-    uint8_t packetData6[] = { 0x7c, 0x45, 0xba, 0xeb, 0xae, 0xba, 0xeb, 0xae, 0xba, 0xeb, 0xae, 0xba };
-    uint8_t packetData7[] = { 0x65, 0x00, 0x6e, 0x22, 0x21, 0x04, 0xbf, 0xff, 0xff, 0x0f, 0x45, 0x00 };
+    uint8_t packetData[] =
+    {
+        /* STAP-A header. F=0, NRI=0, Type=24. */
+        0x18,
+        /* NALU 1 length. */
+        0x00, 0x05,
+        /* NALU 1 payload. */
+        0xAB, 0xCD, 0xEF, 0x11, 0x22,
+        /* NALU 2 length. */
+        0x00, 0x0A,
+        /* NALU 2 payload. */
+        0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5
+    };
+    uint8_t frameData[] =
+    {
+        /* 4-byte start code. */
+        0x00, 0x00, 0x00, 0x01,
+        /* NALU 1. */
+        0xAB, 0xCD, 0xEF, 0x11, 0x22,
+        /* 4-byte start code. */
+        0x00, 0x00, 0x00, 0x01,
+        /* NALU 2. */
+        0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5
+    };
 
     result = H264Depacketizer_Init( &( ctx ),
                                     &( packetsArray[ 0 ] ),
                                     MAX_PACKETS_IN_A_FRAME );
+
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
 
-    pkt.pPacketData = &( packetData1[ 0 ] );
-    pkt.packetDataLength = sizeof( packetData1 );
+    pkt.pPacketData = &( packetData[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData );
+
     result = H264Depacketizer_AddPacket( &( ctx ),
                                          &( pkt ) );
+
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
 
-    pkt.pPacketData = &( packetData2[ 0 ] );
-    pkt.packetDataLength = sizeof( packetData2 );
-    result = H264Depacketizer_AddPacket( &( ctx ),
-                                         &( pkt ) );
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+
+    result = H264Depacketizer_GetFrame( &( ctx ),
+                                        &( frame ) );
+
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
+    TEST_ASSERT_EQUAL( sizeof( frameData ),
+                       frame.frameDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( frameData[ 0 ] ),
+                                   frame.pFrameData,
+                                   frame.frameDataLength );
+}
 
-    pkt.pPacketData = &( packetData3[ 0 ] );
-    pkt.packetDataLength = sizeof( packetData3 );
-    result = H264Depacketizer_AddPacket( &( ctx ),
-                                         &( pkt ) );
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H264 depacketization happy path to get properties.
+ */
+void test_H264_Depacketizer_GetProperties( void )
+{
+    uint8_t singleNaluPacket[] = { 0x09, 0x10 };
+    uint8_t fuAStartPacket[] = { 0x7C, 0x89, 0xAB, 0xCD };
+    uint8_t fuAEndPacket[] = { 0x7C, 0x49, 0xAB, 0xCD };
+    uint8_t stapAPacket[] = { 0x18, /* F=0, NRI=0, Type=24. */
+                              0x00, 0x01, 0xAB, /* NALU 1. */
+                              0x00, 0x01, 0xCD  /* NALU 2. */
+                            };
+    uint32_t packetProperties;
+    H264Result_t result;
+    H264Packet_t pkt;
+
+    pkt.pPacketData = &( singleNaluPacket[ 0 ] );
+    pkt.packetDataLength = sizeof( singleNaluPacket );
+    result = H264Depacketizer_GetPacketProperties( pkt.pPacketData,
+                                                   pkt.packetDataLength,
+                                                   &( packetProperties ) );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
+    TEST_ASSERT_EQUAL( H264_PACKET_PROPERTY_START_PACKET,
+                       packetProperties );
 
-    pkt.pPacketData = &( packetData4[ 0 ] );
-    pkt.packetDataLength = sizeof( packetData4 );
-    result = H264Depacketizer_AddPacket( &( ctx ),
-                                         &( pkt ) );
+    pkt.pPacketData = &( fuAStartPacket[ 0 ] );
+    pkt.packetDataLength = sizeof( fuAStartPacket );
+    result = H264Depacketizer_GetPacketProperties( pkt.pPacketData,
+                                                   pkt.packetDataLength,
+                                                   &( packetProperties ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( H264_PACKET_PROPERTY_START_PACKET,
+                       packetProperties );
+
+    pkt.pPacketData = &( fuAEndPacket[ 0 ] );
+    pkt.packetDataLength = sizeof( fuAEndPacket );
+    result = H264Depacketizer_GetPacketProperties( pkt.pPacketData,
+                                                   pkt.packetDataLength,
+                                                   &( packetProperties ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( H264_PACKET_PROPERTY_END_PACKET,
+                       packetProperties );
+
+    pkt.pPacketData = &( stapAPacket[ 0 ] );
+    pkt.packetDataLength = sizeof( stapAPacket );
+    result = H264Depacketizer_GetPacketProperties( pkt.pPacketData,
+                                                   pkt.packetDataLength,
+                                                   &( packetProperties ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( H264_PACKET_PROPERTY_START_PACKET,
+                       packetProperties );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate keyframe, SPS, PPS and IDR packet properties.
+ */
+void test_H264_Depacketizer_GetKeyframeProperties( void )
+{
+    uint8_t spsPacket[] = { 0x67, 0x42, 0xc0, 0x1f };
+    uint8_t fuAIdrStartPacket[] = { 0x7C, 0x85, 0xAB, 0xCD };
+    uint8_t fuAIdrMiddlePacket[] = { 0x7C, 0x05, 0xAB, 0xCD };
+    uint8_t stapAPacket[] = { 0x78,                   /* F=0, NRI=3, Type=24. */
+                              0x00, 0x02, 0x67, 0x42, /* SPS. */
+                              0x00, 0x02, 0x68, 0xce  /* PPS. */
+                            };
+    uint8_t malformedStapAPacket[] = { 0x78,
+                                       0x00, 0x02, 0x67, 0x42,
+                                       0x00, 0x05, 0x68, 0xce };
+    uint32_t packetProperties;
+    H264Result_t result;
+
+    result = H264Depacketizer_GetPacketProperties( &( spsPacket[ 0 ] ),
+                                                   sizeof( spsPacket ),
+                                                   &( packetProperties ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( H264_PACKET_PROPERTY_START_PACKET |
+                       H264_PACKET_PROPERTY_SPS |
+                       H264_PACKET_PROPERTY_KEYFRAME,
+                       packetProperties );
+
+    result = H264Depacketizer_GetPacketProperties( &( fuAIdrStartPacket[ 0 ] ),
+                                                   sizeof( fuAIdrStartPacket ),
+                                                   &( packetProperties ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( H264_PACKET_PROPERTY_START_PACKET |
+                       H264_PACKET_PROPERTY_IDR |
+                       H264_PACKET_PROPERTY_KEYFRAME,
+                       packetProperties );
+
+    result = H264Depacketizer_GetPacketProperties( &( fuAIdrMiddlePacket[ 0 ] ),
+                                                   sizeof( fuAIdrMiddlePacket ),
+                                                   &( packetProperties ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( H264_PACKET_PROPERTY_IDR,
+                       packetProperties );
+
+    result = H264Depacketizer_GetPacketProperties( &( stapAPacket[ 0 ] ),
+                                                   sizeof( stapAPacket ),
+                                                   &( packetProperties ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( H264_PACKET_PROPERTY_START_PACKET |
+                       H264_PACKET_PROPERTY_SPS |
+                       H264_PACKET_PROPERTY_PPS |
+                       H264_PACKET_PROPERTY_KEYFRAME,
+                       packetProperties );
+
+    result = H264Depacketizer_GetPacketProperties( &( malformedStapAPacket[ 0 ] ),
+                                                   sizeof( malformedStapAPacket ),
+                                                   &( packetProperties ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_MALFORMED_PACKET,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that lost FU-A fragments are detected using RTP sequence
+ * numbers.
+ */
+void test_H264_Depacketizer_FuALossDetection( void )
+{
+    H264Result_t result;
+    H264Packet_t pkt;
+    H264DepacketizerContext_t ctx = { 0 };
+    Nalu_t nalu;
+    uint8_t naluBuffer[ MAX_NALU_LENGTH ];
+    H264Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    uint16_t seqNumArray[ MAX_PACKETS_IN_A_FRAME ];
+    uint8_t fuAStart[] = { 0x7C, 0x85, 0x88, 0x84 };
+    uint8_t fuAMiddle[] = { 0x7C, 0x05, 0x12, 0xff };
+    uint8_t fuAEnd[] = { 0x7C, 0x45, 0xba, 0xeb };
+    uint8_t singleNalu[] = { 0x09, 0x10 };
+    uint8_t expectedNalu[] = { 0x65, 0x88, 0x84, 0x12, 0xff, 0xba, 0xeb };
+    uint8_t * packets[] = { fuAStart, fuAMiddle, fuAEnd,   /* Complete. */
+                            fuAStart, fuAMiddle, fuAEnd,   /* Middle lost. */
+                            singleNalu,
+                            fuAStart };                    /* End lost. */
+    size_t packetLengths[] = { sizeof( fuAStart ), sizeof( fuAMiddle ), sizeof( fuAEnd ),
+                               sizeof( fuAStart ), sizeof( fuAMiddle ), sizeof( fuAEnd ),
+                               sizeof( singleNalu ),
+                               sizeof( fuAStart ) };
+    uint16_t seqNums[] = { 65534, 65535, 0, 1, 3, 4, 5, 6 };
+    size_t i;
+
+    result = H264Depacketizer_Init( &( ctx ),
+                                    &( packetsArray[ 0 ] ),
+                                    MAX_PACKETS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    result = H264Depacketizer_SetSeqNumArray( &( ctx ),
+                                              &( seqNumArray[ 0 ] ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+
+    for( i = 0; i < ( sizeof( seqNums ) / sizeof( seqNums[ 0 ] ) ); i++ )
+    {
+        pkt.pPacketData = packets[ i ];
+        pkt.packetDataLength = packetLengths[ i ];
+        result = H264Depacketizer_AddPacketWithSeqNum( &( ctx ),
+                                                       &( pkt ),
+                                                       seqNums[ i ] );
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+    }
+
+    /* Complete NALU across the sequence number wrap around. */
+    nalu.pNaluData = &( naluBuffer[ 0 ] );
+    nalu.naluDataLength = MAX_NALU_LENGTH;
+    result = H264Depacketizer_GetNalu( &( ctx ),
+                                       &( nalu ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedNalu ),
+                       nalu.naluDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedNalu[ 0 ] ),
+                                   nalu.pNaluData,
+                                   sizeof( expectedNalu ) );
+
+    /* Gap after the start fragment. */
+    nalu.pNaluData = &( naluBuffer[ 0 ] );
+    nalu.naluDataLength = MAX_NALU_LENGTH;
+    result = H264Depacketizer_GetNalu( &( ctx ),
+                                       &( nalu ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_INCOMPLETE_NALU,
+                       result );
+
+    /* Remaining fragments without the start fragment. */
+    nalu.pNaluData = &( naluBuffer[ 0 ] );
+    nalu.naluDataLength = MAX_NALU_LENGTH;
+    result = H264Depacketizer_GetNalu( &( ctx ),
+                                       &( nalu ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_INCOMPLETE_NALU,
+                       result );
+
+    nalu.pNaluData = &( naluBuffer[ 0 ] );
+    nalu.naluDataLength = MAX_NALU_LENGTH;
+    result = H264Depacketizer_GetNalu( &( ctx ),
+                                       &( nalu ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( singleNalu ),
+                       nalu.naluDataLength );
+
+    /* Missing end fragment. */
+    nalu.pNaluData = &( naluBuffer[ 0 ] );
+    nalu.naluDataLength = MAX_NALU_LENGTH;
+    result = H264Depacketizer_GetNalu( &( ctx ),
+                                       &( nalu ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_INCOMPLETE_NALU,
+                       result );
+
+    result = H264Depacketizer_GetNalu( &( ctx ),
+                                       &( nalu ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_NO_MORE_NALUS,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the rest of a frame with a lost FU-A fragment is
+ * discarded and not returned as the next frame.
+ */
+void test_H264_Depacketizer_FuALossGetFrame( void )
+{
+    H264Result_t result;
+    H264Packet_t pkt;
+    H264DepacketizerContext_t ctx = { 0 };
+    Frame_t frame;
+    uint8_t frameBuffer[ MAX_FRAME_LENGTH ];
+    H264Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    uint16_t seqNumArray[ MAX_PACKETS_IN_A_FRAME ];
+    uint8_t fuAStart[] = { 0x7C, 0x85, 0x88, 0x84 };
+    uint8_t fuAEnd[] = { 0x7C, 0x45, 0xba, 0xeb };
+    uint8_t singleNalu[] = { 0x09, 0x10 };
+    uint8_t nextFrameNalu[] = { 0x41, 0x9a, 0x02 };
+    uint8_t expectedFrame[] = { 0x00, 0x00, 0x00, 0x01, 0x41, 0x9a, 0x02 };
+
+    result = H264Depacketizer_Init( &( ctx ),
+                                    &( packetsArray[ 0 ] ),
+                                    MAX_PACKETS_IN_A_FRAME );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
 
-    pkt.pPacketData = &( packetData5[ 0 ] );
-    pkt.packetDataLength = sizeof( packetData5 );
-    result = H264Depacketizer_AddPacket( &( ctx ),
-                                         &( pkt ) );
+    result = H264Depacketizer_SetSeqNumArray( &( ctx ),
+                                              &( seqNumArray[ 0 ] ) );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
 
-    pkt.pPacketData = &( packetData6[ 0 ] );
-    pkt.packetDataLength = sizeof( packetData6 );
-    result = H264Depacketizer_AddPacket( &( ctx ),
-                                         &( pkt ) );
+    /* First frame - the middle fragment with sequence number 11 is lost. */
+    pkt.pPacketData = &( fuAStart[ 0 ] );
+    pkt.packetDataLength = sizeof( fuAStart );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
-                       result );
+                       H264Depacketizer_AddPacketWithSeqNum( &( ctx ), &( pkt ), 10 ) );
+    pkt.pPacketData = &( fuAEnd[ 0 ] );
+    pkt.packetDataLength = sizeof( fuAEnd );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Depacketizer_AddPacketWithSeqNum( &( ctx ), &( pkt ), 12 ) );
+    pkt.pPacketData = &( singleNalu[ 0 ] );
+    pkt.packetDataLength = sizeof( singleNalu );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Depacketizer_AddPacketWithSeqNum( &( ctx ), &( pkt ), 13 ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Depacketizer_EndFrame( &( ctx ) ) );
 
-    pkt.pPacketData = &( packetData7[ 0 ] );
-    pkt.packetDataLength = sizeof( packetData7 );
-    result = H264Depacketizer_AddPacket( &( ctx ),
-                                         &( pkt ) );
+    /* Second frame. */
+    pkt.pPacketData = &( nextFrameNalu[ 0 ] );
+    pkt.packetDataLength = sizeof( nextFrameNalu );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Depacketizer_AddPacketWithSeqNum( &( ctx ), &( pkt ), 14 ) );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Depacketizer_EndFrame( &( ctx ) ) );
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = H264Depacketizer_GetFrame( &( ctx ),
+                                        &( frame ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_INCOMPLETE_NALU,
                        result );
 
-    nalu.pNaluData = &( naluBuffer[ 0 ] );
-    nalu.naluDataLength = MAX_NALU_LENGTH;
-    result = H264Depacketizer_GetNalu( &( ctx ),
-                                       &( nalu ) );
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = H264Depacketizer_GetFrame( &( ctx ),
+                                        &( frame ) );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
+    TEST_ASSERT_EQUAL( sizeof( expectedFrame ),
+                       frame.frameDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedFrame[ 0 ] ),
+                                   frame.pFrameData,
+                                   sizeof( expectedFrame ) );
 
-    while( result != H264_RESULT_NO_MORE_NALUS )
-    {
-        nalu.pNaluData = &( naluBuffer[ 0 ] );
-        nalu.naluDataLength = MAX_NALU_LENGTH;
-        result = H264Depacketizer_GetNalu( &( ctx ),
-                                           &( nalu ) );
-    }
-    TEST_ASSERT_EQUAL( H264_RESULT_NO_MORE_NALUS,
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = H264Depacketizer_GetFrame( &( ctx ),
+                                        &( frame ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_NO_MORE_FRAMES,
                        result );
 }
 
 /*-----------------------------------------------------------*/
 
 /**
- * @brief Validate H264 depacketization happy path to get Nalus for STAP-A packet.
+ * @brief Validate H264 depacketization happy path to get NALU references of a
+ * frame.
  */
-void test_H264_Depacketizer_StapAGetNalu( void )
+void test_H264_Depacketizer_GetFrameNalus( void )
 {
     H264Result_t result;
     H264Packet_t pkt;
     H264DepacketizerContext_t ctx = { 0 };
-    Nalu_t nalu;
-    uint8_t naluBuffer[ MAX_NALU_LENGTH ];
     H264Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
-    uint8_t packetData[] =
-    {
-        /* STAP-A header. F=0, NRI=0, Type=24. */
-        0x18,
-        /* NALU 1 length. */
-        0x00, 0x05,
-        /* NALU 1 payload. */
-        0xAB, 0xCD, 0xEF, 0x11, 0x22,
-        /* NALU 2 length. */
-        0x00, 0x0A,
-        /* NALU 2 payload. */
-        0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5
-    };
-    uint8_t nalu1Data[] = { 0xAB, 0xCD, 0xEF, 0x11, 0x22 };
-    uint8_t nalu2Data[] = { 0xA1, 0xA2, 0xA3, 0xA4, 0xA5,
-                            0xB1, 0xB2, 0xB3, 0xB4, 0xB5 };
+    Nalu_t nalusArray[ 8 ];
+    size_t nalusCount;
+    uint8_t scratchBuffer[ MAX_NALU_LENGTH ];
+    uint8_t singleNaluPacket[] = { 0x09, 0x10 };
+    uint8_t stapAPacket[] = { 0x78,
+                              0x00, 0x02, 0x67, 0x42,
+                              0x00, 0x02, 0x68, 0xce };
+    uint8_t fuAStartPacket[] = { 0x7C, 0x85, 0x88, 0x84 };
+    uint8_t fuAEndPacket[] = { 0x7C, 0x45, 0xba, 0xeb };
+    uint8_t expectedFuANalu[] = { 0x65, 0x88, 0x84, 0xba, 0xeb };
 
     result = H264Depacketizer_Init( &( ctx ),
                                     &( packetsArray[ 0 ] ),
                                     MAX_PACKETS_IN_A_FRAME );
-
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
 
-    pkt.pPacketData = &( packetData[ 0 ] );
-    pkt.packetDataLength = sizeof( packetData );
-
-    result = H264Depacketizer_AddPacket( &( ctx ),
-                                         &( pkt ) );
-
+    pkt.pPacketData = &( singleNaluPacket[ 0 ] );
+    pkt.packetDataLength = sizeof( singleNaluPacket );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Depacketizer_AddPacket( &( ctx ), &( pkt ) ) );
+    pkt.pPacketData = &( stapAPacket[ 0 ] );
+    pkt.packetDataLength = sizeof( stapAPacket );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Depacketizer_AddPacket( &( ctx ), &( pkt ) ) );
+    pkt.pPacketData = &( fuAStartPacket[ 0 ] );
+    pkt.packetDataLength = sizeof( fuAStartPacket );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Depacketizer_AddPacket( &( ctx ), &( pkt ) ) );
+    pkt.pPacketData = &( fuAEndPacket[ 0 ] );
+    pkt.packetDataLength = sizeof( fuAEndPacket );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Depacketizer_AddPacket( &( ctx ), &( pkt ) ) );
+
+    nalusCount = 8;
+    result = H264Depacketizer_GetFrameNalus( &( ctx ),
+                                             &( nalusArray[ 0 ] ),
+                                             &( nalusCount ),
+                                             &( scratchBuffer[ 0 ] ),
+                                             sizeof( scratchBuffer ) );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
+    TEST_ASSERT_EQUAL( 4,
+                       nalusCount );
+
+    /* Single NALU and STAP-A NALUs refer to the packets. */
+    TEST_ASSERT_EQUAL_PTR( &( singleNaluPacket[ 0 ] ),
+                           nalusArray[ 0 ].pNaluData );
+    TEST_ASSERT_EQUAL( sizeof( singleNaluPacket ),
+                       nalusArray[ 0 ].naluDataLength );
+    TEST_ASSERT_EQUAL_PTR( &( stapAPacket[ 3 ] ),
+                           nalusArray[ 1 ].pNaluData );
+    TEST_ASSERT_EQUAL( 2,
+                       nalusArray[ 1 ].naluDataLength );
+    TEST_ASSERT_EQUAL_PTR( &( stapAPacket[ 7 ] ),
+                           nalusArray[ 2 ].pNaluData );
+    TEST_ASSERT_EQUAL( 2,
+                       nalusArray[ 2 ].naluDataLength );
+
+    /* FU-A NALU is joined in the scratch buffer. */
+    TEST_ASSERT_EQUAL_PTR( &( scratchBuffer[ 0 ] ),
+                           nalusArray[ 3 ].pNaluData );
+    TEST_ASSERT_EQUAL( sizeof( expectedFuANalu ),
+                       nalusArray[ 3 ].naluDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedFuANalu[ 0 ] ),
+                                   nalusArray[ 3 ].pNaluData,
+                                   sizeof( expectedFuANalu ) );
+
+    nalusCount = 8;
+    result = H264Depacketizer_GetFrameNalus( &( ctx ),
+                                             &( nalusArray[ 0 ] ),
+                                             &( nalusCount ),
+                                             &( scratchBuffer[ 0 ] ),
+                                             sizeof( scratchBuffer ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_NO_MORE_FRAMES,
+                       result );
+}
 
-    nalu.pNaluData = &( naluBuffer[ 0 ] );
-    nalu.naluDataLength = MAX_NALU_LENGTH;
-
-    result = H264Depacketizer_GetNalu( &( ctx ),
-                                       &( nalu ) );
+/*-----------------------------------------------------------*/
 
-    TEST_ASSERT_EQUAL( H264_RESULT_OK,
-                       result );
-    TEST_ASSERT_EQUAL( sizeof( nalu1Data ),
-                       nalu.naluDataLength );
-    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( nalu1Data[ 0 ] ),
-                                   nalu.pNaluData,
-                                   nalu.naluDataLength );
+/**
+ * @brief Validate that the computed frame length is exact.
+ */
+void test_H264_Depacketizer_GetFrameLength( void )
+{
+    H264Result_t result;
+    H264Packet_t pkt;
+    H264DepacketizerContext_t ctx = { 0 };
+    H264Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    Frame_t frame;
+    size_t frameLength, i, j;
+    uint8_t singleNaluPacket[] = { 0x09, 0x10 };
+    uint8_t stapAPacket[] = { 0x78,
+                              0x00, 0x02, 0x67, 0x42,
+                              0x00, 0x02, 0x68, 0xce };
+    uint8_t fuAStartPacket[] = { 0x7C, 0x85, 0x88, 0x84 };
+    uint8_t fuAMiddlePacket[] = { 0x7C, 0x05, 0x12 };
+    uint8_t fuAEndPacket[] = { 0x7C, 0x45, 0xba, 0xeb };
+    uint8_t * packets[] = { singleNaluPacket, stapAPacket, fuAStartPacket, fuAMiddlePacket, fuAEndPacket };
+    size_t packetLengths[] = { sizeof( singleNaluPacket ), sizeof( stapAPacket ), sizeof( fuAStartPacket ),
+                               sizeof( fuAMiddlePacket ), sizeof( fuAEndPacket ) };
+    /* 4 NALUs - 2 + 2 + 2 + 6 bytes. */
+    size_t naluLengthSizes[] = { 0, 2 };
+    size_t expectedFrameLengths[] = { ( 4 * 4 ) + 12, ( 4 * 2 ) + 12 };
+    uint8_t frameBuffer[ ( 4 * 4 ) + 12 ];
+
+    for( j = 0; j < 2; j++ )
+    {
+        result = H264Depacketizer_Init( &( ctx ),
+                                        &( packetsArray[ 0 ] ),
+                                        MAX_PACKETS_IN_A_FRAME );
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
 
-    nalu.pNaluData = &( naluBuffer[ 0 ] );
-    nalu.naluDataLength = MAX_NALU_LENGTH;
+        for( i = 0; i < ( sizeof( packetLengths ) / sizeof( packetLengths[ 0 ] ) ); i++ )
+        {
+            pkt.pPacketData = packets[ i ];
+            pkt.packetDataLength = packetLengths[ i ];
+            result = H264Depacketizer_AddPacket( &( ctx ),
+                                                 &( pkt ) );
+            TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                               result );
+        }
 
-    result = H264Depacketizer_GetNalu( &( ctx ),
-                                       &( nalu ) );
+        if( naluLengthSizes[ j ] == 0 )
+        {
+            result = H264Depacketizer_GetFrameLength( &( ctx ),
+                                                      &( frameLength ) );
+        }
+        else
+        {
+            result = H264Depacketizer_GetLengthPrefixedFrameLength( &( ctx ),
+                                                                    naluLengthSizes[ j ],
+                                                                    &( frameLength ) );
+        }
 
-    TEST_ASSERT_EQUAL( H264_RESULT_OK,
-                       result );
-    TEST_ASSERT_EQUAL( sizeof( nalu2Data ),
-                       nalu.naluDataLength );
-    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( nalu2Data[ 0 ] ),
-                                   nalu.pNaluData,
-                                   nalu.naluDataLength );
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( expectedFrameLengths[ j ],
+                           frameLength );
 
-    nalu.pNaluData = &( naluBuffer[ 0 ] );
-    nalu.naluDataLength = MAX_NALU_LENGTH;
+        /* A buffer of exactly the computed length is sufficient. */
+        frame.pFrameData = &( frameBuffer[ 0 ] );
+        frame.frameDataLength = frameLength;
 
-    result = H264Depacketizer_GetNalu( &( ctx ),
-                                       &( nalu ) );
+        if( naluLengthSizes[ j ] == 0 )
+        {
+            result = H264Depacketizer_GetFrame( &( ctx ),
+                                                &( frame ) );
+        }
+        else
+        {
+            result = H264Depacketizer_GetLengthPrefixedFrame( &( ctx ),
+                                                              &( frame ),
+                                                              naluLengthSizes[ j ] );
+        }
 
-    TEST_ASSERT_EQUAL( H264_RESULT_NO_MORE_NALUS,
-                       result );
+        TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( frameLength,
+                           frame.frameDataLength );
+    }
 }
 
 /*-----------------------------------------------------------*/
 
 /**
- * @brief Validate H264 depacketization happy path to get frame.
+ * @brief Validate that packets of multiple frames can be buffered in the
+ * depacketizer ring.
  */
-void test_H264_Depacketizer_GetFrame( void )
+void test_H264_Depacketizer_MultipleFrames( void )
 {
     H264Result_t result;
     H264Packet_t pkt;
     H264DepacketizerContext_t ctx = { 0 };
+    H264Packet_t packetsArray[ 4 ];
     Frame_t frame;
-    H264Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    uint8_t frameBuffer[ MAX_FRAME_LENGTH ];
     uint8_t packetData1[] = { 0x09, 0x10 };
-    uint8_t packetData2[] = { 0x67, 0x42, 0xc0, 0x1f, 0xda, 0x01, 0x40, 0x16, 0xec, 0x05, 0xa8, 0x08 };
-    uint8_t packetData3[] = { 0x68, 0xce, 0x3c, 0x80 };
-    uint8_t packetData4[] = { 0x06, 0x05, 0xff, 0xff, 0xb7, 0xdc, 0x45, 0xe9, 0xbd, 0xe6, 0xd9, 0x48 };
-    uint8_t packetData5[] = { 0x7c, 0x85, 0x88, 0x84, 0x12, 0xff, 0xff, 0xfc, 0x3d, 0x14, 0x0, 0x4 };
-    uint8_t packetData6[] = { 0x7c, 0x45, 0xba, 0xeb, 0xae, 0xba, 0xeb, 0xae, 0xba, 0xeb, 0xae, 0xba };
-    uint8_t packetData7[] = { 0x65, 0x00, 0x6e, 0x22, 0x21, 0x04, 0xbf, 0xff, 0xff, 0x0f, 0x45, 0x00 };
+    uint8_t packetData2[] = { 0x68, 0xce, 0x3c, 0x80 };
+    uint8_t packetData3[] = { 0x06, 0x05, 0xff };
+    uint8_t packetData4[] = { 0x41, 0x9a };
+    uint8_t expectedFrame1[] = { 0x00, 0x00, 0x00, 0x01, 0x09, 0x10,
+                                 0x00, 0x00, 0x00, 0x01, 0x68, 0xce, 0x3c, 0x80 };
+    uint8_t expectedFrame2[] = { 0x00, 0x00, 0x00, 0x01, 0x06, 0x05, 0xff,
+                                 0x00, 0x00, 0x00, 0x01, 0x41, 0x9a };
 
     result = H264Depacketizer_Init( &( ctx ),
                                     &( packetsArray[ 0 ] ),
-                                    MAX_PACKETS_IN_A_FRAME );
+                                    4 );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
 
+    /* Frame 1 followed by the first packet of frame 2. */
     pkt.pPacketData = &( packetData1[ 0 ] );
     pkt.packetDataLength = sizeof( packetData1 );
-    result = H264Depacketizer_AddPacket( &( ctx ),
-                                         &( pkt ) );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
-                       result );
-
+                       H264Depacketizer_AddPacket( &( ctx ), &( pkt ) ) );
     pkt.pPacketData = &( packetData2[ 0 ] );
     pkt.packetDataLength = sizeof( packetData2 );
-    result = H264Depacketizer_AddPacket( &( ctx ),
-                                         &( pkt ) );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
-                       result );
-
+                       H264Depacketizer_AddPacket( &( ctx ), &( pkt ) ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Depacketizer_EndFrame( &( ctx ) ) );
     pkt.pPacketData = &( packetData3[ 0 ] );
     pkt.packetDataLength = sizeof( packetData3 );
-    result = H264Depacketizer_AddPacket( &( ctx ),
-                                         &( pkt ) );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
-                       result );
+                       H264Depacketizer_AddPacket( &( ctx ), &( pkt ) ) );
 
+    /* The ring is full. */
     pkt.pPacketData = &( packetData4[ 0 ] );
     pkt.packetDataLength = sizeof( packetData4 );
-    result = H264Depacketizer_AddPacket( &( ctx ),
-                                         &( pkt ) );
-    TEST_ASSERT_EQUAL( H264_RESULT_OK,
-                       result );
+    TEST_ASSERT_EQUAL( H264_RESULT_OUT_OF_MEMORY,
+                       H264Depacketizer_AddPacket( &( ctx ), &( pkt ) ) );
 
-    pkt.pPacketData = &( packetData5[ 0 ] );
-    pkt.packetDataLength = sizeof( packetData5 );
-    result = H264Depacketizer_AddPacket( &( ctx ),
-                                         &( pkt ) );
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = H264Depacketizer_GetFrame( &( ctx ),
+                                        &( frame ) );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
+    TEST_ASSERT_EQUAL( sizeof( expectedFrame1 ),
+                       frame.frameDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedFrame1[ 0 ] ),
+                                   frame.pFrameData,
+                                   frame.frameDataLength );
 
-    pkt.pPacketData = &( packetData6[ 0 ] );
-    pkt.packetDataLength = sizeof( packetData6 );
-    result = H264Depacketizer_AddPacket( &( ctx ),
-                                         &( pkt ) );
+    /* Rest of frame 2 wraps around the ring. */
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
-                       result );
+                       H264Depacketizer_AddPacket( &( ctx ), &( pkt ) ) );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Depacketizer_EndFrame( &( ctx ) ) );
 
-    pkt.pPacketData = &( packetData7[ 0 ] );
-    pkt.packetDataLength = sizeof( packetData7 );
-    result = H264Depacketizer_AddPacket( &( ctx ),
-                                         &( pkt ) );
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = H264Depacketizer_GetFrame( &( ctx ),
+                                        &( frame ) );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
+    TEST_ASSERT_EQUAL( sizeof( expectedFrame2 ),
+                       frame.frameDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedFrame2[ 0 ] ),
+                                   frame.pFrameData,
+                                   frame.frameDataLength );
 
     frame.pFrameData = &( frameBuffer[ 0 ] );
     frame.frameDataLength = MAX_FRAME_LENGTH;
     result = H264Depacketizer_GetFrame( &( ctx ),
                                         &( frame ) );
-    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+    TEST_ASSERT_EQUAL( H264_RESULT_NO_MORE_FRAMES,
                        result );
 }
 
 /*-----------------------------------------------------------*/
 
 /**
- * @brief Validate H264 depacketization happy path to get frame for STAP-A packet.
+ * @brief Validate H264 depacketization happy path to get length prefixed
+ * (AVCC) frame for STAP-A packet.
  */
-void test_H264_Depacketizer_StapAGetFrame( void )
+void test_H264_Depacketizer_StapAGetLengthPrefixedFrame( void )
 {
     H264Result_t result;
     H264Packet_t pkt;
@@ -521,12 +1718,12 @@ void test_H264_Depacketizer_StapAGetFrame( void )
     };
     uint8_t frameData[] =
     {
-        /* 4-byte start code. */
-        0x00, 0x00, 0x00, 0x01,
+        /* 1 byte NALU length. */
+        0x05,
         /* NALU 1. */
         0xAB, 0xCD, 0xEF, 0x11, 0x22,
-        /* 4-byte start code. */
-        0x00, 0x00, 0x00, 0x01,
+        /* 1 byte NALU length. */
+        0x0A,
         /* NALU 2. */
         0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5
     };
@@ -550,8 +1747,9 @@ void test_H264_Depacketizer_StapAGetFrame( void )
     frame.pFrameData = &( frameBuffer[ 0 ] );
     frame.frameDataLength = MAX_FRAME_LENGTH;
 
-    result = H264Depacketizer_GetFrame( &( ctx ),
-                                        &( frame ) );
+    result = H264Depacketizer_GetLengthPrefixedFrame( &( ctx ),
+                                                      &( frame ),
+                                                      1 );
 
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
@@ -565,60 +1763,60 @@ void test_H264_Depacketizer_StapAGetFrame( void )
 /*-----------------------------------------------------------*/
 
 /**
- * @brief Validate H264 depacketization happy path to get properties.
+ * @brief Validate that a NALU too long for the length prefix is not consumed
+ * so that the frame can be read with a larger prefix.
  */
-void test_H264_Depacketizer_GetProperties( void )
+void test_H264_Depacketizer_GetLengthPrefixedFrame_NaluTooLong( void )
 {
-    uint8_t singleNaluPacket[] = { 0x09, 0x10 };
-    uint8_t fuAStartPacket[] = { 0x7C, 0x89, 0xAB, 0xCD };
-    uint8_t fuAEndPacket[] = { 0x7C, 0x49, 0xAB, 0xCD };
-    uint8_t stapAPacket[] = { 0x18, /* F=0, NRI=0, Type=24. */
-                              0x00, 0x01, 0xAB, /* NALU 1. */
-                              0x00, 0x01, 0xCD  /* NALU 2. */
-                            };
-    uint32_t packetProperties;
     H264Result_t result;
     H264Packet_t pkt;
+    H264DepacketizerContext_t ctx = { 0 };
+    Frame_t frame;
+    H264Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    uint8_t packetData[ 300 ] = { 0 };
 
-    pkt.pPacketData = &( singleNaluPacket[ 0 ] );
-    pkt.packetDataLength = sizeof( singleNaluPacket );
-    result = H264Depacketizer_GetPacketProperties( pkt.pPacketData,
-                                                   pkt.packetDataLength,
-                                                   &( packetProperties ) );
+    /* Single NALU packet. F=0, NRI=2, Type=1. */
+    packetData[ 0 ] = 0x41;
+
+    result = H264Depacketizer_Init( &( ctx ),
+                                    &( packetsArray[ 0 ] ),
+                                    MAX_PACKETS_IN_A_FRAME );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
-    TEST_ASSERT_EQUAL( H264_PACKET_PROPERTY_START_PACKET,
-                       packetProperties );
 
-    pkt.pPacketData = &( fuAStartPacket[ 0 ] );
-    pkt.packetDataLength = sizeof( fuAStartPacket );
-    result = H264Depacketizer_GetPacketProperties( pkt.pPacketData,
-                                                   pkt.packetDataLength,
-                                                   &( packetProperties ) );
+    pkt.pPacketData = &( packetData[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData );
+    result = H264Depacketizer_AddPacket( &( ctx ),
+                                         &( pkt ) );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
-    TEST_ASSERT_EQUAL( H264_PACKET_PROPERTY_START_PACKET,
-                       packetProperties );
 
-    pkt.pPacketData = &( fuAEndPacket[ 0 ] );
-    pkt.packetDataLength = sizeof( fuAEndPacket );
-    result = H264Depacketizer_GetPacketProperties( pkt.pPacketData,
-                                                   pkt.packetDataLength,
-                                                   &( packetProperties ) );
-    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = H264Depacketizer_GetLengthPrefixedFrame( &( ctx ),
+                                                      &( frame ),
+                                                      1 );
+    TEST_ASSERT_EQUAL( H264_RESULT_BAD_PARAM,
                        result );
-    TEST_ASSERT_EQUAL( H264_PACKET_PROPERTY_END_PACKET,
-                       packetProperties );
+    TEST_ASSERT_EQUAL( 1,
+                       ctx.packetCount );
 
-    pkt.pPacketData = &( stapAPacket[ 0 ] );
-    pkt.packetDataLength = sizeof( stapAPacket );
-    result = H264Depacketizer_GetPacketProperties( pkt.pPacketData,
-                                                   pkt.packetDataLength,
-                                                   &( packetProperties ) );
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = H264Depacketizer_GetLengthPrefixedFrame( &( ctx ),
+                                                      &( frame ),
+                                                      2 );
     TEST_ASSERT_EQUAL( H264_RESULT_OK,
                        result );
-    TEST_ASSERT_EQUAL( H264_PACKET_PROPERTY_START_PACKET,
-                       packetProperties );
+    TEST_ASSERT_EQUAL( 2 + sizeof( packetData ),
+                       frame.frameDataLength );
+    TEST_ASSERT_EQUAL( 0x01,
+                       frame.pFrameData[ 0 ] );
+    TEST_ASSERT_EQUAL( 0x2C,
+                       frame.pFrameData[ 1 ] );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( packetData[ 0 ] ),
+                                   &( frame.pFrameData[ 2 ] ),
+                                   sizeof( packetData ) );
 }
 
 /*-----------------------------------------------------------*/
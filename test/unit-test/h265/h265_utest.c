@@ -0,0 +1,412 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "h265_depacketizer.h"
+#include "h265_packetizer.h"
+
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define MAX_PACKETS_IN_A_FRAME  512
+#define MAX_NALU_LENGTH         5 * 1024
+#define MAX_FRAME_LENGTH        10 * 1024
+
+#define MAX_NALUS_IN_A_FRAME    512
+#define MAX_H265_PACKET_LENGTH  16
+
+uint8_t frameBuffer[ MAX_FRAME_LENGTH ];
+
+void setUp( void )
+{
+    memset( &( frameBuffer[ 0 ] ),
+            0,
+            sizeof( frameBuffer ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases for Packetization ============================== */
+
+/**
+ * @brief Validate H265 packetization happy path with AP, single NALU and FU
+ * packets.
+ */
+void test_H265_Packetizer_AddFrame( void )
+{
+    uint8_t pFrame[] = { 0x00, 0x00, 0x00, 0x01,
+                         0x40, 0x01, 0x0c, 0x01, /* VPS. */
+                         0x00, 0x00, 0x00, 0x01,
+                         0x42, 0x01, 0x01, 0x01, /* SPS. */
+                         0x00, 0x00, 0x01,
+                         0x44, 0x01, 0xc1, 0x72, 0xb4, 0x62, 0x40, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, /* PPS. */
+                         0x00, 0x00, 0x00, 0x01,
+                         0x26, 0x01, 0xaf, 0x09, 0x40, 0xf3, 0xb8, 0xd5, 0x39, 0xba, 0x1f, 0xe4,
+                         0xa6, 0x08, 0x5c, 0x6e, 0xb1, 0x8f, 0x00, 0x38, 0xf1, 0xa6, 0xfc, 0xf1 /* IDR. */ };
+    uint8_t expectedAp[] = { 0x60, 0x01,
+                             0x00, 0x04, 0x40, 0x01, 0x0c, 0x01,
+                             0x00, 0x04, 0x42, 0x01, 0x01, 0x01 };
+    uint8_t expectedFuStart[] = { 0x62, 0x01, 0x93, 0xaf, 0x09, 0x40, 0xf3, 0xb8, 0xd5, 0x39,
+                                  0xba, 0x1f, 0xe4, 0xa6, 0x08, 0x5c };
+    uint8_t expectedFuEnd[] = { 0x62, 0x01, 0x53, 0x6e, 0xb1, 0x8f, 0x00, 0x38, 0xf1, 0xa6, 0xfc, 0xf1 };
+    H265PacketizerContext_t ctx = { 0 };
+    H265Result_t result;
+    H265Packet_t pkt;
+    H265Frame_t frame;
+    H265Nalu_t nalusArray[ MAX_NALUS_IN_A_FRAME ];
+    uint8_t pktBuffer[ MAX_H265_PACKET_LENGTH ];
+
+    result = H265Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( pFrame[ 0 ] );
+    frame.frameDataLength = sizeof( pFrame );
+    result = H265Packetizer_AddFrame( &( ctx ),
+                                      &( frame ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       result );
+    /* 4 NALUs and the frame end. */
+    TEST_ASSERT_EQUAL( 5,
+                       ctx.naluCount );
+
+    /* VPS and SPS are aggregated. */
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = MAX_H265_PACKET_LENGTH;
+    result = H265Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedAp ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedAp[ 0 ] ),
+                                   pkt.pPacketData,
+                                   pkt.packetDataLength );
+
+    /* PPS fits alone. */
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = MAX_H265_PACKET_LENGTH;
+    result = H265Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 13,
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( pFrame[ 19 ] ),
+                                   pkt.pPacketData,
+                                   pkt.packetDataLength );
+
+    /* IDR is fragmented. */
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = MAX_H265_PACKET_LENGTH;
+    result = H265Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedFuStart ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedFuStart[ 0 ] ),
+                                   pkt.pPacketData,
+                                   pkt.packetDataLength );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = MAX_H265_PACKET_LENGTH;
+    result = H265Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedFuEnd ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedFuEnd[ 0 ] ),
+                                   pkt.pPacketData,
+                                   pkt.packetDataLength );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = MAX_H265_PACKET_LENGTH;
+    result = H265Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_NO_MORE_PACKETS,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that an Aggregation Packet does not span frames when the
+ * NALUs of multiple frames are queued.
+ */
+void test_H265_Packetizer_MultipleFrames( void )
+{
+    uint8_t naluData1[] = { 0x02, 0x01, 0xd0, 0x01 };
+    uint8_t naluData2[] = { 0x02, 0x01, 0xd0, 0x02 };
+    uint8_t naluData3[] = { 0x02, 0x01, 0xd0, 0x03 };
+    uint8_t expectedAp[] = { 0x60, 0x01,
+                             0x00, 0x04, 0x02, 0x01, 0xd0, 0x01,
+                             0x00, 0x04, 0x02, 0x01, 0xd0, 0x02 };
+    H265PacketizerContext_t ctx = { 0 };
+    H265Result_t result;
+    H265Packet_t pkt;
+    H265Nalu_t nalu;
+    H265Nalu_t nalusArray[ MAX_NALUS_IN_A_FRAME ];
+    uint8_t pktBuffer[ 64 ];
+
+    result = H265Packetizer_Init( &( ctx ),
+                                  &( nalusArray[ 0 ] ),
+                                  MAX_NALUS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       result );
+
+    /* Frame 1 with 2 NALUs, frame 2 with 1 NALU. */
+    nalu.pNaluData = &( naluData1[ 0 ] );
+    nalu.naluDataLength = sizeof( naluData1 );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+    nalu.pNaluData = &( naluData2[ 0 ] );
+    nalu.naluDataLength = sizeof( naluData2 );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Packetizer_EndFrame( &( ctx ) ) );
+    nalu.pNaluData = &( naluData3[ 0 ] );
+    nalu.naluDataLength = sizeof( naluData3 );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Packetizer_EndFrame( &( ctx ) ) );
+
+    /* Only the NALUs of frame 1 are aggregated. */
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = sizeof( pktBuffer );
+    result = H265Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedAp ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedAp[ 0 ] ),
+                                   pkt.pPacketData,
+                                   pkt.packetDataLength );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = sizeof( pktBuffer );
+    result = H265Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_NO_MORE_PACKETS,
+                       result );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = sizeof( pktBuffer );
+    result = H265Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( naluData3 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( naluData3[ 0 ] ),
+                                   pkt.pPacketData,
+                                   pkt.packetDataLength );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = sizeof( pktBuffer );
+    result = H265Packetizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_NO_MORE_PACKETS,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       ctx.naluCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H265 packetization with invalid parameters.
+ */
+void test_H265_Packetizer_BadParams( void )
+{
+    H265PacketizerContext_t ctx = { 0 };
+    H265Nalu_t nalusArray[ 1 ];
+    H265Nalu_t nalu;
+    uint8_t naluData[] = { 0x02, 0x01, 0xd0 };
+
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM,
+                       H265Packetizer_Init( NULL, &( nalusArray[ 0 ] ), 1 ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM,
+                       H265Packetizer_Init( &( ctx ), NULL, 1 ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Packetizer_Init( &( ctx ), &( nalusArray[ 0 ] ), 1 ) );
+
+    /* NALU shorter than the NALU header. */
+    nalu.pNaluData = &( naluData[ 0 ] );
+    nalu.naluDataLength = 1;
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM,
+                       H265Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+
+    nalu.naluDataLength = sizeof( naluData );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OUT_OF_MEMORY,
+                       H265Packetizer_AddNalu( &( ctx ), &( nalu ) ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OUT_OF_MEMORY,
+                       H265Packetizer_EndFrame( &( ctx ) ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM,
+                       H265Packetizer_EndFrame( NULL ) );
+}
+
+/* ==============================  Test Cases for Depacketization ============================== */
+
+/**
+ * @brief Validate H265 depacketization happy path to get NALUs and frames.
+ */
+void test_H265_Depacketizer_GetFrame( void )
+{
+    H265Result_t result;
+    H265Packet_t pkt;
+    H265DepacketizerContext_t ctx = { 0 };
+    H265Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+    H265Nalu_t nalu;
+    H265Frame_t frame;
+    uint8_t naluBuffer[ MAX_NALU_LENGTH ];
+    uint8_t apPacket[] = { 0x60, 0x01,
+                           0x00, 0x04, 0x40, 0x01, 0x0c, 0x01,
+                           0x00, 0x04, 0x42, 0x01, 0x01, 0x01 };
+    uint8_t fuStartPacket[] = { 0x62, 0x01, 0x93, 0xaf, 0x09 };
+    uint8_t fuEndPacket[] = { 0x62, 0x01, 0x53, 0x6e, 0xb1 };
+    uint8_t singleNaluPacket[] = { 0x02, 0x01, 0xd0 };
+    uint8_t expectedFrame[] = { 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0x0c, 0x01,
+                                0x00, 0x00, 0x00, 0x01, 0x42, 0x01, 0x01, 0x01,
+                                0x00, 0x00, 0x00, 0x01, 0x26, 0x01, 0xaf, 0x09, 0x6e, 0xb1 };
+
+    result = H265Depacketizer_Init( &( ctx ),
+                                    &( packetsArray[ 0 ] ),
+                                    MAX_PACKETS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( apPacket[ 0 ] );
+    pkt.packetDataLength = sizeof( apPacket );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Depacketizer_AddPacket( &( ctx ), &( pkt ) ) );
+    pkt.pPacketData = &( fuStartPacket[ 0 ] );
+    pkt.packetDataLength = sizeof( fuStartPacket );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Depacketizer_AddPacket( &( ctx ), &( pkt ) ) );
+    pkt.pPacketData = &( fuEndPacket[ 0 ] );
+    pkt.packetDataLength = sizeof( fuEndPacket );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Depacketizer_AddPacket( &( ctx ), &( pkt ) ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Depacketizer_EndFrame( &( ctx ) ) );
+
+    /* Next frame. */
+    pkt.pPacketData = &( singleNaluPacket[ 0 ] );
+    pkt.packetDataLength = sizeof( singleNaluPacket );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Depacketizer_AddPacket( &( ctx ), &( pkt ) ) );
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = H265Depacketizer_GetFrame( &( ctx ),
+                                        &( frame ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedFrame ),
+                       frame.frameDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedFrame[ 0 ] ),
+                                   frame.pFrameData,
+                                   frame.frameDataLength );
+
+    nalu.pNaluData = &( naluBuffer[ 0 ] );
+    nalu.naluDataLength = MAX_NALU_LENGTH;
+    result = H265Depacketizer_GetNalu( &( ctx ),
+                                       &( nalu ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( singleNaluPacket ),
+                       nalu.naluDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( singleNaluPacket[ 0 ] ),
+                                   nalu.pNaluData,
+                                   nalu.naluDataLength );
+
+    result = H265Depacketizer_GetNalu( &( ctx ),
+                                       &( nalu ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_NO_MORE_NALUS,
+                       result );
+
+    /* The frame length is left unchanged on bad parameters. */
+    frame.pFrameData = NULL;
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = H265Depacketizer_GetFrame( &( ctx ),
+                                        &( frame ) );
+    TEST_ASSERT_EQUAL( H265_RESULT_BAD_PARAM,
+                       result );
+    TEST_ASSERT_EQUAL( MAX_FRAME_LENGTH,
+                       frame.frameDataLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate H265 packet properties.
+ */
+void test_H265_Depacketizer_GetPacketProperties( void )
+{
+    uint8_t trailPacket[] = { 0x02, 0x01, 0xd0 };
+    uint8_t fuIdrStartPacket[] = { 0x62, 0x01, 0x93, 0xaf };
+    uint8_t fuIdrEndPacket[] = { 0x62, 0x01, 0x53, 0x6e };
+    uint8_t apPacket[] = { 0x60, 0x01,
+                           0x00, 0x04, 0x40, 0x01, 0x0c, 0x01,
+                           0x00, 0x04, 0x44, 0x01, 0xc1, 0x72 };
+    uint8_t malformedApPacket[] = { 0x60, 0x01,
+                                    0x00, 0x08, 0x40, 0x01, 0x0c, 0x01 };
+    uint32_t packetProperties;
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Depacketizer_GetPacketProperties( &( trailPacket[ 0 ] ),
+                                                             sizeof( trailPacket ),
+                                                             &( packetProperties ) ) );
+    TEST_ASSERT_EQUAL( H265_PACKET_PROPERTY_START_PACKET,
+                       packetProperties );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Depacketizer_GetPacketProperties( &( fuIdrStartPacket[ 0 ] ),
+                                                             sizeof( fuIdrStartPacket ),
+                                                             &( packetProperties ) ) );
+    TEST_ASSERT_EQUAL( H265_PACKET_PROPERTY_START_PACKET |
+                       H265_PACKET_PROPERTY_IRAP |
+                       H265_PACKET_PROPERTY_KEYFRAME,
+                       packetProperties );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Depacketizer_GetPacketProperties( &( fuIdrEndPacket[ 0 ] ),
+                                                             sizeof( fuIdrEndPacket ),
+                                                             &( packetProperties ) ) );
+    TEST_ASSERT_EQUAL( H265_PACKET_PROPERTY_END_PACKET |
+                       H265_PACKET_PROPERTY_IRAP,
+                       packetProperties );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_OK,
+                       H265Depacketizer_GetPacketProperties( &( apPacket[ 0 ] ),
+                                                             sizeof( apPacket ),
+                                                             &( packetProperties ) ) );
+    TEST_ASSERT_EQUAL( H265_PACKET_PROPERTY_START_PACKET |
+                       H265_PACKET_PROPERTY_VPS |
+                       H265_PACKET_PROPERTY_PPS |
+                       H265_PACKET_PROPERTY_KEYFRAME,
+                       packetProperties );
+
+    TEST_ASSERT_EQUAL( H265_RESULT_MALFORMED_PACKET,
+                       H265Depacketizer_GetPacketProperties( &( malformedApPacket[ 0 ] ),
+                                                             sizeof( malformedApPacket ),
+                                                             &( packetProperties ) ) );
+}
+
+/*-----------------------------------------------------------*/
@@ -9,13 +9,14 @@
 /* API includes. */
 #include "opus_packetizer.h"
 #include "opus_depacketizer.h"
+#include "opus_toc.h"
 
 /* ===========================  EXTERN VARIABLES  =========================== */
 
 #define MAX_FRAME_LENGTH        10 * 1024
 #define MAX_PACKET_IN_A_FRAME   512
 
-#define PACKET_BUFFER_LENGTH 10
+#define PACKET_BUFFER_LENGTH 32
 
 uint8_t packetBuffer[ PACKET_BUFFER_LENGTH ];
 uint8_t frameBuffer[ MAX_FRAME_LENGTH ];
@@ -52,7 +53,6 @@ void test_Opus_Packetizer( void )
     OpusPacketizerContext_t ctx = { 0 };
     OpusPacket_t pkt;
     OpusFrame_t frame;
-    size_t curFrameDataIndex = 0;
 
     frame.pFrameData = &( frameData[ 0 ] );
     frame.frameDataLength = sizeof( frameData );
@@ -62,30 +62,38 @@ void test_Opus_Packetizer( void )
 
     TEST_ASSERT_EQUAL( OPUS_RESULT_OK,
                        result );
+    TEST_ASSERT_EQUAL( 480,
+                       ctx.tocInfo.packetDurationSamples );
 
+    /* The Opus packet must not be split. */
     pkt.pPacketData = &( packetBuffer[ 0 ] );
     pkt.packetDataLength = 6;
     result = OpusPacketizer_GetPacket( &( ctx ),
                                        &( pkt ) );
 
-    while( result != OPUS_RESULT_NO_MORE_PACKETS )
-    {
-        TEST_ASSERT_EQUAL( OPUS_MIN( 6, frame.frameDataLength - curFrameDataIndex ),
-                           pkt.packetDataLength );
-
-        TEST_ASSERT_EQUAL_UINT8_ARRAY( &( frameData[ curFrameDataIndex ] ),
-                                       &( pkt.pPacketData[ 0 ] ),
-                                       pkt.packetDataLength );
-        curFrameDataIndex += pkt.packetDataLength;
-
-        pkt.pPacketData = &( packetBuffer[ 0 ] );
-        pkt.packetDataLength = 6;
-        result = OpusPacketizer_GetPacket( &( ctx ),
-                                           &( pkt ) );
-    }
+    TEST_ASSERT_EQUAL( OPUS_RESULT_OUT_OF_MEMORY,
+                       result );
 
+    pkt.pPacketData = &( packetBuffer[ 0 ] );
+    pkt.packetDataLength = PACKET_BUFFER_LENGTH;
+    result = OpusPacketizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+
+    TEST_ASSERT_EQUAL( OPUS_RESULT_OK,
+                       result );
     TEST_ASSERT_EQUAL( sizeof( frameData ),
-                       curFrameDataIndex );
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( frameData[ 0 ] ),
+                                   &( pkt.pPacketData[ 0 ] ),
+                                   pkt.packetDataLength );
+
+    pkt.pPacketData = &( packetBuffer[ 0 ] );
+    pkt.packetDataLength = PACKET_BUFFER_LENGTH;
+    result = OpusPacketizer_GetPacket( &( ctx ),
+                                       &( pkt ) );
+
+    TEST_ASSERT_EQUAL( OPUS_RESULT_NO_MORE_PACKETS,
+                       result );
 }
 
 /*-----------------------------------------------------------*/
@@ -188,13 +196,10 @@ void test_Opus_Depacketizer( void )
 
     uint8_t packetData1[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11, 0x12, 0x13 };
     uint8_t packetData2[] = { 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31 };
-    uint8_t packetData3[] = { 0x32, 0x33, 0x34, 0x35, 0x40, 0x41 };
-
-    uint8_t decodedFrame[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-                               0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
-                               0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
-                               0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
-                               0x40, 0x41 };
+    uint8_t packetData3[] = { 0x30, 0x33, 0x34, 0x35, 0x40, 0x41 };
+    uint8_t * pPacketsData[] = { &( packetData1[ 0 ] ), &( packetData2[ 0 ] ), &( packetData3[ 0 ] ) };
+    size_t packetsLength[] = { sizeof( packetData1 ), sizeof( packetData2 ), sizeof( packetData3 ) };
+    size_t i;
 
     result = OpusDepacketizer_Init( &( ctx ),
                                     &( packetsArray[ 0 ] ),
@@ -230,19 +235,32 @@ void test_Opus_Depacketizer( void )
     TEST_ASSERT_EQUAL( OPUS_RESULT_OK,
                        result );
 
+    /* Each packet carries one complete Opus frame. */
+    for( i = 0; i < 3; i++ )
+    {
+        frame.pFrameData = &( frameBuffer[ 0 ] );
+        frame.frameDataLength = MAX_FRAME_LENGTH;
+
+        result = OpusDepacketizer_GetFrame( &( ctx ),
+                                            &( frame ) );
+
+        TEST_ASSERT_EQUAL( OPUS_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( packetsLength[ i ],
+                           frame.frameDataLength );
+        TEST_ASSERT_EQUAL_UINT8_ARRAY( pPacketsData[ i ],
+                                       &( frame.pFrameData[ 0 ] ),
+                                       frame.frameDataLength );
+    }
+
     frame.pFrameData = &( frameBuffer[ 0 ] );
     frame.frameDataLength = MAX_FRAME_LENGTH;
 
     result = OpusDepacketizer_GetFrame( &( ctx ),
                                         &( frame ) );
 
-    TEST_ASSERT_EQUAL( OPUS_RESULT_OK,
+    TEST_ASSERT_EQUAL( OPUS_RESULT_NO_MORE_PACKETS,
                        result );
-    TEST_ASSERT_EQUAL( sizeof( decodedFrame ),
-                       frame.frameDataLength );
-    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( decodedFrame[ 0 ] ),
-                                   &( frame.pFrameData[ 0 ] ),
-                                   frame.frameDataLength );
 }
 
 /*-----------------------------------------------------------*/
@@ -269,6 +287,60 @@ void test_Opus_Depacketizer_GetPacketProperties( void )
                        result );
     TEST_ASSERT_EQUAL( OPUS_PACKET_PROPERTY_START_PACKET,
                        properties );
+    TEST_ASSERT_EQUAL( OPUS_BANDWIDTH_NARROWBAND,
+                       OPUS_PACKET_PROPERTY_GET_BANDWIDTH( properties ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate DTX, stereo and bandwidth in Opus_Depacketizer_GetPacketProperties.
+ */
+void test_Opus_Depacketizer_GetPacketProperties_DtxStereoBandwidth( void )
+{
+    OpusResult_t result;
+    uint32_t properties;
+    /* Config 15 (Hybrid FB), stereo, DTX. */
+    uint8_t dtxPacket[] = { 0x7C };
+    /* Config 9 (SILK WB), mono. */
+    uint8_t silkPacket[] = { 0x48, 0x01, 0x02 };
+    /* Config 27 (CELT SWB), stereo. */
+    uint8_t celtPacket[] = { 0xDC, 0x01, 0x02 };
+
+    result = OpusDepacketizer_GetPacketProperties( &( dtxPacket[ 0 ] ),
+                                                   sizeof( dtxPacket ),
+                                                   &( properties ) );
+
+    TEST_ASSERT_EQUAL( OPUS_RESULT_OK,
+                       result );
+    TEST_ASSERT_NOT_EQUAL( 0,
+                           properties & OPUS_PACKET_PROPERTY_DTX );
+    TEST_ASSERT_NOT_EQUAL( 0,
+                           properties & OPUS_PACKET_PROPERTY_STEREO );
+    TEST_ASSERT_EQUAL( OPUS_BANDWIDTH_FULLBAND,
+                       OPUS_PACKET_PROPERTY_GET_BANDWIDTH( properties ) );
+
+    result = OpusDepacketizer_GetPacketProperties( &( silkPacket[ 0 ] ),
+                                                   sizeof( silkPacket ),
+                                                   &( properties ) );
+
+    TEST_ASSERT_EQUAL( OPUS_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       properties & ( OPUS_PACKET_PROPERTY_DTX | OPUS_PACKET_PROPERTY_STEREO ) );
+    TEST_ASSERT_EQUAL( OPUS_BANDWIDTH_WIDEBAND,
+                       OPUS_PACKET_PROPERTY_GET_BANDWIDTH( properties ) );
+
+    result = OpusDepacketizer_GetPacketProperties( &( celtPacket[ 0 ] ),
+                                                   sizeof( celtPacket ),
+                                                   &( properties ) );
+
+    TEST_ASSERT_EQUAL( OPUS_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( OPUS_PACKET_PROPERTY_STEREO,
+                       properties & ( OPUS_PACKET_PROPERTY_DTX | OPUS_PACKET_PROPERTY_STEREO ) );
+    TEST_ASSERT_EQUAL( OPUS_BANDWIDTH_SUPERWIDEBAND,
+                       OPUS_PACKET_PROPERTY_GET_BANDWIDTH( properties ) );
 }
 
 /*-----------------------------------------------------------*/
@@ -472,7 +544,7 @@ void test_Opus_Depacketizer_GetFrame_OutOfMemory( void )
                        result );
 
     frame.pFrameData = &( frameBuffer[ 0 ] );
-    frame.frameDataLength = 10; /* A small buffer to test out of memory case. */
+    frame.frameDataLength = 5; /* A small buffer to test out of memory case. */
 
     result = OpusDepacketizer_GetFrame( &( ctx ),
                                         &( frame ) );
@@ -552,3 +624,109 @@ void test_Opus_Depacketizer_GetPacketProperties_BadParams( void )
 }
 
 /*-----------------------------------------------------------*/
+
+/* ==============================  Test Cases for TOC ============================== */
+
+/**
+ * @brief Validate OpusToc_Parse for all frame count codes and malformed packets.
+ */
+void test_Opus_Toc_Parse( void )
+{
+    OpusResult_t result;
+    OpusTocInfo_t tocInfo;
+    /* Config 3 (SILK 60 ms), mono, code 0. */
+    uint8_t code0Packet[] = { 0x18, 0x01, 0x02 };
+    /* Config 31 (CELT 20 ms), stereo, code 1. */
+    uint8_t code1Packet[] = { 0xFD, 0x01, 0x02, 0x03, 0x04 };
+    /* Config 13 (Hybrid 20 ms), code 2, first frame length 1. */
+    uint8_t code2Packet[] = { 0x6A, 0x01, 0xAA, 0xBB, 0xCC };
+    /* Config 16 (CELT 2.5 ms), code 3, VBR with padding, 3 frames. */
+    uint8_t code3Packet[] = { 0x83, 0xC3, 0x02, 0x01, 0x02, 0xAA, 0xBB, 0xBB, 0xCC, 0xCC, 0x00, 0x00 };
+    /* Config 3 (SILK 60 ms), code 3, 3 frames - more than 120 ms. */
+    uint8_t tooLongPacket[] = { 0x1B, 0x03, 0xAA, 0xBB, 0xCC };
+    /* Code 2 with a first frame length beyond the packet. */
+    uint8_t truncatedPacket[] = { 0x6A, 0x05, 0xAA };
+
+    result = OpusToc_Parse( &( code0Packet[ 0 ] ),
+                            sizeof( code0Packet ),
+                            &( tocInfo ) );
+
+    TEST_ASSERT_EQUAL( OPUS_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 3,
+                       tocInfo.config );
+    TEST_ASSERT_EQUAL( 0,
+                       tocInfo.isStereo );
+    TEST_ASSERT_EQUAL( 1,
+                       tocInfo.frameCount );
+    TEST_ASSERT_EQUAL( 2880,
+                       tocInfo.packetDurationSamples );
+
+    result = OpusToc_Parse( &( code1Packet[ 0 ] ),
+                            sizeof( code1Packet ),
+                            &( tocInfo ) );
+
+    TEST_ASSERT_EQUAL( OPUS_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 31,
+                       tocInfo.config );
+    TEST_ASSERT_EQUAL( 1,
+                       tocInfo.isStereo );
+    TEST_ASSERT_EQUAL( 2,
+                       tocInfo.frameCount );
+    TEST_ASSERT_EQUAL( 1920,
+                       tocInfo.packetDurationSamples );
+
+    /* Two equal frames need an even payload length. */
+    result = OpusToc_Parse( &( code1Packet[ 0 ] ),
+                            sizeof( code1Packet ) - 1,
+                            &( tocInfo ) );
+
+    TEST_ASSERT_EQUAL( OPUS_RESULT_MALFORMED_PACKET,
+                       result );
+
+    result = OpusToc_Parse( &( code2Packet[ 0 ] ),
+                            sizeof( code2Packet ),
+                            &( tocInfo ) );
+
+    TEST_ASSERT_EQUAL( OPUS_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       tocInfo.frameCountCode );
+    TEST_ASSERT_EQUAL( 1920,
+                       tocInfo.packetDurationSamples );
+
+    result = OpusToc_Parse( &( code3Packet[ 0 ] ),
+                            sizeof( code3Packet ),
+                            &( tocInfo ) );
+
+    TEST_ASSERT_EQUAL( OPUS_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 3,
+                       tocInfo.frameCount );
+    TEST_ASSERT_EQUAL( 360,
+                       tocInfo.packetDurationSamples );
+
+    result = OpusToc_Parse( &( tooLongPacket[ 0 ] ),
+                            sizeof( tooLongPacket ),
+                            &( tocInfo ) );
+
+    TEST_ASSERT_EQUAL( OPUS_RESULT_MALFORMED_PACKET,
+                       result );
+
+    result = OpusToc_Parse( &( truncatedPacket[ 0 ] ),
+                            sizeof( truncatedPacket ),
+                            &( tocInfo ) );
+
+    TEST_ASSERT_EQUAL( OPUS_RESULT_MALFORMED_PACKET,
+                       result );
+
+    result = OpusToc_Parse( NULL,
+                            sizeof( code0Packet ),
+                            &( tocInfo ) );
+
+    TEST_ASSERT_EQUAL( OPUS_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
@@ -28,8 +28,10 @@ list(APPEND mock_define_list
 
 # List the files you would like to test here.
 list(APPEND real_source_files
+            ${MODULE_ROOT_DIR}/codec_packetizers/common/simple_payload_assembler.c
             ${MODULE_ROOT_DIR}/codec_packetizers/opus/opus_depacketizer.c
             ${MODULE_ROOT_DIR}/codec_packetizers/opus/opus_packetizer.c
+            ${MODULE_ROOT_DIR}/codec_packetizers/opus/opus_toc.c
         )
 # List the directories the module under test includes.
 list(APPEND real_include_directories
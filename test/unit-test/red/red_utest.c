@@ -0,0 +1,429 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "red_packetizer.h"
+#include "red_depacketizer.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define PACKET_BUFFER_LENGTH    64
+#define MAX_FRAMES_IN_PACKET    4
+
+#define OPUS_PAYLOAD_TYPE       111
+#define FRAME_DURATION          960
+
+uint8_t packetBuffer[ PACKET_BUFFER_LENGTH ];
+
+void setUp( void )
+{
+    memset( &( packetBuffer[ 0 ] ),
+            0,
+            sizeof( packetBuffer ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate RED packetization with one redundant frame.
+ */
+void test_Red_Packetizer( void )
+{
+    RedResult_t result;
+    RedPacketizerContext_t ctx = { 0 };
+    RedFrame_t historyArray[ 1 ], frame;
+    RedPacket_t pkt;
+    uint8_t frameData1[] = { 0x10, 0x11, 0x12 };
+    uint8_t frameData2[] = { 0x20, 0x21 };
+    uint8_t frameData3[] = { 0x30 };
+    uint8_t expectedPacket1[] = { 0x6F, 0x10, 0x11, 0x12 };
+    /* F = 1, PT = 111, timestamp offset = 960, block length = 3. */
+    uint8_t expectedPacket2[] = { 0xEF, 0x0F, 0x00, 0x03, 0x6F, 0x10, 0x11, 0x12, 0x20, 0x21 };
+    uint8_t expectedPacket3[] = { 0xEF, 0x0F, 0x00, 0x02, 0x6F, 0x20, 0x21, 0x30 };
+
+    result = RedPacketizer_Init( &( ctx ),
+                                 &( historyArray[ 0 ] ),
+                                 1 );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+
+    frame.payloadType = OPUS_PAYLOAD_TYPE;
+    frame.timestamp = 1000;
+    frame.pFrameData = &( frameData1[ 0 ] );
+    frame.frameDataLength = sizeof( frameData1 );
+
+    result = RedPacketizer_AddFrame( &( ctx ),
+                                     &( frame ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetBuffer[ 0 ] );
+    pkt.packetDataLength = PACKET_BUFFER_LENGTH;
+
+    result = RedPacketizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedPacket1 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacket1[ 0 ] ),
+                                   &( pkt.pPacketData[ 0 ] ),
+                                   pkt.packetDataLength );
+
+    pkt.pPacketData = &( packetBuffer[ 0 ] );
+    pkt.packetDataLength = PACKET_BUFFER_LENGTH;
+
+    result = RedPacketizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_NO_MORE_PACKETS,
+                       result );
+
+    frame.timestamp += FRAME_DURATION;
+    frame.pFrameData = &( frameData2[ 0 ] );
+    frame.frameDataLength = sizeof( frameData2 );
+
+    result = RedPacketizer_AddFrame( &( ctx ),
+                                     &( frame ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetBuffer[ 0 ] );
+    pkt.packetDataLength = PACKET_BUFFER_LENGTH;
+
+    result = RedPacketizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedPacket2 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacket2[ 0 ] ),
+                                   &( pkt.pPacketData[ 0 ] ),
+                                   pkt.packetDataLength );
+
+    /* The oldest frame is out of the history now. */
+    frame.timestamp += FRAME_DURATION;
+    frame.pFrameData = &( frameData3[ 0 ] );
+    frame.frameDataLength = sizeof( frameData3 );
+
+    result = RedPacketizer_AddFrame( &( ctx ),
+                                     &( frame ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetBuffer[ 0 ] );
+    pkt.packetDataLength = sizeof( expectedPacket3 ) - 1;
+
+    result = RedPacketizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    pkt.pPacketData = &( packetBuffer[ 0 ] );
+    pkt.packetDataLength = PACKET_BUFFER_LENGTH;
+
+    result = RedPacketizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedPacket3 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacket3[ 0 ] ),
+                                   &( pkt.pPacketData[ 0 ] ),
+                                   pkt.packetDataLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RedPacketizer_GetPacketPrefix does not write the primary frame.
+ */
+void test_Red_Packetizer_GetPacketPrefix( void )
+{
+    RedResult_t result;
+    RedPacketizerContext_t ctx = { 0 };
+    RedFrame_t historyArray[ 2 ], frame;
+    RedPacket_t pkt;
+    uint8_t frameData1[] = { 0x10, 0x11, 0x12 };
+    uint8_t frameData2[] = { 0x20, 0x21 };
+    uint8_t expectedPrefix[] = { 0xEF, 0x0F, 0x00, 0x03, 0x6F, 0x10, 0x11, 0x12 };
+
+    result = RedPacketizer_Init( &( ctx ),
+                                 &( historyArray[ 0 ] ),
+                                 2 );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+
+    frame.payloadType = OPUS_PAYLOAD_TYPE;
+    frame.timestamp = 0xFFFFFF00;
+    frame.pFrameData = &( frameData1[ 0 ] );
+    frame.frameDataLength = sizeof( frameData1 );
+
+    result = RedPacketizer_AddFrame( &( ctx ),
+                                     &( frame ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+
+    /* Timestamp wraps around. */
+    frame.timestamp += FRAME_DURATION;
+    frame.pFrameData = &( frameData2[ 0 ] );
+    frame.frameDataLength = sizeof( frameData2 );
+
+    result = RedPacketizer_AddFrame( &( ctx ),
+                                     &( frame ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetBuffer[ 0 ] );
+    pkt.packetDataLength = sizeof( expectedPrefix );
+
+    result = RedPacketizer_GetPacketPrefix( &( ctx ),
+                                            &( pkt ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedPrefix ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPrefix[ 0 ] ),
+                                   &( pkt.pPacketData[ 0 ] ),
+                                   pkt.packetDataLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RED depacketization recovers a lost frame from a redundant block.
+ */
+void test_Red_Depacketizer( void )
+{
+    RedResult_t result;
+    RedDepacketizerContext_t ctx = { 0 };
+    RedFrame_t framesArray[ MAX_FRAMES_IN_PACKET ], frame;
+    RedPacket_t pkt;
+    uint8_t packetData1[] = { 0x6F, 0x10, 0x11, 0x12 };
+    /* Packet 2, carrying frame 2, is lost. */
+    uint8_t packetData3[] = { 0xEF, 0x1E, 0x00, 0x03, 0xEF, 0x0F, 0x00, 0x02, 0x6F,
+                              0x10, 0x11, 0x12, 0x20, 0x21, 0x30 };
+
+    result = RedDepacketizer_Init( &( ctx ),
+                                   &( framesArray[ 0 ] ),
+                                   MAX_FRAMES_IN_PACKET );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData1[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData1 );
+
+    result = RedDepacketizer_AddPacket( &( ctx ),
+                                        &( pkt ),
+                                        1000 );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+
+    result = RedDepacketizer_GetFrame( &( ctx ),
+                                       &( frame ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( OPUS_PAYLOAD_TYPE,
+                       frame.payloadType );
+    TEST_ASSERT_EQUAL( 1000,
+                       frame.timestamp );
+    TEST_ASSERT_EQUAL_PTR( &( packetData1[ 1 ] ),
+                           frame.pFrameData );
+    TEST_ASSERT_EQUAL( 3,
+                       frame.frameDataLength );
+
+    result = RedDepacketizer_GetFrame( &( ctx ),
+                                       &( frame ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_NO_MORE_FRAMES,
+                       result );
+
+    pkt.pPacketData = &( packetData3[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData3 );
+
+    result = RedDepacketizer_AddPacket( &( ctx ),
+                                        &( pkt ),
+                                        1000 + ( 2 * FRAME_DURATION ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+
+    /* Frame 1 was already received, frame 2 is recovered. */
+    result = RedDepacketizer_GetFrame( &( ctx ),
+                                       &( frame ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1000 + FRAME_DURATION,
+                       frame.timestamp );
+    TEST_ASSERT_EQUAL_PTR( &( packetData3[ 12 ] ),
+                           frame.pFrameData );
+    TEST_ASSERT_EQUAL( 2,
+                       frame.frameDataLength );
+
+    result = RedDepacketizer_GetFrame( &( ctx ),
+                                       &( frame ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1000 + ( 2 * FRAME_DURATION ),
+                       frame.timestamp );
+    TEST_ASSERT_EQUAL_PTR( &( packetData3[ 14 ] ),
+                           frame.pFrameData );
+    TEST_ASSERT_EQUAL( 1,
+                       frame.frameDataLength );
+
+    result = RedDepacketizer_GetFrame( &( ctx ),
+                                       &( frame ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_NO_MORE_FRAMES,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RedDepacketizer_AddPacket in case of malformed packets.
+ */
+void test_Red_Depacketizer_AddPacket_Malformed( void )
+{
+    RedResult_t result;
+    RedDepacketizerContext_t ctx = { 0 };
+    RedFrame_t framesArray[ MAX_FRAMES_IN_PACKET ];
+    RedPacket_t pkt;
+    /* No primary header. */
+    uint8_t packetData1[] = { 0xEF, 0x0F, 0x00, 0x00 };
+    /* Truncated redundant header. */
+    uint8_t packetData2[] = { 0xEF, 0x0F, 0x00 };
+    /* Block length beyond the packet. */
+    uint8_t packetData3[] = { 0xEF, 0x0F, 0x00, 0x03, 0x6F, 0x10, 0x11 };
+
+    result = RedDepacketizer_Init( &( ctx ),
+                                   &( framesArray[ 0 ] ),
+                                   MAX_FRAMES_IN_PACKET );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData1[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData1 );
+
+    result = RedDepacketizer_AddPacket( &( ctx ),
+                                        &( pkt ),
+                                        1000 );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_MALFORMED_PACKET,
+                       result );
+
+    pkt.pPacketData = &( packetData2[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData2 );
+
+    result = RedDepacketizer_AddPacket( &( ctx ),
+                                        &( pkt ),
+                                        1000 );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_MALFORMED_PACKET,
+                       result );
+
+    pkt.pPacketData = &( packetData3[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData3 );
+
+    result = RedDepacketizer_AddPacket( &( ctx ),
+                                        &( pkt ),
+                                        1000 );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_MALFORMED_PACKET,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate RED APIs in case of bad parameters.
+ */
+void test_Red_BadParams( void )
+{
+    RedResult_t result;
+    RedPacketizerContext_t packetizerCtx = { 0 };
+    RedDepacketizerContext_t depacketizerCtx = { 0 };
+    RedFrame_t framesArray[ MAX_FRAMES_IN_PACKET ], frame;
+    RedPacket_t pkt;
+
+    result = RedPacketizer_Init( NULL,
+                                 &( framesArray[ 0 ] ),
+                                 MAX_FRAMES_IN_PACKET );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_BAD_PARAM,
+                       result );
+
+    result = RedPacketizer_Init( &( packetizerCtx ),
+                                 NULL,
+                                 MAX_FRAMES_IN_PACKET );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_BAD_PARAM,
+                       result );
+
+    frame.pFrameData = NULL;
+    frame.frameDataLength = 1;
+
+    result = RedPacketizer_AddFrame( &( packetizerCtx ),
+                                     &( frame ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_BAD_PARAM,
+                       result );
+
+    pkt.pPacketData = &( packetBuffer[ 0 ] );
+    pkt.packetDataLength = 0;
+
+    result = RedPacketizer_GetPacket( &( packetizerCtx ),
+                                      &( pkt ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_BAD_PARAM,
+                       result );
+
+    result = RedDepacketizer_Init( &( depacketizerCtx ),
+                                   &( framesArray[ 0 ] ),
+                                   0 );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_BAD_PARAM,
+                       result );
+
+    result = RedDepacketizer_AddPacket( &( depacketizerCtx ),
+                                        NULL,
+                                        0 );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_BAD_PARAM,
+                       result );
+
+    result = RedDepacketizer_GetFrame( NULL,
+                                       &( frame ) );
+
+    TEST_ASSERT_EQUAL( RED_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
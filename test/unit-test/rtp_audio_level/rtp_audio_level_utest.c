@@ -0,0 +1,184 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "rtp_audio_level.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define SAMPLES_IN_PACKET   160
+
+int16_t pcmSamples[ SAMPLES_IN_PACKET ];
+
+void setUp( void )
+{
+    memset( &( pcmSamples[ 0 ] ),
+            0,
+            sizeof( pcmSamples ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate audio level computation for known signals.
+ */
+void test_RtpAudioLevel_GetLevel( void )
+{
+    RtpResult_t result;
+    RtpAudioLevelContext_t ctx;
+    uint8_t level;
+    size_t i;
+
+    result = RtpAudioLevel_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    /* No samples. */
+    result = RtpAudioLevel_GetLevel( &( ctx ),
+                                     &( level ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_AUDIO_LEVEL_SILENCE,
+                       level );
+
+    /* Digital silence. */
+    result = RtpAudioLevel_AddPcmSamples( &( ctx ),
+                                          &( pcmSamples[ 0 ] ),
+                                          SAMPLES_IN_PACKET );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    result = RtpAudioLevel_GetLevel( &( ctx ),
+                                     &( level ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( RTP_EXTENSION_AUDIO_LEVEL_SILENCE,
+                       level );
+
+    /* Full scale square wave - 0 dBov. */
+    for( i = 0; i < SAMPLES_IN_PACKET; i++ )
+    {
+        pcmSamples[ i ] = ( ( i % 2 ) == 0 ) ? -32768 : 32767;
+    }
+
+    result = RtpAudioLevel_AddPcmSamples( &( ctx ),
+                                          &( pcmSamples[ 0 ] ),
+                                          SAMPLES_IN_PACKET );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    result = RtpAudioLevel_GetLevel( &( ctx ),
+                                     &( level ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 0,
+                       level );
+
+    /* Constant amplitude of 100 - 20 * log10( 32768 / 100 ) = 50.3 dB, added
+     * in two parts. */
+    for( i = 0; i < SAMPLES_IN_PACKET; i++ )
+    {
+        pcmSamples[ i ] = ( ( i % 2 ) == 0 ) ? -100 : 100;
+    }
+
+    result = RtpAudioLevel_AddPcmSamples( &( ctx ),
+                                          &( pcmSamples[ 0 ] ),
+                                          SAMPLES_IN_PACKET / 2 );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    result = RtpAudioLevel_AddPcmSamples( &( ctx ),
+                                          &( pcmSamples[ SAMPLES_IN_PACKET / 2 ] ),
+                                          SAMPLES_IN_PACKET / 2 );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    result = RtpAudioLevel_GetLevel( &( ctx ),
+                                     &( level ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 50,
+                       level );
+
+    result = RtpAudioLevel_GetLevel( NULL,
+                                     &( level ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate audio level extension payload creation.
+ */
+void test_RtpAudioLevel_CreateExtensionPayload( void )
+{
+    RtpResult_t result;
+    RtpAudioLevelContext_t ctx;
+    uint32_t extensionPayload;
+    size_t i;
+
+    result = RtpAudioLevel_Init( &( ctx ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    /* Amplitude of 1 - 90.3 dB below full scale. */
+    for( i = 0; i < SAMPLES_IN_PACKET; i++ )
+    {
+        pcmSamples[ i ] = 1;
+    }
+
+    result = RtpAudioLevel_AddPcmSamples( &( ctx ),
+                                          &( pcmSamples[ 0 ] ),
+                                          SAMPLES_IN_PACKET );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+
+    result = RtpAudioLevel_CreateExtensionPayload( &( ctx ),
+                                                   1,
+                                                   1,
+                                                   &( extensionPayload ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL_UINT32( 0x10DA0000,
+                              extensionPayload );
+    TEST_ASSERT_EQUAL( 1,
+                       RTP_EXTENSION_AUDIO_LEVEL_GET_ID_FROM_PAYLOAD( extensionPayload ) );
+    TEST_ASSERT_EQUAL( 1,
+                       RTP_EXTENSION_AUDIO_LEVEL_GET_VOICE_FROM_PAYLOAD( extensionPayload ) );
+    TEST_ASSERT_EQUAL( 90,
+                       RTP_EXTENSION_AUDIO_LEVEL_GET_LEVEL_FROM_PAYLOAD( extensionPayload ) );
+
+    /* ID 15 is reserved in the one-byte header format. */
+    result = RtpAudioLevel_CreateExtensionPayload( &( ctx ),
+                                                   15,
+                                                   0,
+                                                   &( extensionPayload ) );
+
+    TEST_ASSERT_EQUAL( RTP_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
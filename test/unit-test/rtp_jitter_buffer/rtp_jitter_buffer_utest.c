@@ -0,0 +1,710 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "rtp_jitter_buffer.h"
+#include "g711_interface.h"
+#include "h264_interface.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define MAX_PACKETS_IN_BUFFER   16
+#define MAX_FRAME_LENGTH        64
+
+RtpJitterBufferPacket_t jitterBufferPackets[ MAX_PACKETS_IN_BUFFER ];
+uint8_t frameBuffer[ MAX_FRAME_LENGTH ];
+
+void setUp( void )
+{
+    memset( &( jitterBufferPackets[ 0 ] ),
+            0,
+            sizeof( jitterBufferPackets ) );
+    memset( &( frameBuffer[ 0 ] ),
+            0,
+            sizeof( frameBuffer ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Helpers  ============================== */
+
+static RtpJitterBufferResult_t AddPacket( RtpJitterBuffer_t * pJitterBuffer,
+                                          uint16_t seqNum,
+                                          uint32_t rtpTimestamp,
+                                          uint8_t isMarkerSet,
+                                          uint8_t * pPayload,
+                                          size_t payloadLength,
+                                          uint32_t arrivalTimeMs )
+{
+    RtpPacket_t rtpPacket;
+
+    memset( &( rtpPacket ),
+            0,
+            sizeof( rtpPacket ) );
+
+    rtpPacket.header.sequenceNumber = seqNum;
+    rtpPacket.header.timestamp = rtpTimestamp;
+    rtpPacket.header.flags = ( isMarkerSet == 1 ) ? RTP_HEADER_FLAG_MARKER : 0;
+    rtpPacket.pPayload = pPayload;
+    rtpPacket.payloadLength = payloadLength;
+
+    return RtpJitterBuffer_AddPacket( pJitterBuffer,
+                                      &( rtpPacket ),
+                                      arrivalTimeMs );
+}
+
+/* ==============================  Test Cases  ============================== */
+
+/**
+ * @brief Validate that packets added in any order are released in order,
+ * across the sequence number wrap around.
+ */
+void test_RtpJitterBuffer_Reorder( void )
+{
+    RtpJitterBufferResult_t result;
+    RtpJitterBuffer_t jitterBuffer;
+    G711DepacketizerContext_t depacketizerCtx;
+    G711Packet_t depacketizerPackets[ MAX_PACKETS_IN_BUFFER ];
+    CodecDepacketizer_t depacketizer;
+    CodecFrame_t frame;
+    uint8_t payloads[ 5 ][ 2 ] = { { 0x00, 0x01 }, { 0x10, 0x11 }, { 0x20, 0x21 }, { 0x30, 0x31 }, { 0x40, 0x41 } };
+    uint32_t rtpTimestamp;
+    size_t i;
+
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       G711Depacketizer_Init( &( depacketizerCtx ),
+                                              &( depacketizerPackets[ 0 ] ),
+                                              MAX_PACKETS_IN_BUFFER ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       G711Interface_InitDepacketizer( &( depacketizer ),
+                                                       &( depacketizerCtx ) ) );
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferPackets[ 0 ] ),
+                                   MAX_PACKETS_IN_BUFFER,
+                                   &( depacketizer ),
+                                   8000 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+
+    result = RtpJitterBuffer_SetDelayRange( &( jitterBuffer ),
+                                            0,
+                                            0 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+
+    /* Sequence numbers 65535, 0, 1, 2 arrive as 0, 65535, 2, 1. */
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       AddPacket( &( jitterBuffer ), 0, 160, 0, &( payloads[ 1 ][ 0 ] ), 2, 0 ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       AddPacket( &( jitterBuffer ), 65535, 0, 0, &( payloads[ 0 ][ 0 ] ), 2, 0 ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       AddPacket( &( jitterBuffer ), 2, 480, 0, &( payloads[ 3 ][ 0 ] ), 2, 0 ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       AddPacket( &( jitterBuffer ), 1, 320, 0, &( payloads[ 2 ][ 0 ] ), 2, 0 ) );
+
+    for( i = 0; i < 3; i++ )
+    {
+        result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                           0,
+                                           &( rtpTimestamp ) );
+        TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( i * 160,
+                           rtpTimestamp );
+
+        frame.pFrameData = &( frameBuffer[ 0 ] );
+        frame.frameDataLength = sizeof( frameBuffer );
+        TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                           CodecDepacketizer_GetFrame( &( depacketizer ),
+                                                       &( frame ) ) );
+        TEST_ASSERT_EQUAL( 2,
+                           frame.frameDataLength );
+        TEST_ASSERT_EQUAL_UINT8_ARRAY( &( payloads[ i ][ 0 ] ),
+                                       &( frame.pFrameData[ 0 ] ),
+                                       frame.frameDataLength );
+    }
+
+    /* The end of the last frame is not known until the next packet. */
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                       0,
+                                       &( rtpTimestamp ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME,
+                       result );
+
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_LATE_PACKET,
+                       AddPacket( &( jitterBuffer ), 65535, 0, 0, &( payloads[ 0 ][ 0 ] ), 2, 0 ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_DUPLICATE_PACKET,
+                       AddPacket( &( jitterBuffer ), 2, 480, 0, &( payloads[ 3 ][ 0 ] ), 2, 0 ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       AddPacket( &( jitterBuffer ), 3, 640, 1, &( payloads[ 4 ][ 0 ] ), 2, 0 ) );
+
+    for( i = 3; i < 5; i++ )
+    {
+        result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                           0,
+                                           &( rtpTimestamp ) );
+        TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( i * 160,
+                           rtpTimestamp );
+    }
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                       0,
+                                       &( rtpTimestamp ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that frames are held for the target delay and that an
+ * incomplete frame is dropped when due.
+ */
+void test_RtpJitterBuffer_LostPacket( void )
+{
+    RtpJitterBufferResult_t result;
+    RtpJitterBuffer_t jitterBuffer;
+    H264DepacketizerContext_t depacketizerCtx;
+    H264Packet_t depacketizerPackets[ MAX_PACKETS_IN_BUFFER ];
+    CodecDepacketizer_t depacketizer;
+    CodecFrame_t frame;
+    uint8_t fuAStart[] = { 0x7C, 0x85, 0xAA, 0xBB };
+    uint8_t fuAMiddle[] = { 0x7C, 0x05, 0xCC };
+    uint8_t fuAEnd[] = { 0x7C, 0x45, 0xDD };
+    uint8_t singleNalu[] = { 0x41, 0x9A, 0x01 };
+    uint8_t expectedFrame[] = { 0x00, 0x00, 0x00, 0x01, 0x41, 0x9A, 0x01 };
+    uint32_t rtpTimestamp;
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Depacketizer_Init( &( depacketizerCtx ),
+                                              &( depacketizerPackets[ 0 ] ),
+                                              MAX_PACKETS_IN_BUFFER ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       H264Interface_InitDepacketizer( &( depacketizer ),
+                                                       &( depacketizerCtx ) ) );
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferPackets[ 0 ] ),
+                                   MAX_PACKETS_IN_BUFFER,
+                                   &( depacketizer ),
+                                   90000 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+
+    result = RtpJitterBuffer_SetDelayRange( &( jitterBuffer ),
+                                            50,
+                                            50 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+
+    /* The middle fragment of the first frame is lost. */
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       AddPacket( &( jitterBuffer ), 10, 1000, 0, &( fuAStart[ 0 ] ), sizeof( fuAStart ), 0 ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       AddPacket( &( jitterBuffer ), 12, 1000, 1, &( fuAEnd[ 0 ] ), sizeof( fuAEnd ), 0 ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       AddPacket( &( jitterBuffer ), 13, 4000, 1, &( singleNalu[ 0 ] ), sizeof( singleNalu ), 0 ) );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                       49,
+                                       &( rtpTimestamp ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME,
+                       result );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                       50,
+                                       &( rtpTimestamp ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_FRAME_DROPPED,
+                       result );
+    TEST_ASSERT_EQUAL( 1000,
+                       rtpTimestamp );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                       50,
+                                       &( rtpTimestamp ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 4000,
+                       rtpTimestamp );
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = sizeof( frameBuffer );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       CodecDepacketizer_GetFrame( &( depacketizer ),
+                                                   &( frame ) ) );
+    TEST_ASSERT_EQUAL( sizeof( expectedFrame ),
+                       frame.frameDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedFrame[ 0 ] ),
+                                   &( frame.pFrameData[ 0 ] ),
+                                   frame.frameDataLength );
+
+    /* The lost fragment arrives after its frame is dropped. */
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_LATE_PACKET,
+                       AddPacket( &( jitterBuffer ), 11, 1000, 0, &( fuAMiddle[ 0 ] ), sizeof( fuAMiddle ), 60 ) );
+
+    /* Too far ahead of the oldest packet held, which is dropped. */
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       AddPacket( &( jitterBuffer ), 14, 7000, 1, &( singleNalu[ 0 ] ), sizeof( singleNalu ), 60 ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       AddPacket( &( jitterBuffer ), 14 + MAX_PACKETS_IN_BUFFER, 9000, 1, &( singleNalu[ 0 ] ), sizeof( singleNalu ), 60 ) );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                       110,
+                                       &( rtpTimestamp ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 9000,
+                       rtpTimestamp );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the jitter buffer restarts after a sequence number jump
+ * larger than the packets array.
+ */
+void test_RtpJitterBuffer_SequenceJump( void )
+{
+    RtpJitterBufferResult_t result;
+    RtpJitterBuffer_t jitterBuffer;
+    G711DepacketizerContext_t depacketizerCtx;
+    G711Packet_t depacketizerPackets[ MAX_PACKETS_IN_BUFFER ];
+    CodecDepacketizer_t depacketizer;
+    CodecFrame_t frame;
+    uint8_t payloads[ 5 ][ 2 ] = { { 0x00, 0x01 }, { 0x10, 0x11 }, { 0x20, 0x21 }, { 0x30, 0x31 }, { 0x40, 0x41 } };
+    uint32_t rtpTimestamp;
+    uint16_t i;
+
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       G711Depacketizer_Init( &( depacketizerCtx ),
+                                              &( depacketizerPackets[ 0 ] ),
+                                              MAX_PACKETS_IN_BUFFER ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       G711Interface_InitDepacketizer( &( depacketizer ),
+                                                       &( depacketizerCtx ) ) );
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferPackets[ 0 ] ),
+                                   MAX_PACKETS_IN_BUFFER,
+                                   &( depacketizer ),
+                                   8000 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+
+    result = RtpJitterBuffer_SetDelayRange( &( jitterBuffer ),
+                                            0,
+                                            0 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+
+    for( i = 0; i < 6; i++ )
+    {
+        TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                           AddPacket( &( jitterBuffer ), i, i * 160, 0, &( payloads[ 0 ][ 0 ] ), 2, 0 ) );
+    }
+
+    /* The sequence number jumps by more than the packets array. */
+    for( i = 0; i < 5; i++ )
+    {
+        TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                           AddPacket( &( jitterBuffer ), 100 + i, 16000 + ( i * 160 ), 0, &( payloads[ i ][ 0 ] ), 2, 0 ) );
+    }
+
+    TEST_ASSERT_EQUAL( 5,
+                       jitterBuffer.packetCount );
+
+    for( i = 0; i < 4; i++ )
+    {
+        result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                           0,
+                                           &( rtpTimestamp ) );
+        TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( 16000 + ( i * 160 ),
+                           rtpTimestamp );
+
+        frame.pFrameData = &( frameBuffer[ 0 ] );
+        frame.frameDataLength = sizeof( frameBuffer );
+        TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                           CodecDepacketizer_GetFrame( &( depacketizer ),
+                                                       &( frame ) ) );
+        TEST_ASSERT_EQUAL_UINT8_ARRAY( &( payloads[ i ][ 0 ] ),
+                                       &( frame.pFrameData[ 0 ] ),
+                                       2 );
+    }
+
+    /* The end of the last frame is not known until the next packet. */
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                       0,
+                                       &( rtpTimestamp ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a lost audio packet drops no other frame, the frame
+ * before it being held until the packet after it is due.
+ */
+void test_RtpJitterBuffer_LostAudioPacket( void )
+{
+    RtpJitterBufferResult_t result;
+    RtpJitterBuffer_t jitterBuffer;
+    G711DepacketizerContext_t depacketizerCtx;
+    G711Packet_t depacketizerPackets[ MAX_PACKETS_IN_BUFFER ];
+    CodecDepacketizer_t depacketizer;
+    CodecFrame_t frame;
+    uint8_t payloads[ 6 ][ 2 ] = { { 0x00, 0x01 }, { 0x10, 0x11 }, { 0x20, 0x21 }, { 0x30, 0x31 }, { 0x40, 0x41 }, { 0x50, 0x51 } };
+    uint16_t expectedSeqNums[] = { 0, 1, 2, 4 };
+    uint32_t rtpTimestamp;
+    uint16_t i;
+
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       G711Depacketizer_Init( &( depacketizerCtx ),
+                                              &( depacketizerPackets[ 0 ] ),
+                                              MAX_PACKETS_IN_BUFFER ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       G711Interface_InitDepacketizer( &( depacketizer ),
+                                                       &( depacketizerCtx ) ) );
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferPackets[ 0 ] ),
+                                   MAX_PACKETS_IN_BUFFER,
+                                   &( depacketizer ),
+                                   8000 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+
+    result = RtpJitterBuffer_SetDelayRange( &( jitterBuffer ),
+                                            20,
+                                            20 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+
+    /* A packet every 20 ms, packet 3 is lost. */
+    for( i = 0; i < 6; i++ )
+    {
+        if( i != 3 )
+        {
+            TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                               AddPacket( &( jitterBuffer ), i, i * 160, 0, &( payloads[ i ][ 0 ] ), 2, i * 20 ) );
+        }
+    }
+
+    for( i = 0; i < 2; i++ )
+    {
+        result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                           90,
+                                           &( rtpTimestamp ) );
+        TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                           result );
+        frame.pFrameData = &( frameBuffer[ 0 ] );
+        frame.frameDataLength = sizeof( frameBuffer );
+        TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                           CodecDepacketizer_GetFrame( &( depacketizer ),
+                                                       &( frame ) ) );
+    }
+
+    /* Packet 3 may still arrive until packet 4 is due. */
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                       90,
+                                       &( rtpTimestamp ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME,
+                       result );
+
+    for( i = 2; i < 4; i++ )
+    {
+        result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                           100,
+                                           &( rtpTimestamp ) );
+        TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( expectedSeqNums[ i ] * 160,
+                           rtpTimestamp );
+
+        frame.pFrameData = &( frameBuffer[ 0 ] );
+        frame.frameDataLength = sizeof( frameBuffer );
+        TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                           CodecDepacketizer_GetFrame( &( depacketizer ),
+                                                       &( frame ) ) );
+        TEST_ASSERT_EQUAL( 2,
+                           frame.frameDataLength );
+        TEST_ASSERT_EQUAL_UINT8_ARRAY( &( payloads[ expectedSeqNums[ i ] ][ 0 ] ),
+                                       &( frame.pFrameData[ 0 ] ),
+                                       frame.frameDataLength );
+    }
+
+    /* The end of the last frame is not known until the next packet. */
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                       200,
+                                       &( rtpTimestamp ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a frame whose first packet is lost is dropped, even
+ * though a later packet of the frame starts a NAL unit.
+ */
+void test_RtpJitterBuffer_LostFirstPacket( void )
+{
+    RtpJitterBufferResult_t result;
+    RtpJitterBuffer_t jitterBuffer;
+    H264DepacketizerContext_t depacketizerCtx;
+    H264Packet_t depacketizerPackets[ MAX_PACKETS_IN_BUFFER ];
+    CodecDepacketizer_t depacketizer;
+    CodecFrame_t frame;
+    uint8_t singleNalu[] = { 0x41, 0x9A, 0x01 };
+    uint8_t expectedFrame[] = { 0x00, 0x00, 0x00, 0x01, 0x41, 0x9A, 0x01 };
+    uint32_t rtpTimestamp;
+
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Depacketizer_Init( &( depacketizerCtx ),
+                                              &( depacketizerPackets[ 0 ] ),
+                                              MAX_PACKETS_IN_BUFFER ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       H264Interface_InitDepacketizer( &( depacketizer ),
+                                                       &( depacketizerCtx ) ) );
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferPackets[ 0 ] ),
+                                   MAX_PACKETS_IN_BUFFER,
+                                   &( depacketizer ),
+                                   90000 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+
+    result = RtpJitterBuffer_SetDelayRange( &( jitterBuffer ),
+                                            0,
+                                            0 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       AddPacket( &( jitterBuffer ), 20, 1000, 1, &( singleNalu[ 0 ] ), sizeof( singleNalu ), 0 ) );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                       0,
+                                       &( rtpTimestamp ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1000,
+                       rtpTimestamp );
+    TEST_ASSERT_EQUAL( H264_RESULT_OK,
+                       H264Depacketizer_Init( &( depacketizerCtx ),
+                                              &( depacketizerPackets[ 0 ] ),
+                                              MAX_PACKETS_IN_BUFFER ) );
+
+    /* The first NAL unit of the second frame is lost, the second one is
+     * a single NAL unit packet with the marker bit. */
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       AddPacket( &( jitterBuffer ), 22, 4000, 1, &( singleNalu[ 0 ] ), sizeof( singleNalu ), 0 ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       AddPacket( &( jitterBuffer ), 23, 7000, 1, &( singleNalu[ 0 ] ), sizeof( singleNalu ), 0 ) );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                       0,
+                                       &( rtpTimestamp ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_FRAME_DROPPED,
+                       result );
+    TEST_ASSERT_EQUAL( 4000,
+                       rtpTimestamp );
+
+    /* The next frame follows a packet with the marker bit. */
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                       0,
+                                       &( rtpTimestamp ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 7000,
+                       rtpTimestamp );
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = sizeof( frameBuffer );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       CodecDepacketizer_GetFrame( &( depacketizer ),
+                                                   &( frame ) ) );
+    TEST_ASSERT_EQUAL( sizeof( expectedFrame ),
+                       frame.frameDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedFrame[ 0 ] ),
+                                   &( frame.pFrameData[ 0 ] ),
+                                   frame.frameDataLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the target delay follows the interarrival jitter.
+ */
+void test_RtpJitterBuffer_AdaptiveDelay( void )
+{
+    RtpJitterBufferResult_t result;
+    RtpJitterBuffer_t jitterBuffer;
+    G711DepacketizerContext_t depacketizerCtx;
+    G711Packet_t depacketizerPackets[ MAX_PACKETS_IN_BUFFER ];
+    CodecDepacketizer_t depacketizer;
+    uint8_t payload[] = { 0xFF, 0xFF };
+    uint32_t rtpTimestamp;
+    uint16_t i;
+
+    TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                       G711Depacketizer_Init( &( depacketizerCtx ),
+                                              &( depacketizerPackets[ 0 ] ),
+                                              MAX_PACKETS_IN_BUFFER ) );
+    TEST_ASSERT_EQUAL( CODEC_RESULT_OK,
+                       G711Interface_InitDepacketizer( &( depacketizer ),
+                                                       &( depacketizerCtx ) ) );
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferPackets[ 0 ] ),
+                                   MAX_PACKETS_IN_BUFFER,
+                                   &( depacketizer ),
+                                   8000 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+
+    result = RtpJitterBuffer_SetDelayRange( &( jitterBuffer ),
+                                            10,
+                                            60 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+
+    /* Packets every 20 ms without jitter. */
+    for( i = 0; i < 8; i++ )
+    {
+        TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                           AddPacket( &( jitterBuffer ), i, i * 160, 0, &( payload[ 0 ] ), sizeof( payload ), i * 20 ) );
+    }
+
+    TEST_ASSERT_EQUAL( 10,
+                       jitterBuffer.targetDelayMs );
+
+    /* Release all but the last packet. */
+    for( i = 0; i < 7; i++ )
+    {
+        result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                           1000,
+                                           &( rtpTimestamp ) );
+        TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( G711_RESULT_OK,
+                           G711Depacketizer_Init( &( depacketizerCtx ),
+                                                  &( depacketizerPackets[ 0 ] ),
+                                                  MAX_PACKETS_IN_BUFFER ) );
+    }
+
+    /* Every other packet is 30 ms late. */
+    for( i = 8; i < 16; i++ )
+    {
+        TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                           AddPacket( &( jitterBuffer ), i, i * 160, 0, &( payload[ 0 ] ), sizeof( payload ), ( i * 20 ) + ( ( i % 2 ) * 30 ) ) );
+    }
+
+    TEST_ASSERT_GREATER_THAN( 10,
+                              jitterBuffer.targetDelayMs );
+    TEST_ASSERT_LESS_OR_EQUAL( 60,
+                               jitterBuffer.targetDelayMs );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the jitter buffer in case of bad parameters.
+ */
+void test_RtpJitterBuffer_BadParams( void )
+{
+    RtpJitterBufferResult_t result;
+    RtpJitterBuffer_t jitterBuffer;
+    CodecDepacketizer_t depacketizer = { 0 };
+    RtpPacket_t rtpPacket = { 0 };
+    uint32_t rtpTimestamp;
+
+    result = RtpJitterBuffer_Init( NULL,
+                                   &( jitterBufferPackets[ 0 ] ),
+                                   MAX_PACKETS_IN_BUFFER,
+                                   &( depacketizer ),
+                                   8000 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferPackets[ 0 ] ),
+                                   1,
+                                   &( depacketizer ),
+                                   8000 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferPackets[ 0 ] ),
+                                   MAX_PACKETS_IN_BUFFER,
+                                   NULL,
+                                   8000 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferPackets[ 0 ] ),
+                                   MAX_PACKETS_IN_BUFFER,
+                                   &( depacketizer ),
+                                   0 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtpJitterBuffer_Init( &( jitterBuffer ),
+                                   &( jitterBufferPackets[ 0 ] ),
+                                   MAX_PACKETS_IN_BUFFER,
+                                   &( depacketizer ),
+                                   8000 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_OK,
+                       result );
+
+    result = RtpJitterBuffer_SetDelayRange( &( jitterBuffer ),
+                                            100,
+                                            10 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM,
+                       result );
+
+    /* No payload. */
+    result = RtpJitterBuffer_AddPacket( &( jitterBuffer ),
+                                        &( rtpPacket ),
+                                        0 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM,
+                       result );
+
+    /* The depacketizer is not set up to read packet properties. */
+    rtpPacket.pPayload = &( frameBuffer[ 0 ] );
+    rtpPacket.payloadLength = 1;
+    result = RtpJitterBuffer_AddPacket( &( jitterBuffer ),
+                                        &( rtpPacket ),
+                                        0 );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_MALFORMED_PACKET,
+                       result );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                       0,
+                                       NULL );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_BAD_PARAM,
+                       result );
+
+    result = RtpJitterBuffer_PopFrame( &( jitterBuffer ),
+                                       0,
+                                       &( rtpTimestamp ) );
+    TEST_ASSERT_EQUAL( RTP_JITTER_BUFFER_RESULT_NO_FRAME,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
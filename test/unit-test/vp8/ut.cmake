@@ -29,6 +29,7 @@ list(APPEND mock_define_list
 # List the files you would like to test here.
 list(APPEND real_source_files
             ${MODULE_ROOT_DIR}/codec_packetizers/vp8/vp8_depacketizer.c
+            ${MODULE_ROOT_DIR}/codec_packetizers/vp8/vp8_layer_filter.c
             ${MODULE_ROOT_DIR}/codec_packetizers/vp8/vp8_packetizer.c
         )
 # List the directories the module under test includes.
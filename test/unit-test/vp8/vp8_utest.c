@@ -9,6 +9,7 @@
 /* API includes. */
 #include "vp8_packetizer.h"
 #include "vp8_depacketizer.h"
+#include "vp8_layer_filter.h"
 
 /* ===========================  EXTERN VARIABLES  =========================== */
 
@@ -608,6 +609,317 @@ void test_VP8_Packetizer_AllProperties( void )
 
 /*-----------------------------------------------------------*/
 
+/**
+ * @brief Validate VP8 packetization aligned to partition boundaries.
+ */
+void test_VP8_Packetizer_Partitions( void )
+{
+    VP8PacketizerContext_t ctx;
+    VP8Result_t result;
+    VP8Packet_t pkt;
+    VP8Frame_t frame;
+    uint8_t frameData[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09 };
+    uint8_t pktBuffer[ 7 ];
+    size_t partitionLengths[] = { 3, 2, 5 };
+    size_t fragmentedPartitionLengths[] = { 8, 2 };
+    uint8_t expectedPacket1[] = { 0x10, 0x00, 0x01, 0x02, 0x03, 0x04 };
+    uint8_t expectedPacket2[] = { 0x12, 0x05, 0x06, 0x07, 0x08, 0x09 };
+    uint8_t expectedPacket3[] = { 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 };
+    uint8_t expectedPacket4[] = { 0x00, 0x06, 0x07, 0x08, 0x09 };
+
+    memset( &( frame ),
+            0,
+            sizeof( VP8Frame_t ) );
+    frame.pFrameData = &( frameData[ 0 ] );
+    frame.frameDataLength = sizeof( frameData );
+
+    /* Partitions 0 and 1 are aggregated, partition 2 does not fit after them. */
+    result = VP8Packetizer_InitWithPartitions( &( ctx ),
+                                               &( frame ),
+                                               &( partitionLengths[ 0 ] ),
+                                               3 );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = sizeof( pktBuffer );
+
+    result = VP8Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedPacket1 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacket1[ 0 ] ),
+                                   &( pktBuffer[ 0 ] ),
+                                   pkt.packetDataLength );
+
+    pkt.packetDataLength = sizeof( pktBuffer );
+
+    result = VP8Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedPacket2 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacket2[ 0 ] ),
+                                   &( pktBuffer[ 0 ] ),
+                                   pkt.packetDataLength );
+
+    pkt.packetDataLength = sizeof( pktBuffer );
+
+    result = VP8Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_NO_MORE_PACKETS,
+                       result );
+
+    /* Partition 0 is fragmented and partition 1 fits after its last fragment. */
+    result = VP8Packetizer_InitWithPartitions( &( ctx ),
+                                               &( frame ),
+                                               &( fragmentedPartitionLengths[ 0 ] ),
+                                               2 );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+
+    pkt.packetDataLength = sizeof( pktBuffer );
+
+    result = VP8Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedPacket3 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacket3[ 0 ] ),
+                                   &( pktBuffer[ 0 ] ),
+                                   pkt.packetDataLength );
+
+    pkt.packetDataLength = sizeof( pktBuffer );
+
+    result = VP8Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedPacket4 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacket4[ 0 ] ),
+                                   &( pktBuffer[ 0 ] ),
+                                   pkt.packetDataLength );
+
+    /* Partition lengths must add up to the frame length. */
+    result = VP8Packetizer_InitWithPartitions( &( ctx ),
+                                               &( frame ),
+                                               &( partitionLengths[ 0 ] ),
+                                               2 );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate VP8 picture ID and TL0PICIDX sequencing with a stream
+ * context.
+ */
+void test_VP8_Packetizer_Stream( void )
+{
+    VP8PacketizerContext_t ctx;
+    VP8StreamContext_t streamCtx;
+    VP8Result_t result;
+    VP8Packet_t pkt;
+    VP8Frame_t frame;
+    uint8_t frameData[] = { 0x00, 0x01 };
+    uint8_t pktBuffer[ 16 ];
+    uint8_t i;
+    uint8_t tids[] = { 0, 1, 0 };
+    uint8_t expectedPackets[][ 8 ] =
+    {
+        /* Picture ID = 0x7FFF, TL0PICIDX = 255, TID = 0. */
+        { 0x90, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01 },
+        /* Picture ID = 0, TL0PICIDX = 255, TID = 1, Y = 1. */
+        { 0x90, 0xE0, 0x80, 0x00, 0xFF, 0x60, 0x00, 0x01 },
+        /* Picture ID = 1, TL0PICIDX = 0, TID = 0. */
+        { 0x90, 0xE0, 0x80, 0x01, 0x00, 0x00, 0x00, 0x01 }
+    };
+
+    result = VP8Packetizer_InitStream( &( streamCtx ),
+                                       VP8_FRAME_PROP_PICTURE_ID_PRESENT |
+                                       VP8_FRAME_PROP_TL0PICIDX_PRESENT |
+                                       VP8_FRAME_PROP_TID_PRESENT,
+                                       0x7FFF,
+                                       255 );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+
+    for( i = 0; i < sizeof( tids ); i++ )
+    {
+        memset( &( frame ),
+                0,
+                sizeof( VP8Frame_t ) );
+        frame.tid = tids[ i ];
+        frame.pFrameData = &( frameData[ 0 ] );
+        frame.frameDataLength = sizeof( frameData );
+
+        if( tids[ i ] != 0 )
+        {
+            frame.frameProperties = VP8_FRAME_PROP_DEPENDS_ON_BASE_ONLY;
+        }
+
+        result = VP8Packetizer_InitWithStream( &( ctx ),
+                                               &( streamCtx ),
+                                               &( frame ) );
+
+        TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                           result );
+
+        pkt.pPacketData = &( pktBuffer[ 0 ] );
+        pkt.packetDataLength = sizeof( pktBuffer );
+
+        result = VP8Packetizer_GetPacket( &( ctx ),
+                                          &( pkt ) );
+
+        TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( sizeof( expectedPackets[ i ] ),
+                           pkt.packetDataLength );
+        TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPackets[ i ][ 0 ] ),
+                                       &( pktBuffer[ 0 ] ),
+                                       pkt.packetDataLength );
+    }
+
+    result = VP8Packetizer_InitStream( &( streamCtx ),
+                                       VP8_FRAME_PROP_PICTURE_ID_PRESENT,
+                                       0x8000,
+                                       0 );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that partition alignment is kept when packetizing with a
+ * stream context.
+ */
+void test_VP8_Packetizer_StreamWithPartitions( void )
+{
+    VP8PacketizerContext_t ctx;
+    VP8StreamContext_t streamCtx;
+    VP8Result_t result;
+    VP8Packet_t pkt;
+    VP8Frame_t frame;
+    uint8_t frameData[] = { 0x00, 0x01, 0x02, 0x03, 0x04 };
+    uint8_t pktBuffer[ 8 ];
+    size_t partitionLengths[] = { 2, 3 };
+    /* Picture ID = 5, partition 0. */
+    uint8_t expectedPacket1[] = { 0x90, 0x80, 0x80, 0x05, 0x00, 0x01 };
+    /* Picture ID = 5, start of partition 1. */
+    uint8_t expectedPacket2[] = { 0x91, 0x80, 0x80, 0x05, 0x02, 0x03, 0x04 };
+    /* Picture ID = 6, whole frame in one packet. */
+    uint8_t expectedPacket3[] = { 0x90, 0x80, 0x80, 0x06, 0x00, 0x01, 0x02, 0x03 };
+
+    result = VP8Packetizer_InitStream( &( streamCtx ),
+                                       VP8_FRAME_PROP_PICTURE_ID_PRESENT,
+                                       5,
+                                       0 );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+
+    memset( &( frame ),
+            0,
+            sizeof( VP8Frame_t ) );
+    frame.pFrameData = &( frameData[ 0 ] );
+    frame.frameDataLength = sizeof( frameData );
+
+    /* Partition lengths must add up to the frame length. The picture ID is not
+     * consumed by the rejected frame. */
+    result = VP8Packetizer_InitWithStreamAndPartitions( &( ctx ),
+                                                        &( streamCtx ),
+                                                        &( frame ),
+                                                        &( partitionLengths[ 0 ] ),
+                                                        1 );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_BAD_PARAM,
+                       result );
+
+    result = VP8Packetizer_InitWithStreamAndPartitions( &( ctx ),
+                                                        &( streamCtx ),
+                                                        &( frame ),
+                                                        &( partitionLengths[ 0 ] ),
+                                                        2 );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = sizeof( pktBuffer );
+
+    result = VP8Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedPacket1 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacket1[ 0 ] ),
+                                   &( pktBuffer[ 0 ] ),
+                                   pkt.packetDataLength );
+
+    pkt.packetDataLength = sizeof( pktBuffer );
+
+    result = VP8Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedPacket2 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacket2[ 0 ] ),
+                                   &( pktBuffer[ 0 ] ),
+                                   pkt.packetDataLength );
+
+    pkt.packetDataLength = sizeof( pktBuffer );
+
+    result = VP8Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_NO_MORE_PACKETS,
+                       result );
+
+    /* Without partitions, the next frame is filled up to the packet size. */
+    result = VP8Packetizer_InitWithStream( &( ctx ),
+                                           &( streamCtx ),
+                                           &( frame ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+
+    pkt.packetDataLength = sizeof( pktBuffer );
+
+    result = VP8Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( expectedPacket3 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedPacket3[ 0 ] ),
+                                   &( pktBuffer[ 0 ] ),
+                                   pkt.packetDataLength );
+}
+
+/*-----------------------------------------------------------*/
+
 /**
  * @brief Validate VP8_Packetizer_Init incase of bad parameters.
  */
@@ -1350,12 +1662,208 @@ void test_VP8_Depacketizer_GetPacketProperties( void )
 
     TEST_ASSERT_EQUAL( VP8_RESULT_OK,
                        result );
-    TEST_ASSERT_EQUAL( VP8_PACKET_PROP_START_PACKET,
+    TEST_ASSERT_EQUAL( VP8_PACKET_PROP_START_PACKET | VP8_PACKET_PROP_PARTITION_START,
                        properties );
 }
 
 /*-----------------------------------------------------------*/
 
+/**
+ * @brief Validate VP8 packet info for key frames and partition starts.
+ */
+void test_VP8_Depacketizer_GetPacketInfo( void )
+{
+    VP8Result_t result;
+    VP8PacketInfo_t packetInfo;
+    uint32_t properties;
+    uint8_t keyFramePacket[] =
+    {
+        /* X = 0, S = 1, PID = 0. */
+        0x10,
+        /* Size0 = 5, H = 1, P = 0. */
+        0xB0,
+        /* Size1, Size2. */
+        0x12, 0x00,
+        /* Start code. */
+        0x9D, 0x01, 0x2A,
+        /* Width = 640, horizontal scale = 1. */
+        0x80, 0x42,
+        /* Height = 480, vertical scale = 0. */
+        0xE0, 0x01,
+        /* Payload. */
+        0x00, 0x01
+    };
+    uint8_t partitionPacket[] =
+    {
+        /* X = 0, S = 1, PID = 2. */
+        0x12,
+        /* Payload. */
+        0x00, 0x01, 0x02
+    };
+    uint8_t truncatedPacket[] =
+    {
+        /* X = 1, S = 1. */
+        0x90,
+        /* I = 1. */
+        0x80
+    };
+
+    result = VP8Depacketizer_GetPacketInfo( &( keyFramePacket[ 0 ] ),
+                                            sizeof( keyFramePacket ),
+                                            &( packetInfo ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( VP8_PACKET_PROP_START_PACKET |
+                       VP8_PACKET_PROP_PARTITION_START |
+                       VP8_PACKET_PROP_KEYFRAME |
+                       VP8_PACKET_PROP_SHOW_FRAME,
+                       packetInfo.packetProperties );
+    TEST_ASSERT_EQUAL( 0x95,
+                       packetInfo.firstPartitionSize );
+    TEST_ASSERT_EQUAL( 640,
+                       packetInfo.width );
+    TEST_ASSERT_EQUAL( 1,
+                       packetInfo.horizontalScale );
+    TEST_ASSERT_EQUAL( 480,
+                       packetInfo.height );
+    TEST_ASSERT_EQUAL( 0,
+                       packetInfo.verticalScale );
+
+    result = VP8Depacketizer_GetPacketProperties( &( partitionPacket[ 0 ] ),
+                                                  sizeof( partitionPacket ),
+                                                  &( properties ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( VP8_PACKET_PROP_PARTITION_START,
+                       properties & ~VP8_PACKET_PROP_PID_BITMASK );
+    TEST_ASSERT_EQUAL( 2,
+                       VP8_PACKET_PROP_GET_PID( properties ) );
+
+    result = VP8Depacketizer_GetPacketProperties( &( truncatedPacket[ 0 ] ),
+                                                  sizeof( truncatedPacket ),
+                                                  &( properties ) );
+
+    TEST_ASSERT_EQUAL( VP8_MALFORMED_PACKET,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate VP8 depacketization into payload slices without copying.
+ */
+void test_VP8_Depacketizer_GetFrameSlices( void )
+{
+    VP8DepacketizerContext_t ctx;
+    VP8Result_t result;
+    VP8Packet_t pkt;
+    VP8Frame_t frame;
+    VP8FrameSlice_t slices[ 2 ];
+    size_t slicesCount;
+    uint8_t packetData1[] =
+    {
+        /* X = 1, S = 1. */
+        0x90,
+        /* I = 1. */
+        0x80,
+        /* Picture ID = 0x12. */
+        0x12,
+        /* Payload. */
+        0x00, 0x01, 0x02
+    };
+    uint8_t packetData2[] =
+    {
+        /* X = 1. */
+        0x80,
+        /* I = 1. */
+        0x80,
+        /* Picture ID = 0x12. */
+        0x12,
+        /* Payload. */
+        0x03, 0x04
+    };
+
+    result = VP8Depacketizer_Init( &( ctx ),
+                                   &( packetsArray[ 0 ] ),
+                                   VP8_PACKETS_ARR_LEN );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packetData1[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData1 );
+
+    result = VP8Depacketizer_AddPacket( &( ctx ),
+                                        &( pkt ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+
+    /* Single packet frame points to the payload in the packet. */
+    result = VP8Depacketizer_GetFrameSlices( &( ctx ),
+                                             &( frame ),
+                                             &( slices[ 0 ] ),
+                                             2,
+                                             &( slicesCount ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       slicesCount );
+    TEST_ASSERT_EQUAL_PTR( &( packetData1[ 3 ] ),
+                           frame.pFrameData );
+    TEST_ASSERT_EQUAL( 3,
+                       frame.frameDataLength );
+    TEST_ASSERT_EQUAL( VP8_FRAME_PROP_PICTURE_ID_PRESENT,
+                       frame.frameProperties );
+    TEST_ASSERT_EQUAL( 0x12,
+                       frame.pictureId );
+
+    pkt.pPacketData = &( packetData2[ 0 ] );
+    pkt.packetDataLength = sizeof( packetData2 );
+
+    result = VP8Depacketizer_AddPacket( &( ctx ),
+                                        &( pkt ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+
+    result = VP8Depacketizer_GetFrameSlices( &( ctx ),
+                                             &( frame ),
+                                             &( slices[ 0 ] ),
+                                             1,
+                                             &( slicesCount ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OUT_OF_MEMORY,
+                       result );
+
+    result = VP8Depacketizer_GetFrameSlices( &( ctx ),
+                                             &( frame ),
+                                             &( slices[ 0 ] ),
+                                             2,
+                                             &( slicesCount ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       slicesCount );
+    TEST_ASSERT_NULL( frame.pFrameData );
+    TEST_ASSERT_EQUAL( 5,
+                       frame.frameDataLength );
+    TEST_ASSERT_EQUAL_PTR( &( packetData1[ 3 ] ),
+                           slices[ 0 ].pSliceData );
+    TEST_ASSERT_EQUAL( 3,
+                       slices[ 0 ].sliceDataLength );
+    TEST_ASSERT_EQUAL_PTR( &( packetData2[ 3 ] ),
+                           slices[ 1 ].pSliceData );
+    TEST_ASSERT_EQUAL( 2,
+                       slices[ 1 ].sliceDataLength );
+}
+
+/*-----------------------------------------------------------*/
+
 /**
  * @brief Validate VP8 depacketization happy path with no extensions.
  */
@@ -1732,3 +2240,179 @@ void test_VP8_Depacketizer_GetPacketProperties_BadParams( void )
 }
 
 /*-----------------------------------------------------------*/
+
+/* ==============================  Test Cases for Layer Filter ============================== */
+
+/**
+ * @brief Validate VP8 temporal layer filtering and picture ID rewriting, with
+ * the same packets filtered for two receivers.
+ */
+void test_VP8_LayerFilter_FilterPacket( void )
+{
+    VP8LayerFilterContext_t ctx, allLayersCtx;
+    VP8Result_t result;
+    uint8_t forwardPacket, i;
+    uint8_t descriptor[ VP8_PAYLOAD_DESC_MAX_LENGTH ];
+    size_t descriptorLength;
+    uint8_t keyFramePacket[] =
+    {
+        /* X = 1, S = 1. */
+        0x90,
+        /* I = 1, T = 1. */
+        0xA0,
+        /* Picture ID = 10. */
+        0x0A,
+        /* TID = 0. */
+        0x00,
+        /* Key frame payload header. */
+        0x10, 0x00, 0x00, 0x9D, 0x01, 0x2A, 0x80, 0x02, 0xE0, 0x01
+    };
+    uint8_t packet[] =
+    {
+        /* X = 1, S = 1. */
+        0x90,
+        /* I = 1, T = 1. */
+        0xA0,
+        /* Picture ID. */
+        0x00,
+        /* TID and Y. */
+        0x00,
+        /* Inter frame payload header. */
+        0x11, 0x00, 0x00
+    };
+    uint8_t noExtensionPacket[] = { 0x10, 0x11, 0x00, 0x00 };
+    /* TID and Y byte, expected forward decision and forwarded picture ID for
+     * picture IDs 11 to 16. Target TID is 1 till picture ID 14. */
+    uint8_t tidBytes[] = { 0x80, 0x40, 0x80, 0x00, 0x80, 0xA0 };
+    uint8_t expectedForward[] = { 0, 1, 0, 1, 0, 1 };
+    uint8_t expectedPictureIds[] = { 0, 11, 0, 12, 0, 13 };
+
+    result = VP8LayerFilter_Init( &( ctx ),
+                                  4 );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_BAD_PARAM,
+                       result );
+
+    result = VP8LayerFilter_Init( &( ctx ),
+                                  1 );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+
+    result = VP8LayerFilter_Init( &( allLayersCtx ),
+                                  3 );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+
+    result = VP8LayerFilter_FilterPacket( &( ctx ),
+                                          &( keyFramePacket[ 0 ] ),
+                                          sizeof( keyFramePacket ),
+                                          &( descriptor[ 0 ] ),
+                                          &( descriptorLength ),
+                                          &( forwardPacket ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       forwardPacket );
+    TEST_ASSERT_EQUAL( 4,
+                       descriptorLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( keyFramePacket[ 0 ] ),
+                                   &( descriptor[ 0 ] ),
+                                   descriptorLength );
+
+    result = VP8LayerFilter_FilterPacket( &( allLayersCtx ),
+                                          &( keyFramePacket[ 0 ] ),
+                                          sizeof( keyFramePacket ),
+                                          &( descriptor[ 0 ] ),
+                                          &( descriptorLength ),
+                                          &( forwardPacket ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       forwardPacket );
+
+    for( i = 0; i < sizeof( tidBytes ); i++ )
+    {
+        if( i == 4 )
+        {
+            /* Switching up to TID 2 waits for a frame with Y bit set. */
+            result = VP8LayerFilter_SetTargetTid( &( ctx ),
+                                                  2 );
+
+            TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                               result );
+        }
+
+        packet[ 2 ] = 11 + i;
+        packet[ 3 ] = tidBytes[ i ];
+
+        result = VP8LayerFilter_FilterPacket( &( ctx ),
+                                              &( packet[ 0 ] ),
+                                              sizeof( packet ),
+                                              &( descriptor[ 0 ] ),
+                                              &( descriptorLength ),
+                                              &( forwardPacket ) );
+
+        TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( expectedForward[ i ],
+                           forwardPacket );
+        TEST_ASSERT_EQUAL( 4,
+                           descriptorLength );
+
+        if( forwardPacket != 0 )
+        {
+            TEST_ASSERT_EQUAL( expectedPictureIds[ i ],
+                               descriptor[ 2 ] );
+        }
+
+        /* The packet is left unchanged for the other receiver, which gets
+         * all the layers with the original picture IDs. */
+        TEST_ASSERT_EQUAL( 11 + i,
+                           packet[ 2 ] );
+
+        result = VP8LayerFilter_FilterPacket( &( allLayersCtx ),
+                                              &( packet[ 0 ] ),
+                                              sizeof( packet ),
+                                              &( descriptor[ 0 ] ),
+                                              &( descriptorLength ),
+                                              &( forwardPacket ) );
+
+        TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                           result );
+        TEST_ASSERT_EQUAL( 1,
+                           forwardPacket );
+        TEST_ASSERT_EQUAL( 11 + i,
+                           descriptor[ 2 ] );
+    }
+
+    /* Payload descriptor without extensions. */
+    result = VP8LayerFilter_FilterPacket( &( allLayersCtx ),
+                                          &( noExtensionPacket[ 0 ] ),
+                                          sizeof( noExtensionPacket ),
+                                          &( descriptor[ 0 ] ),
+                                          &( descriptorLength ),
+                                          &( forwardPacket ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 1,
+                       forwardPacket );
+    TEST_ASSERT_EQUAL( 1,
+                       descriptorLength );
+
+    result = VP8LayerFilter_FilterPacket( &( ctx ),
+                                          &( packet[ 0 ] ),
+                                          sizeof( packet ),
+                                          NULL,
+                                          &( descriptorLength ),
+                                          &( forwardPacket ) );
+
+    TEST_ASSERT_EQUAL( VP8_RESULT_BAD_PARAM,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,346 @@
+/* Unity includes. */
+#include "unity.h"
+#include "catch_assert.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "vp9_depacketizer.h"
+#include "vp9_packetizer.h"
+
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define MAX_PACKETS_IN_A_FRAME  512
+#define MAX_FRAME_LENGTH        10 * 1024
+#define MAX_VP9_PACKET_LENGTH   20
+
+uint8_t frameBuffer[ MAX_FRAME_LENGTH ];
+
+static uint8_t frameData[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09 };
+
+/* Non-flexible mode key frame with scalability structure for 2 spatial
+ * layers. */
+static uint8_t packet1[] = { 0xaa, 0x92, 0x34, 0x10, 0x05,
+                             0x38, 0x01, 0x40, 0x00, 0xb4, 0x02, 0x80, 0x01, 0x68, 0x01, 0x14, 0x01,
+                             0x00, 0x01, 0x02 };
+static uint8_t packet2[] = { 0xa4, 0x92, 0x34, 0x10, 0x05,
+                             0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09 };
+
+/* Flexible mode frame in spatial layer 1, temporal layer 2 with 2 reference
+ * indices. */
+static uint8_t flexiblePacket[] = { 0xfc, 0x05, 0x43, 0x03, 0x06,
+                                    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09 };
+
+void setUp( void )
+{
+    memset( &( frameBuffer[ 0 ] ),
+            0,
+            sizeof( frameBuffer ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases for Packetization ============================== */
+
+/**
+ * @brief Validate VP9 packetization in non-flexible mode with scalability
+ * structure.
+ */
+void test_VP9_Packetizer_ScalabilityStructure( void )
+{
+    VP9PacketizerContext_t ctx = { 0 };
+    VP9Result_t result;
+    VP9Packet_t pkt;
+    VP9Frame_t frame = { 0 };
+    uint8_t pktBuffer[ MAX_VP9_PACKET_LENGTH ];
+
+    frame.frameProperties = VP9_FRAME_PROP_PICTURE_ID_PRESENT |
+                            VP9_FRAME_PROP_LAYER_INDICES_PRESENT |
+                            VP9_FRAME_PROP_SWITCHING_UP_POINT |
+                            VP9_FRAME_PROP_SS_PRESENT |
+                            VP9_FRAME_PROP_SS_RESOLUTION_PRESENT |
+                            VP9_FRAME_PROP_SS_PICTURE_GROUP_PRESENT;
+    frame.pictureId = 0x1234;
+    frame.tl0PicIndex = 5;
+    frame.scalabilityStructure.numSpatialLayers = 2;
+    frame.scalabilityStructure.width[ 0 ] = 320;
+    frame.scalabilityStructure.height[ 0 ] = 180;
+    frame.scalabilityStructure.width[ 1 ] = 640;
+    frame.scalabilityStructure.height[ 1 ] = 360;
+    frame.scalabilityStructure.pictureGroupLength = 1;
+    frame.scalabilityStructure.pictureGroup[ 0 ].switchingUpPoint = 1;
+    frame.scalabilityStructure.pictureGroup[ 0 ].numPDiffs = 1;
+    frame.scalabilityStructure.pictureGroup[ 0 ].pDiffs[ 0 ] = 1;
+    frame.pFrameData = &( frameData[ 0 ] );
+    frame.frameDataLength = sizeof( frameData );
+
+    result = VP9Packetizer_Init( &( ctx ),
+                                 &( frame ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = MAX_VP9_PACKET_LENGTH;
+    result = VP9Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( packet1 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( packet1[ 0 ] ),
+                                   &( pktBuffer[ 0 ] ),
+                                   pkt.packetDataLength );
+
+    pkt.packetDataLength = MAX_VP9_PACKET_LENGTH;
+    result = VP9Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( packet2 ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( packet2[ 0 ] ),
+                                   &( pktBuffer[ 0 ] ),
+                                   pkt.packetDataLength );
+
+    pkt.packetDataLength = MAX_VP9_PACKET_LENGTH;
+    result = VP9Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_NO_MORE_PACKETS,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate VP9 packetization in flexible mode.
+ */
+void test_VP9_Packetizer_FlexibleMode( void )
+{
+    VP9PacketizerContext_t ctx = { 0 };
+    VP9Result_t result;
+    VP9Packet_t pkt;
+    VP9Frame_t frame = { 0 };
+    uint8_t pktBuffer[ MAX_VP9_PACKET_LENGTH ];
+
+    frame.frameProperties = VP9_FRAME_PROP_PICTURE_ID_PRESENT |
+                            VP9_FRAME_PROP_INTER_PICTURE_PREDICTED |
+                            VP9_FRAME_PROP_LAYER_INDICES_PRESENT |
+                            VP9_FRAME_PROP_FLEXIBLE_MODE |
+                            VP9_FRAME_PROP_INTER_LAYER_DEPENDENCY;
+    frame.pictureId = 5;
+    frame.tid = 2;
+    frame.sid = 1;
+    frame.pFrameData = &( frameData[ 0 ] );
+    frame.frameDataLength = sizeof( frameData );
+
+    /* Reference indices are required for inter-picture predicted frames. */
+    result = VP9Packetizer_Init( &( ctx ),
+                                 &( frame ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_BAD_PARAM,
+                       result );
+
+    frame.numPDiffs = 2;
+    frame.pDiffs[ 0 ] = 1;
+    frame.pDiffs[ 1 ] = 3;
+    result = VP9Packetizer_Init( &( ctx ),
+                                 &( frame ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( pktBuffer[ 0 ] );
+    pkt.packetDataLength = MAX_VP9_PACKET_LENGTH;
+    result = VP9Packetizer_GetPacket( &( ctx ),
+                                      &( pkt ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( flexiblePacket ),
+                       pkt.packetDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( flexiblePacket[ 0 ] ),
+                                   &( pktBuffer[ 0 ] ),
+                                   pkt.packetDataLength );
+}
+
+/* ==============================  Test Cases for Depacketization ============================== */
+
+/**
+ * @brief Validate VP9 depacketization happy path with scalability structure.
+ */
+void test_VP9_Depacketizer_GetFrame( void )
+{
+    VP9DepacketizerContext_t ctx = { 0 };
+    VP9Result_t result;
+    VP9Packet_t pkt;
+    VP9Frame_t frame;
+    VP9Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+
+    result = VP9Depacketizer_Init( &( ctx ),
+                                   &( packetsArray[ 0 ] ),
+                                   MAX_PACKETS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packet1[ 0 ] );
+    pkt.packetDataLength = sizeof( packet1 );
+    result = VP9Depacketizer_AddPacket( &( ctx ),
+                                        &( pkt ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packet2[ 0 ] );
+    pkt.packetDataLength = sizeof( packet2 );
+    result = VP9Depacketizer_AddPacket( &( ctx ),
+                                        &( pkt ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = VP9Depacketizer_GetFrame( &( ctx ),
+                                       &( frame ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( frameData ),
+                       frame.frameDataLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( frameData[ 0 ] ),
+                                   &( frameBuffer[ 0 ] ),
+                                   frame.frameDataLength );
+    TEST_ASSERT_EQUAL( VP9_FRAME_PROP_PICTURE_ID_PRESENT |
+                       VP9_FRAME_PROP_LAYER_INDICES_PRESENT |
+                       VP9_FRAME_PROP_SWITCHING_UP_POINT |
+                       VP9_FRAME_PROP_SS_PRESENT |
+                       VP9_FRAME_PROP_SS_RESOLUTION_PRESENT |
+                       VP9_FRAME_PROP_SS_PICTURE_GROUP_PRESENT,
+                       frame.frameProperties );
+    TEST_ASSERT_EQUAL( 0x1234,
+                       frame.pictureId );
+    TEST_ASSERT_EQUAL( 5,
+                       frame.tl0PicIndex );
+    TEST_ASSERT_EQUAL( 2,
+                       frame.scalabilityStructure.numSpatialLayers );
+    TEST_ASSERT_EQUAL( 640,
+                       frame.scalabilityStructure.width[ 1 ] );
+    TEST_ASSERT_EQUAL( 360,
+                       frame.scalabilityStructure.height[ 1 ] );
+    TEST_ASSERT_EQUAL( 1,
+                       frame.scalabilityStructure.pictureGroupLength );
+    TEST_ASSERT_EQUAL( 1,
+                       frame.scalabilityStructure.pictureGroup[ 0 ].pDiffs[ 0 ] );
+
+    /* First packet without B bit. */
+    result = VP9Depacketizer_Init( &( ctx ),
+                                   &( packetsArray[ 0 ] ),
+                                   MAX_PACKETS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( packet2[ 0 ] );
+    pkt.packetDataLength = sizeof( packet2 );
+    result = VP9Depacketizer_AddPacket( &( ctx ),
+                                        &( pkt ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = VP9Depacketizer_GetFrame( &( ctx ),
+                                       &( frame ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_MALFORMED_PACKET,
+                       result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate VP9 depacketization in flexible mode.
+ */
+void test_VP9_Depacketizer_FlexibleMode( void )
+{
+    VP9DepacketizerContext_t ctx = { 0 };
+    VP9Result_t result;
+    VP9Packet_t pkt;
+    VP9Frame_t frame;
+    VP9Packet_t packetsArray[ MAX_PACKETS_IN_A_FRAME ];
+
+    result = VP9Depacketizer_Init( &( ctx ),
+                                   &( packetsArray[ 0 ] ),
+                                   MAX_PACKETS_IN_A_FRAME );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+
+    pkt.pPacketData = &( flexiblePacket[ 0 ] );
+    pkt.packetDataLength = sizeof( flexiblePacket );
+    result = VP9Depacketizer_AddPacket( &( ctx ),
+                                        &( pkt ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+
+    frame.pFrameData = &( frameBuffer[ 0 ] );
+    frame.frameDataLength = MAX_FRAME_LENGTH;
+    result = VP9Depacketizer_GetFrame( &( ctx ),
+                                       &( frame ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( sizeof( frameData ),
+                       frame.frameDataLength );
+    TEST_ASSERT_EQUAL( 2,
+                       frame.tid );
+    TEST_ASSERT_EQUAL( 1,
+                       frame.sid );
+    TEST_ASSERT_EQUAL( 2,
+                       frame.numPDiffs );
+    TEST_ASSERT_EQUAL( 1,
+                       frame.pDiffs[ 0 ] );
+    TEST_ASSERT_EQUAL( 3,
+                       frame.pDiffs[ 1 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate VP9 packet properties with layer IDs.
+ */
+void test_VP9_Depacketizer_GetPacketProperties( void )
+{
+    VP9Result_t result;
+    uint32_t properties;
+    uint8_t truncatedPacket[] = { 0xa8, 0x92, 0x34 };
+
+    result = VP9Depacketizer_GetPacketProperties( &( packet1[ 0 ] ),
+                                                  sizeof( packet1 ),
+                                                  &( properties ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( VP9_PACKET_PROP_START_PACKET |
+                       VP9_PACKET_PROP_KEYFRAME |
+                       VP9_PACKET_PROP_LAYER_INDICES_PRESENT |
+                       VP9_PACKET_PROP_SWITCHING_UP_POINT,
+                       properties );
+
+    result = VP9Depacketizer_GetPacketProperties( &( flexiblePacket[ 0 ] ),
+                                                  sizeof( flexiblePacket ),
+                                                  &( properties ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_OK,
+                       result );
+    TEST_ASSERT_EQUAL( 2,
+                       VP9_PACKET_PROP_GET_TID( properties ) );
+    TEST_ASSERT_EQUAL( 1,
+                       VP9_PACKET_PROP_GET_SID( properties ) );
+    TEST_ASSERT_EQUAL( 0,
+                       properties & VP9_PACKET_PROP_KEYFRAME );
+    TEST_ASSERT_NOT_EQUAL( 0,
+                           properties & VP9_PACKET_PROP_END_PACKET );
+    TEST_ASSERT_NOT_EQUAL( 0,
+                           properties & VP9_PACKET_PROP_INTER_LAYER_DEPENDENCY );
+
+    result = VP9Depacketizer_GetPacketProperties( &( truncatedPacket[ 0 ] ),
+                                                  sizeof( truncatedPacket ),
+                                                  &( properties ) );
+    TEST_ASSERT_EQUAL( VP9_RESULT_MALFORMED_PACKET,
+                       result );
+}
+
+/*-----------------------------------------------------------*/